@@ -342,6 +342,13 @@ _group_types = [eval(f"cxx.{x.name}") for x in list(cxx.get_wsv_groups())]
 
 
 class Workspace(InternalWorkspace):
+    """ An ARTS workspace
+
+    Workspace methods and agendas run without holding the GIL, so several
+    workspaces may do work at the same time from different Python threads.
+    One workspace, and its shallow copies, must only be used by one thread at
+    a time.
+    """
     def __getattribute__(self, attr):
         if attr.startswith("__"):
             object.__getattribute__(self, attr)
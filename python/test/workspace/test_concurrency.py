@@ -0,0 +1,99 @@
+"""
+Test running workspace methods on several workspaces from Python threads.
+"""
+import os
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pyarts.arts as cxx
+from pyarts.workspace import Workspace
+
+
+NCALLS = 5
+
+
+def ycalc(ws):
+    """
+    Runs yCalc a few times on one thread of ARTS and returns the last y.
+    """
+    ws.SetNumberOfThreads(1)
+    for i in range(NCALLS):
+        ws.yCalc()
+    return np.copy(ws.y.value)
+
+
+class TestConcurrency:
+    """
+    Tests that methods on different workspaces run concurrently.
+    """
+    def setup_method(self):
+        self.nws = max(2, min(4, os.cpu_count() or 1))
+        self.wss = []
+        for i in range(self.nws):
+            ws = Workspace(verbosity=0)
+            ws.execute_controlfile("artscomponents/clearsky/TestClearSky.arts")
+            self.wss.append(ws)
+
+    def test_concurrent_ycalc(self):
+        """
+        The threads must give the serial results.
+        """
+        serial = [ycalc(ws) for ws in self.wss]
+        with ThreadPoolExecutor(max_workers=self.nws) as pool:
+            threaded = list(pool.map(ycalc, self.wss))
+
+        for y, ref in zip(threaded, serial):
+            assert np.array_equal(y, ref)
+
+    def test_concurrent_agenda(self):
+        """
+        Agendas calling back into Python may run from threads on their own
+        workspaces.
+        """
+        def callback(ws):
+            ws.y_copy = ws.y.value
+
+        def run(ws):
+            ws.y_copy = cxx.Vector()
+            agenda = cxx.Agenda(ws)
+            agenda.add_workspace_method("yCalc")
+            agenda.add_callback_method(callback)
+            agenda.name = "test_agenda"
+            agenda.check(ws)
+            agenda.execute(ws)
+            return np.copy(ws.y_copy.value)
+
+        serial = [run(ws) for ws in self.wss]
+        with ThreadPoolExecutor(max_workers=self.nws) as pool:
+            threaded = list(pool.map(run, self.wss))
+
+        for y, ref in zip(threaded, serial):
+            assert np.array_equal(y, ref)
+
+
+def benchmark():
+    """
+    Prints the time of yCalc on the workspaces one after the other and in
+    threads.  Not a test, as the timing depends on the machine and its load.
+    """
+    test = TestConcurrency()
+    test.setup_method()
+
+    start = time.perf_counter()
+    for ws in test.wss:
+        ycalc(ws)
+    serial_time = time.perf_counter() - start
+
+    start = time.perf_counter()
+    with ThreadPoolExecutor(max_workers=test.nws) as pool:
+        list(pool.map(ycalc, test.wss))
+    threaded_time = time.perf_counter() - start
+
+    print(f"{test.nws} workspaces on {os.cpu_count()} cores: "
+          f"{serial_time:.3f} s one after the other, "
+          f"{threaded_time:.3f} s in threads")
+
+
+if __name__ == "__main__":
+    benchmark()
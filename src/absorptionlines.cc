@@ -10,14 +10,25 @@
 
 #include "absorptionlines.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
 #include <limits>
 #include <numeric>
 #include <ostream>
 #include <string>
+#include <string_view>
 
 #include "absorption.h"
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "debug.h"
 #include "enums.h"
 #include "file.h"
@@ -557,8 +568,48 @@ Absorption::SingleLineExternal Absorption::ReadFromArtscat5Stream(istream& is) {
   return data;
 }
 
+namespace {
+/** Reads the next line of a HITRAN catalog
+ *
+ * @param[in] is Input stream
+ * @param[out] line The line, without a DOS carriage return
+ * @return False if the end of the stream was reached before a line was read
+ */
+bool read_hitran_line(istream& is, String& line) {
+  // Return true if eof is reached:
+  if (is.eof()) return false;
+
+  // Throw runtime_error if stream is bad:
+  ARTS_USER_ERROR_IF(!is, "Stream bad.");
+
+  // Read line from file into linebuffer:
+  getline(is, line);
+
+  // It is possible that we were exactly at the end of the file before
+  // calling getline. In that case the previous eof() was still false
+  // because eof() evaluates only to true if one tries to read after the
+  // end of the file. The following check catches this.
+  if (line.nelem() == 0 && is.eof()) return false;
+
+  // If the catalogue is in dos encoding, throw away the
+  // additional carriage return
+  if (line.nelem() and line[line.nelem() - 1] == 13) {
+    line.erase(line.nelem() - 1, 1);
+  }
+
+  return true;
+}
+}  // namespace
+
 Absorption::SingleLineExternal Absorption::ReadFromHitran2004Stream(
     istream& is) {
+  String line;
+  if (not read_hitran_line(is, line)) return {};
+  return ReadFromHitran2004Line(line);
+}
+
+Absorption::SingleLineExternal Absorption::ReadFromHitran2004Line(
+    std::string_view line) {
   // Default data and values for this type
   SingleLineExternal data;
   data.selfbroadening = true;
@@ -570,42 +621,10 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2004Stream(
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
   // extract stuff from the beginning.
-  String line;
 
   // The first item is the molecule number:
-  Index mo;
-
-  // Look for more comments?
-  bool comment = true;
-
-  while (comment) {
-    // Return true if eof is reached:
-    if (is.eof()) return data;
-
-    // Throw runtime_error if stream is bad:
-    ARTS_USER_ERROR_IF(!is, "Stream bad.");
-
-    // Read line from file into linebuffer:
-    getline(is, line);
-
-    // It is possible that we were exactly at the end of the file before
-    // calling getline. In that case the previous eof() was still false
-    // because eof() evaluates only to true if one tries to read after the
-    // end of the file. The following check catches this.
-    if (line.nelem() == 0 && is.eof()) return data;
-
-    // If the catalogue is in dos encoding, throw away the
-    // additional carriage return
-    if (line[line.nelem() - 1] == 13) {
-      line.erase(line.nelem() - 1, 1);
-    }
-
-    mo = 0;
-    // Initialization of mo is important, because mo stays the same
-    // if line is empty.
-    extract(mo, line, 2);
-    comment = false;
-  }
+  Index mo = 0;
+  extract(mo, line, 2);
 
   // Extract isotopologue:
   char iso;
@@ -823,6 +842,13 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2004Stream(
 
 Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(
     istream& is) {
+  String line;
+  if (not read_hitran_line(is, line)) return {};
+  return ReadFromHitranOnlineLine(line);
+}
+
+Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineLine(
+    std::string_view line) {
   // Default data and values for this type
   SingleLineExternal data;
   data.selfbroadening = true;
@@ -834,42 +860,10 @@ Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
   // extract stuff from the beginning.
-  String line;
 
   // The first item is the molecule number:
-  Index mo;
-
-  // Look for more comments?
-  bool comment = true;
-
-  while (comment) {
-    // Return true if eof is reached:
-    if (is.eof()) return data;
-
-    // Throw runtime_error if stream is bad:
-    ARTS_USER_ERROR_IF(!is, "Stream bad.");
-
-    // Read line from file into linebuffer:
-    getline(is, line);
-
-    // It is possible that we were exactly at the end of the file before
-    // calling getline. In that case the previous eof() was still false
-    // because eof() evaluates only to true if one tries to read after the
-    // end of the file. The following check catches this.
-    if (line.nelem() == 0 && is.eof()) return data;
-
-    // If the catalogue is in dos encoding, throw away the
-    // additional carriage return
-    if (line[line.nelem() - 1] == 13) {
-      line.erase(line.nelem() - 1, 1);
-    }
-
-    mo = 0;
-    // Initialization of mo is important, because mo stays the same
-    // if line is empty.
-    extract(mo, line, 2);
-    comment = false;
-  }
+  Index mo = 0;
+  extract(mo, line, 2);
 
   // Extract isotopologue:
   char iso;
@@ -1081,10 +1075,15 @@ Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(
   }
 
   // ADD QUANTUM NUMBER PARSING HERE!
-  String upper, lower;
-  std::stringstream ss;
-  ss.str(line);
-  ss >> upper >> lower;
+  const auto next_word = [&line]() {
+    constexpr std::string_view space = " \t\n\v\f\r";
+    line.remove_prefix(std::min(line.find_first_not_of(space), line.size()));
+    const std::string_view word = line.substr(0, line.find_first_of(space));
+    line.remove_prefix(word.size());
+    return word;
+  };
+  const std::string_view upper = next_word();
+  const std::string_view lower = next_word();
   data.quantumidentity.val = Quantum::Number::from_hitran(upper, lower);
 
   // That's it!
@@ -1094,6 +1093,13 @@ Absorption::SingleLineExternal Absorption::ReadFromHitranOnlineStream(
 
 Absorption::SingleLineExternal Absorption::ReadFromHitran2001Stream(
     istream& is) {
+  String line;
+  if (not read_hitran_line(is, line)) return {};
+  return ReadFromHitran2001Line(line);
+}
+
+Absorption::SingleLineExternal Absorption::ReadFromHitran2001Line(
+    std::string_view line) {
   // Default data and values for this type
   SingleLineExternal data;
   data.selfbroadening = true;
@@ -1105,42 +1111,10 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2001Stream(
   // This contains the rest of the line to parse. At the beginning the
   // entire line. Line gets shorter and shorter as we continue to
   // extract stuff from the beginning.
-  String line;
 
   // The first item is the molecule number:
-  Index mo;
-
-  // Look for more comments?
-  bool comment = true;
-
-  while (comment) {
-    // Return true if eof is reached:
-    if (is.eof()) return data;
-
-    // Throw runtime_error if stream is bad:
-    ARTS_USER_ERROR_IF(!is, "Stream bad.");
-
-    // Read line from file into linebuffer:
-    getline(is, line);
-
-    // It is possible that we were exactly at the end of the file before
-    // calling getline. In that case the previous eof() was still false
-    // because eof() evaluates only to true if one tries to read after the
-    // end of the file. The following check catches this.
-    if (line.nelem() == 0 && is.eof()) return data;
-
-    // If the catalogue is in dos encoding, throw away the
-    // additional carriage return
-    if (line[line.nelem() - 1] == 13) {
-      line.erase(line.nelem() - 1, 1);
-    }
-
-    mo = 0;
-    // Initialization of mo is important, because mo stays the same
-    // if line is empty.
-    extract(mo, line, 2);
-    comment = false;
-  }
+  Index mo = 0;
+  extract(mo, line, 2);
 
   // Extract isotopologue:
   char iso;
@@ -1331,6 +1305,459 @@ Absorption::SingleLineExternal Absorption::ReadFromHitran2001Stream(
   return data;
 }
 
+namespace {
+//! A read-only memory mapping of a whole text file
+struct MappedText {
+  void* addr{nullptr};
+  std::size_t length{0};
+
+  explicit MappedText(const String& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    ARTS_USER_ERROR_IF(
+        fd < 0, "Cannot open ", filename, ": ", std::strerror(errno))
+
+    struct stat st {};
+    if (::fstat(fd, &st) == 0 and st.st_size > 0) {
+      length = static_cast<std::size_t>(st.st_size);
+      addr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+
+    ARTS_USER_ERROR_IF(
+        addr == MAP_FAILED, "Cannot map ", filename, ": ", std::strerror(errno))
+  }
+
+  MappedText(const MappedText&) = delete;
+  MappedText& operator=(const MappedText&) = delete;
+
+  ~MappedText() {
+    if (addr) ::munmap(addr, length);
+  }
+
+  [[nodiscard]] std::string_view text() const noexcept {
+    return addr ? std::string_view{static_cast<const char*>(addr), length}
+                : std::string_view{};
+  }
+};
+
+//! The lines, and the first error, of a chunk of a catalog file
+struct HitranChunk {
+  std::vector<Absorption::SingleLineExternal> lines{};
+  Index nlines{0};
+  Index error_line{-1};
+  String error{};
+  bool above_fmax{false};
+};
+}  // namespace
+
+std::vector<Absorption::SingleLineExternal> Absorption::ReadFromHitranFile(
+    const String& filename,
+    SingleLineExternal (*read_line)(std::string_view),
+    Numeric fmax) {
+  const MappedText file(filename);
+  const std::string_view text = file.text();
+
+  // Chunks start after a line break so that each holds only whole lines
+  constexpr std::size_t min_chunk_size = 1 << 16;
+  const std::size_t nchunks =
+      std::clamp<std::size_t>(text.size() / min_chunk_size,
+                              1,
+                              4 * std::size_t(arts_omp_get_max_threads()));
+  std::vector<std::size_t> start(nchunks + 1, text.size());
+  start.front() = 0;
+  for (std::size_t i = 1; i < nchunks; i++) {
+    const std::size_t pos =
+        text.find('\n', std::max(start[i - 1], i * text.size() / nchunks));
+    start[i] = pos == std::string_view::npos ? text.size() : pos + 1;
+  }
+
+  // Every line is parsed, as by the stream readers, until the first line
+  // above fmax, which ends the chunk.  Only text after the last line break
+  // ends a file without being a line
+  std::vector<HitranChunk> chunks(nchunks);
+#pragma omp parallel for if (not arts_omp_in_parallel()) schedule(dynamic)
+  for (std::size_t i = 0; i < nchunks; i++) {
+    HitranChunk& chunk = chunks[i];
+    std::string_view rest = text.substr(start[i], start[i + 1] - start[i]);
+    while (rest.size()) {
+      const std::size_t end = std::min(rest.find('\n'), rest.size());
+      std::string_view line = rest.substr(0, end);
+      rest.remove_prefix(std::min(end + 1, rest.size()));
+
+      // If the catalogue is in dos encoding, throw away the
+      // additional carriage return
+      if (line.size() and line.back() == 13) line.remove_suffix(1);
+
+      chunk.nlines++;
+      try {
+        SingleLineExternal sline = read_line(line);
+        ARTS_USER_ERROR_IF(sline.bad, "Bad line")
+        if (sline.line.F0 > fmax) {
+          chunk.above_fmax = true;
+          break;
+        }
+        chunk.lines.push_back(std::move(sline));
+      } catch (const std::exception& e) {
+        chunk.error_line = chunk.nlines;
+        chunk.error = e.what();
+        break;
+      }
+    }
+  }
+
+  // Report the first bad line of the file before any line above fmax, as
+  // the stream readers would
+  Index nlines = 0, nkept = 0;
+  std::size_t nused = 0;
+  while (nused < nchunks) {
+    const HitranChunk& chunk = chunks[nused++];
+    if (chunk.error_line >= 0)
+      ARTS_USER_ERROR("Cannot read line ",
+                      nlines + chunk.error_line,
+                      " of ",
+                      filename,
+                      ":\n",
+                      chunk.error)
+    nlines += chunk.nlines;
+    nkept += Index(chunk.lines.size());
+    if (chunk.above_fmax) break;
+  }
+
+  std::vector<SingleLineExternal> lines;
+  lines.reserve(nkept);
+  for (std::size_t i = 0; i < nused; i++)
+    std::move(chunks[i].lines.begin(),
+              chunks[i].lines.end(),
+              std::back_inserter(lines));
+  return lines;
+}
+
+namespace {
+//! Identifies a binary line catalog file
+constexpr std::array<char, 8> binary_catalog_magic{
+    'A', 'R', 'T', 'S', 'L', 'I', 'N', 'E'};
+
+//! Written as is, so that a file from a machine of other endianness is found
+constexpr std::int64_t binary_catalog_endian = 0x0102030405060708;
+
+//! Changes whenever the layout of a binary line catalog changes
+constexpr std::int64_t binary_catalog_version = 2;
+
+//! Sequential reads of the data of a mapped binary catalog
+struct BinaryCatalogCursor {
+  const char* pos;
+  const char* end;
+  const String& filename;
+
+  void check(std::size_t n) const {
+    ARTS_USER_ERROR_IF(n > std::size_t(end - pos),
+                       "The binary catalog ",
+                       filename,
+                       " is truncated")
+  }
+
+  template <typename T>
+  T get() {
+    check(sizeof(T));
+    T x;
+    std::memcpy(&x, pos, sizeof(T));
+    pos += sizeof(T);
+    return x;
+  }
+
+  String string() {
+    const auto n = std::size_t(get<std::int64_t>());
+    check(n);
+    String s{std::string_view(pos, n)};
+    pos += n;
+    return s;
+  }
+
+  //! A string of space-separated items
+  ArrayOfString items() {
+    ArrayOfString out;
+    const String s = string();
+    if (s.size()) s.split(out, " ");
+    return out;
+  }
+
+  //! The start of a column of n values, skipping past it
+  template <typename T>
+  const char* column(std::size_t n) {
+    check(n * sizeof(T));
+    const char* col = pos;
+    pos += n * sizeof(T);
+    return col;
+  }
+};
+
+template <typename T>
+T column_value(const char* col, std::size_t i) {
+  T x;
+  std::memcpy(&x, col + i * sizeof(T), sizeof(T));
+  return x;
+}
+
+//! Whether the values of the quantum number are strings
+bool is_string_quantum(Quantum::Number::Type type) noexcept {
+  return Quantum::Number::common_value_type(type) ==
+         Quantum::Number::ValueType::S;
+}
+
+//! The stored number of a non-string quantum number value
+Index& quantum_number_x(Quantum::Number::ValueHolder& x,
+                        Quantum::Number::Type type) noexcept {
+  return Quantum::Number::common_value_type(type) ==
+                 Quantum::Number::ValueType::H
+             ? x.h.x
+             : x.i.x;
+}
+}  // namespace
+
+void Absorption::WriteBinaryCatalog(const String& filename,
+                                    const Array<Lines>& bands) {
+  std::ofstream os(filename.c_str(), std::ios::binary);
+  ARTS_USER_ERROR_IF(not os, "Cannot open ", filename, " for writing")
+
+  const auto put = [&os](auto x) {
+    os.write(reinterpret_cast<const char*>(&x), sizeof x);
+  };
+  const auto put_string = [&](const String& x) {
+    put(std::int64_t(x.size()));
+    os.write(x.data(), std::streamsize(x.size()));
+  };
+  const auto put_column = [&](const auto& col) {
+    os.write(reinterpret_cast<const char*>(col.data()),
+             std::streamsize(col.size() * sizeof(col.front())));
+  };
+
+  os.write(binary_catalog_magic.data(), binary_catalog_magic.size());
+  put(std::int64_t(binary_catalog_version));
+  put(binary_catalog_endian);
+  put(std::int64_t(bands.size()));
+
+  std::vector<Numeric> col;
+  std::vector<std::int64_t> icol;
+  std::vector<char> tcol;
+  for (auto& band : bands) {
+    const std::size_t n = band.lines.size();
+
+    // Band-level data
+    put(std::int64_t(n));
+    put_string(var_string(band.quantumidentity));
+    put_string(String(toString(band.cutoff)));
+    put_string(String(toString(band.mirroring)));
+    put_string(String(toString(band.population)));
+    put_string(String(toString(band.normalization)));
+    put_string(String(LineShape::toString(band.lineshapetype)));
+    put(band.T0);
+    put(band.cutofffreq);
+    put(band.linemixinglimit);
+    put(std::int64_t(band.selfbroadening));
+    put(std::int64_t(band.bathbroadening));
+
+    String species;
+    for (auto& spec : band.broadeningspecies)
+      species += var_string(species.size() ? " " : "", Species::toShortName(spec));
+    put_string(species);
+
+    String localquanta;
+    if (n)
+      for (auto& val : band.lines.front().localquanta.val)
+        localquanta += var_string(localquanta.size() ? " " : "", val.type);
+    put_string(localquanta);
+
+    // Line data, a column per parameter
+    col.resize(n);
+    const auto put_numeric = [&](auto&& get) {
+      std::transform(band.lines.begin(), band.lines.end(), col.begin(), get);
+      put_column(col);
+    };
+    put_numeric([](auto& line) { return line.F0; });
+    put_numeric([](auto& line) { return line.I0; });
+    put_numeric([](auto& line) { return line.E0; });
+    put_numeric([](auto& line) { return line.glow; });
+    put_numeric([](auto& line) { return line.gupp; });
+    put_numeric([](auto& line) { return line.A; });
+    put_numeric([](auto& line) { return line.zeeman.gu(); });
+    put_numeric([](auto& line) { return line.zeeman.gl(); });
+
+    // Quantum numbers with string values are written line by line, as
+    // strings, and the others as columns of numbers
+    icol.resize(n);
+    for (Index k = 0; k < band.NumLocalQuanta(); k++) {
+      const auto value = [&](std::size_t i) {
+        return *std::next(band.lines[i].localquanta.val.begin(), k);
+      };
+      if (is_string_quantum(value(0).type)) {
+        for (std::size_t i = 0; i < n; i++) put_string(value(i).str_upp());
+        for (std::size_t i = 0; i < n; i++) put_string(value(i).str_low());
+        continue;
+      }
+      for (std::size_t i = 0; i < n; i++) {
+        auto val = value(i);
+        icol[i] = quantum_number_x(val.qn.upp, val.type);
+      }
+      put_column(icol);
+      for (std::size_t i = 0; i < n; i++) {
+        auto val = value(i);
+        icol[i] = quantum_number_x(val.qn.low, val.type);
+      }
+      put_column(icol);
+    }
+
+    tcol.resize(n);
+    for (Index j = 0; j < band.NumBroadeners(); j++) {
+      for (Index v = 0; v < LineShape::nVars; v++) {
+        const auto var = LineShape::Variable(v);
+        for (std::size_t i = 0; i < n; i++)
+          tcol[i] = char(band.lines[i].lineshape[j].Get(var).type);
+        put_column(tcol);
+        put_numeric([&](auto& line) { return line.lineshape[j].Get(var).X0; });
+        put_numeric([&](auto& line) { return line.lineshape[j].Get(var).X1; });
+        put_numeric([&](auto& line) { return line.lineshape[j].Get(var).X2; });
+        put_numeric([&](auto& line) { return line.lineshape[j].Get(var).X3; });
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(not os, "Error writing ", filename)
+}
+
+Array<Absorption::Lines> Absorption::ReadBinaryCatalog(
+    const String& filename) {
+  const MappedText file(filename);
+  const std::string_view data = file.text();
+  BinaryCatalogCursor in{data.data(), data.data() + data.size(), filename};
+
+  std::array<char, 8> magic{};
+  in.check(magic.size());
+  std::memcpy(magic.data(), in.pos, magic.size());
+  in.pos += magic.size();
+  ARTS_USER_ERROR_IF(magic not_eq binary_catalog_magic,
+                     filename,
+                     " is not a binary line catalog")
+  const auto version = in.get<std::int64_t>();
+  ARTS_USER_ERROR_IF(in.get<std::int64_t>() not_eq binary_catalog_endian,
+                     "The binary catalog ",
+                     filename,
+                     " was written on a machine with other endianness")
+  ARTS_USER_ERROR_IF(version not_eq binary_catalog_version,
+                     "The binary catalog ",
+                     filename,
+                     " has version ",
+                     version,
+                     " but only version ",
+                     binary_catalog_version,
+                     " is supported.  Write it again from the XML catalog")
+
+  Array<Lines> bands(in.get<std::int64_t>());
+  for (auto& band : bands) {
+    const auto n = std::size_t(in.get<std::int64_t>());
+    const QuantumIdentifier id(in.string());
+    const CutoffType cutoff = toCutoffTypeOrThrow(in.string());
+    const MirroringType mirroring = toMirroringTypeOrThrow(in.string());
+    const PopulationType population = toPopulationTypeOrThrow(in.string());
+    const NormalizationType normalization =
+        toNormalizationTypeOrThrow(in.string());
+    const LineShape::Type lineshapetype = LineShape::toTypeOrThrow(in.string());
+    const auto T0 = in.get<Numeric>();
+    const auto cutofffreq = in.get<Numeric>();
+    const auto linemixinglimit = in.get<Numeric>();
+    const bool selfbroadening = in.get<std::int64_t>();
+    const bool bathbroadening = in.get<std::int64_t>();
+
+    ArrayOfSpecies broadeningspecies;
+    for (auto& name : in.items()) {
+      broadeningspecies.push_back(Species::fromShortName(name));
+      ARTS_USER_ERROR_IF(not good_enum(broadeningspecies.back()),
+                         "Species: ", name, " cannot be understood")
+    }
+
+    Array<QuantumNumberType> qn_key;
+    for (auto& name : in.items())
+      qn_key.push_back(Quantum::Number::toType(name));
+    Quantum::Number::LocalState meta_localstate;
+    meta_localstate.set_unsorted_qns(qn_key);
+
+    band = Lines(selfbroadening,
+                 bathbroadening,
+                 n,
+                 cutoff,
+                 mirroring,
+                 population,
+                 normalization,
+                 lineshapetype,
+                 T0,
+                 cutofffreq,
+                 linemixinglimit,
+                 id,
+                 broadeningspecies,
+                 meta_localstate,
+                 LineShape::Model(broadeningspecies.nelem()));
+
+    const auto get_numeric = [&](auto&& set) {
+      const char* col = in.column<Numeric>(n);
+      for (std::size_t i = 0; i < n; i++)
+        set(band.lines[i], column_value<Numeric>(col, i));
+    };
+    get_numeric([](auto& line, Numeric x) { line.F0 = x; });
+    get_numeric([](auto& line, Numeric x) { line.I0 = x; });
+    get_numeric([](auto& line, Numeric x) { line.E0 = x; });
+    get_numeric([](auto& line, Numeric x) { line.glow = x; });
+    get_numeric([](auto& line, Numeric x) { line.gupp = x; });
+    get_numeric([](auto& line, Numeric x) { line.A = x; });
+    get_numeric([](auto& line, Numeric x) { line.zeeman.gu() = x; });
+    get_numeric([](auto& line, Numeric x) { line.zeeman.gl() = x; });
+
+    for (std::size_t k = 0; k < qn_key.size(); k++) {
+      if (is_string_quantum(qn_key[k])) {
+        for (bool upp : {true, false})
+          for (std::size_t i = 0; i < n; i++)
+            std::next(band.lines[i].localquanta.val.begin(), k)
+                ->set(in.string(), upp);
+        continue;
+      }
+
+      const char* upp = in.column<std::int64_t>(n);
+      const char* low = in.column<std::int64_t>(n);
+      for (std::size_t i = 0; i < n; i++) {
+        auto& val = *std::next(band.lines[i].localquanta.val.begin(), k);
+        quantum_number_x(val.qn.upp, val.type) =
+            column_value<std::int64_t>(upp, i);
+        quantum_number_x(val.qn.low, val.type) =
+            column_value<std::int64_t>(low, i);
+      }
+    }
+
+    for (Index j = 0; j < broadeningspecies.nelem(); j++) {
+      for (Index v = 0; v < LineShape::nVars; v++) {
+        const auto var = LineShape::Variable(v);
+        const char* type = in.column<char>(n);
+        const char* X0 = in.column<Numeric>(n);
+        const char* X1 = in.column<Numeric>(n);
+        const char* X2 = in.column<Numeric>(n);
+        const char* X3 = in.column<Numeric>(n);
+        for (std::size_t i = 0; i < n; i++)
+          band.lines[i].lineshape[j].Set(
+              var,
+              LineShape::ModelParameters(
+                  LineShape::TemperatureModel(column_value<char>(type, i)),
+                  column_value<Numeric>(X0, i),
+                  column_value<Numeric>(X1, i),
+                  column_value<Numeric>(X2, i),
+                  column_value<Numeric>(X3, i)));
+      }
+    }
+  }
+
+  ARTS_USER_ERROR_IF(in.pos not_eq in.end,
+                     "The binary catalog ",
+                     filename,
+                     " has trailing data")
+  return bands;
+}
+
 Absorption::SingleLineExternal Absorption::ReadFromLBLRTMStream(istream& is) {
   // Default data and values for this type
   SingleLineExternal data;
@@ -1716,6 +2143,7 @@ std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(
     const std::vector<QuantumNumberType>& localquantas,
     const std::vector<QuantumNumberType>& globalquantas) {
   std::vector<Lines> lines(0);
+  BandIndex index;
 
   // Loop but make copies because we will need to modify some of the data
   while (external_lines.size()) {
@@ -1741,11 +2169,8 @@ std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(
     line.localquanta = local_id;
 
     // Either find a line like this in the list of lines or start a new Lines
-    auto band = std::find_if(lines.begin(), lines.end(), [&](const Lines& li) {
-      return li.MatchWithExternal(sle, global_id);
-    });
-    if (band not_eq lines.end()) {
-      band->AppendSingleLine(line);
+    if (auto band = index.find(lines, sle, global_id); band not_eq lines.size()) {
+      lines[band].AppendSingleLine(line);
     } else {
       lines.push_back(Lines(sle.selfbroadening,
                             sle.bathbroadening,
@@ -1760,6 +2185,7 @@ std::vector<Absorption::Lines> Absorption::split_list_of_external_lines(
                             global_id,
                             sle.species,
                             {line}));
+      index.add(lines.back(), lines.size() - 1);
     }
     external_lines.pop_back();
   }
@@ -2270,6 +2696,134 @@ std::pair<bool, bool> Lines::Match(const Lines& l) const noexcept {
   return {true, true};
 }
 
+namespace {
+/** A hash of the band-level metadata of a band or of an external line
+ *
+ * Bands that Lines::Match, and bands that Lines::MatchWithExternal a line,
+ * have the same hash as their counterpart
+ */
+std::size_t band_metadata_hash(bool selfbroadening,
+                               bool bathbroadening,
+                               CutoffType cutoff,
+                               MirroringType mirroring,
+                               PopulationType population,
+                               NormalizationType normalization,
+                               LineShape::Type lineshapetype,
+                               Numeric T0,
+                               Numeric cutofffreq,
+                               Numeric linemixinglimit,
+                               const QuantumIdentifier& qid,
+                               const ArrayOfSpecies& species) noexcept {
+  std::size_t h = std::hash<Index>{}(qid.isotopologue_index);
+  const auto combine = [&h](std::size_t x) {
+    h ^= x + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+  };
+
+  for (auto& v : qid.val) {
+    combine(std::hash<Index>{}(Index(v.type)));
+    switch (Quantum::Number::common_value_type(v.type)) {
+      case Quantum::Number::ValueType::S:
+        combine(std::hash<std::string_view>{}(v.qn.upp.s.val()));
+        combine(std::hash<std::string_view>{}(v.qn.low.s.val()));
+        break;
+      case Quantum::Number::ValueType::I:
+        combine(std::hash<Index>{}(v.qn.upp.i.x));
+        combine(std::hash<Index>{}(v.qn.low.i.x));
+        break;
+      case Quantum::Number::ValueType::H:
+        combine(std::hash<Index>{}(v.qn.upp.h.x));
+        combine(std::hash<Index>{}(v.qn.low.h.x));
+        break;
+      case Quantum::Number::ValueType::FINAL: {
+      }
+    }
+  }
+
+  for (auto& s : species) combine(std::hash<Index>{}(Index(s)));
+  combine(std::hash<Index>{}(Index(selfbroadening) + 2 * Index(bathbroadening)));
+  combine(std::hash<Index>{}(Index(cutoff)));
+  combine(std::hash<Index>{}(Index(mirroring)));
+  combine(std::hash<Index>{}(Index(population)));
+  combine(std::hash<Index>{}(Index(normalization)));
+  combine(std::hash<Index>{}(Index(lineshapetype)));
+  combine(std::hash<Numeric>{}(T0));
+  combine(std::hash<Numeric>{}(cutofffreq));
+  combine(std::hash<Numeric>{}(linemixinglimit));
+  return h;
+}
+
+std::size_t band_metadata_hash(const Lines& band) noexcept {
+  return band_metadata_hash(band.selfbroadening,
+                            band.bathbroadening,
+                            band.cutoff,
+                            band.mirroring,
+                            band.population,
+                            band.normalization,
+                            band.lineshapetype,
+                            band.T0,
+                            band.cutofffreq,
+                            band.linemixinglimit,
+                            band.quantumidentity,
+                            band.broadeningspecies);
+}
+
+std::size_t band_metadata_hash(const SingleLineExternal& sle,
+                               const QuantumIdentifier& qid) noexcept {
+  return band_metadata_hash(sle.selfbroadening,
+                            sle.bathbroadening,
+                            sle.cutoff,
+                            sle.mirroring,
+                            sle.population,
+                            sle.normalization,
+                            sle.lineshapetype,
+                            sle.T0,
+                            sle.cutofffreq,
+                            sle.linemixinglimit,
+                            qid,
+                            sle.species);
+}
+
+/** The first of the bands at the key that fulfils a predicate */
+template <typename Predicate>
+std::size_t first_match(
+    const std::unordered_multimap<std::size_t, std::size_t>& pos,
+    std::size_t key,
+    std::size_t n,
+    Predicate&& pred) {
+  std::size_t out = n;
+  auto [first, last] = pos.equal_range(key);
+  for (; first not_eq last; ++first)
+    if (first->second < out and pred(first->second)) out = first->second;
+  return out;
+}
+}  // namespace
+
+BandIndex::BandIndex(const std::vector<Lines>& bands) {
+  pos.reserve(bands.size());
+  for (std::size_t i = 0; i < bands.size(); i++) add(bands[i], i);
+}
+
+std::size_t BandIndex::find(const std::vector<Lines>& bands,
+                            const SingleLineExternal& sle,
+                            const QuantumIdentifier& qid) const {
+  return first_match(
+      pos, band_metadata_hash(sle, qid), bands.size(), [&](std::size_t i) {
+        return bands[i].MatchWithExternal(sle, qid);
+      });
+}
+
+std::size_t BandIndex::find(const std::vector<Lines>& bands,
+                            const Lines& band) const {
+  return first_match(
+      pos, band_metadata_hash(band), bands.size(), [&](std::size_t i) {
+        return bands[i].Match(band).first;
+      });
+}
+
+void BandIndex::add(const Lines& band, std::size_t i) {
+  pos.emplace(band_metadata_hash(band), i);
+}
+
 void Lines::sort_by_frequency() {
   std::sort(
       lines.begin(), lines.end(), [](const SingleLine& a, const SingleLine& b) {
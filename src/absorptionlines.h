@@ -802,6 +802,13 @@ SingleLineExternal ReadFromLBLRTMStream(istream& is);
  */
 SingleLineExternal ReadFromHitran2004Stream(istream& is);
 
+/** Read a single line of a catalog as ReadFromHitran2004Stream
+ * 
+ * @param[in] line A catalog line without its line break
+ * @return SingleLineExternal 
+ */
+SingleLineExternal ReadFromHitran2004Line(std::string_view line);
+
 /** Read from HITRAN online
  * 
  * The data format from online should be a .par line
@@ -817,6 +824,13 @@ SingleLineExternal ReadFromHitran2004Stream(istream& is);
 */ 
 SingleLineExternal ReadFromHitranOnlineStream(istream& is);
 
+/** Read a single line of a catalog as ReadFromHitranOnlineStream
+ * 
+ * @param[in] line A catalog line without its line break
+ * @return SingleLineExternal 
+ */
+SingleLineExternal ReadFromHitranOnlineLine(std::string_view line);
+
 /** Read from HITRAN before 2004
  * 
  * See ReadFromLBLRTMStream for details on format
@@ -826,6 +840,31 @@ SingleLineExternal ReadFromHitranOnlineStream(istream& is);
  */
 SingleLineExternal ReadFromHitran2001Stream(istream& is);
 
+/** Read a single line of a catalog as ReadFromHitran2001Stream
+ * 
+ * @param[in] line A catalog line without its line break
+ * @return SingleLineExternal 
+ */
+SingleLineExternal ReadFromHitran2001Line(std::string_view line);
+
+/** Read all lines of a HITRAN catalog file in parallel
+ * 
+ * The file is memory mapped and split into chunks of whole lines that are
+ * parsed concurrently from the mapping.  The lines are returned in the order
+ * of the file.  As when streaming, reading ends at the first line above fmax,
+ * so that bad lines after it are not errors, and a bad line is reported by
+ * its line number in the file.
+ * 
+ * @param[in] filename The catalog file
+ * @param[in] read_line As ReadFromHitranOnlineLine or one of its siblings
+ * @param[in] fmax The frequency of lines that ends the reading
+ * @return The lines in the file before the first line above fmax
+ */
+std::vector<SingleLineExternal> ReadFromHitranFile(
+    const String& filename,
+    SingleLineExternal (*read_line)(std::string_view),
+    Numeric fmax);
+
 /** Read from JPL
  * 
  *  The JPL format is as follows (directly taken from the JPL documentation):
@@ -872,6 +911,54 @@ SingleLineExternal ReadFromHitran2001Stream(istream& is);
  */
 SingleLineExternal ReadFromJplStream(istream& is);
 
+/** An index of bands by their band-level metadata
+ *
+ * The key is a hash of the global quantum identifier, the broadening species
+ * and the cutoff, mirroring, population, normalization, line shape type and
+ * reference temperature settings.  The few candidates with the same key are
+ * validated by Lines::Match or Lines::MatchWithExternal, so finding the band
+ * of a line does not need a search through all bands
+ */
+class BandIndex {
+  std::unordered_multimap<std::size_t, std::size_t> pos{};
+
+ public:
+  BandIndex() = default;
+
+  /** Index of all bands in a list
+   *
+   * @param[in] bands A list of bands
+   */
+  explicit BandIndex(const std::vector<Lines>& bands);
+
+  /** Position of the first band an external line belongs to
+   *
+   * @param[in] bands The indexed list of bands
+   * @param[in] sle An external line
+   * @param[in] qid The global quantum identifier of the line
+   * @return Position in bands, or bands.size() if no band matches
+   */
+  [[nodiscard]] std::size_t find(const std::vector<Lines>& bands,
+                                 const SingleLineExternal& sle,
+                                 const QuantumIdentifier& qid) const;
+
+  /** Position of the first band that matches another band
+   *
+   * @param[in] bands The indexed list of bands
+   * @param[in] band A band
+   * @return Position in bands, or bands.size() if no band matches
+   */
+  [[nodiscard]] std::size_t find(const std::vector<Lines>& bands,
+                                 const Lines& band) const;
+
+  /** Adds a band to the index
+   *
+   * @param[in] band A band
+   * @param[in] i The position of band in the indexed list
+   */
+  void add(const Lines& band, std::size_t i);
+};
+
 /** Splits a list of lines into proper Lines
  * 
  * Ensures that all but SingleLine list in Lines is the same in a full
@@ -886,6 +973,27 @@ std::vector<Lines> split_list_of_external_lines(std::vector<SingleLineExternal>&
                                                 const std::vector<QuantumNumberType>& localquantas={},
                                                 const std::vector<QuantumNumberType>& globalquantas={});
 
+/** Writes bands to a binary line catalog
+ * 
+ * The file has a short header and then the bands in order.  Each band is
+ * its band-level data followed by the line data as a column per parameter,
+ * so that reading it is a few bulk copies.  The file is native endian and
+ * versioned, it is not an archive format.
+ * 
+ * @param[in] filename The catalog file
+ * @param[in] bands A list of bands
+ */
+void WriteBinaryCatalog(const String& filename, const Array<Lines>& bands);
+
+/** Reads the bands of a binary line catalog
+ * 
+ * See WriteBinaryCatalog.  The file is memory mapped while reading.
+ * 
+ * @param[in] filename The catalog file
+ * @return The bands in the file
+ */
+Array<Lines> ReadBinaryCatalog(const String& filename);
+
 /** Number of lines */
 Index nelem(const Lines& l);
 
@@ -80,6 +80,7 @@ void Agenda::append(const String& methodname, const TokVal& keywordvalue) {
 
   mml.push_back(MRecord(id, output, input, keywordvalue, Agenda(*workspace())));
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Checks consistency of an agenda.
@@ -91,6 +92,7 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
   // Check that this agenda has a default workspace
   if (not workspace().get()) {
     mchecked = false;
+    mcompiled = false;
     return;
   }
 
@@ -114,6 +116,7 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
   // until it is copied to a predefined agenda.
   if (mi == AgendaMap.end()) {
     mchecked = false;
+    mcompiled = false;
     return;
   }
 
@@ -157,9 +160,60 @@ void Agenda::check(Workspace& ws_in, const Verbosity& verbosity) {
 
   set_outputs_to_push_and_dup(verbosity);
 
+  magenda_data_pos = mi->second;
+  compile();
+
   mchecked = true;
 }
 
+//! Prepares a checked agenda for execution.
+/*!
+  Resolves which input variables can be left unchecked by execute because
+  an earlier method of this agenda sets them, and whether any method sets
+  the verbosity.  Methods always mark their output as initialized, but
+  Delete removes its input again.
+*/
+void Agenda::compile() {
+  using global_data::md_data;
+
+  static const Index wsv_id_verbosity = global_data::WsvMap.at("verbosity");
+
+  std::set<Index> initialized;
+  mruntime_input.resize(mml.nelem());
+  msets_verbosity = false;
+  for (Index i = 0; i < mml.nelem(); ++i) {
+    const MRecord& mrr = mml[i];
+    const MdRecord& mdd = md_data[mrr.Id()];
+    ArrayOfIndex& runtime_input = mruntime_input[i];
+    runtime_input.resize(0);
+
+    // The last input of Set methods is their value
+    const ArrayOfIndex& v = mrr.In();
+    for (Index s = 0; s < v.nelem(); ++s)
+      if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
+          not initialized.contains(v[s]))
+        runtime_input.push_back(v[s]);
+
+    for (Index s : mdd.InOut())
+      if (not initialized.contains(mrr.Out()[s]))
+        runtime_input.push_back(mrr.Out()[s]);
+
+    // Delete is supergeneric, so only its name is the same for all groups
+    if (mdd.Name() == "Delete") {
+      for (Index s : v) initialized.erase(s);
+    } else {
+      initialized.insert(mrr.Out().begin(), mrr.Out().end());
+    }
+
+    msets_verbosity = msets_verbosity or
+                      std::find(mrr.Out().begin(),
+                                mrr.Out().end(),
+                                wsv_id_verbosity) not_eq mrr.Out().end();
+  }
+
+  mcompiled = true;
+}
+
 //! Execute an agenda.
 /*! 
   This executes the methods specified in tasklist on the given
@@ -195,27 +249,32 @@ There are three possible causes for this:
   // The array holding the pointers to the getaway functions:
   extern void (*getaways[])(Workspace&, const MRecord&);
 
-  const Index wsv_id_verbosity = ws_in.WsvMap_ptr->at("verbosity");
-  ws_in.duplicate(wsv_id_verbosity);
-
-  Verbosity& averbosity =
-      *(static_cast<Verbosity*>(ws_in[wsv_id_verbosity].get()));
+  static const Index wsv_id_verbosity = global_data::WsvMap.at("verbosity");
+
+  // The verbosity is only duplicated if this agenda changes it
+  const bool dup_verbosity =
+      not mcompiled or msets_verbosity or
+      static_cast<Verbosity*>(ws_in.read(wsv_id_verbosity).get())
+              ->is_main_agenda() not_eq is_main_agenda();
+  if (dup_verbosity) {
+    ws_in.duplicate(wsv_id_verbosity);
+    static_cast<Verbosity*>(ws_in[wsv_id_verbosity].get())
+        ->set_main_agenda(is_main_agenda());
+  }
 
-  averbosity.set_main_agenda(is_main_agenda());
+  // Otherwise it is only read, as it may be shared with other threads
+  const Verbosity& averbosity =
+      *(static_cast<Verbosity*>(ws_in.read(wsv_id_verbosity).get()));
 
   ArtsOut1 aout1(averbosity);
-  {
-    //    ostringstream os;  // disabled for performance reasons
-    //    os << "Executing " << name() << "\n"
-    //       << "{\n";
-    //    aout1 << os.str();
+  if (aout1.sufficient_priority()) {
     aout1 << "Executing " << name() << "\n"
           << "{\n";
   }
 
   for (Index i = 0; i < mml.nelem(); ++i) {
     const Verbosity& verbosity =
-        *static_cast<Verbosity*>(ws_in[wsv_id_verbosity].get());
+        *static_cast<Verbosity*>(ws_in.read(wsv_id_verbosity).get());
     CREATE_OUT1;
     CREATE_OUT3;
 
@@ -225,33 +284,38 @@ There are three possible causes for this:
     const MdRecord& mdd = md_data[mrr.Id()];
 
     try {
-      {
-        if (mrr.isInternal()) {
-          out3 << "- " + mdd.Name() + "\n";
-        } else {
-          out1 << "- " + mdd.Name() + "\n";
-        }
+      // Only build the messages if they are output
+      if (mrr.isInternal()) {
+        if (out3.sufficient_priority()) out3 << "- " + mdd.Name() + "\n";
+      } else {
+        if (out1.sufficient_priority()) out1 << "- " + mdd.Name() + "\n";
       }
 
-      {  // Check if all input variables are initialized:
-        const ArrayOfIndex& v(mrr.In());
-        for (Index s = 0; s < v.nelem(); ++s) {
-          if ((s != v.nelem() - 1 || !mdd.SetMethod()) &&
-              !ws_in.is_initialized(v[s]))
-            throw runtime_error(
-                "Method " + mdd.Name() +
-                " needs input variable: " + (*ws_in.wsv_data_ptr)[v[s]].Name());
+      const auto check_initialized = [&](Index v) {
+        if (!ws_in.is_initialized(v))
+          throw runtime_error("Method " + mdd.Name() +
+                              " needs input variable: " +
+                              (*ws_in.wsv_data_ptr)[v].Name());
+      };
+
+      if (mcompiled) {
+        // Check the input variables that earlier methods do not set
+        for (Index v : mruntime_input[i]) check_initialized(v);
+      } else {
+        {  // Check if all input variables are initialized:
+          const ArrayOfIndex& v(mrr.In());
+          for (Index s = 0; s < v.nelem(); ++s) {
+            if (s != v.nelem() - 1 || !mdd.SetMethod())
+              check_initialized(v[s]);
+          }
         }
-      }
 
-      {  // Check if all output variables which are also used as input
-        // are initialized
-        const ArrayOfIndex& v = mdd.InOut();
-        for (Index s = 0; s < v.nelem(); ++s)
-          if (!ws_in.is_initialized(mrr.Out()[v[s]]))
-            throw runtime_error("Method " + mdd.Name() +
-                                " needs input variable: " +
-                                (*ws_in.wsv_data_ptr)[mrr.Out()[v[s]]].Name());
+        {  // Check if all output variables which are also used as input
+          // are initialized
+          const ArrayOfIndex& v = mdd.InOut();
+          for (Index s = 0; s < v.nelem(); ++s)
+            check_initialized(mrr.Out()[v[s]]);
+        }
       }
 
       // Call the getaway function:
@@ -279,7 +343,12 @@ There are three possible causes for this:
 
   aout1 << "}\n";
 
-  ws_in.pop(wsv_id_verbosity);
+  if (dup_verbosity) ws_in.pop(wsv_id_verbosity);
+}
+
+Index Agenda::agenda_data_pos() const {
+  if (magenda_data_pos >= 0) return magenda_data_pos;
+  return global_data::AgendaMap.find(mname)->second;
 }
 
 //! Retrieve indexes of all input and output WSVs
@@ -665,6 +734,7 @@ bool Agenda::is_output(Index var) const {
 void Agenda::set_name(const String& nname) {
   mname = nname;
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Agenda name.
@@ -703,6 +773,7 @@ bool Agenda::has_method(const String& methodname) const {
 void Agenda::set_methods(const Array<MRecord>& ml) {
   mml = ml;
   mchecked = false;
+  mcompiled = false;
 }
 
 //! Print an agenda.
@@ -727,7 +798,10 @@ void Agenda::print(ostream& os, const String& indent) const {
 /*!
   Resizes the agenda's method list to n elements
  */
-void Agenda::resize(Index n) { mml.resize(n); }
+void Agenda::resize(Index n) {
+  mml.resize(n);
+  mcompiled = false;
+}
 
 //! Return the number of agenda elements.
 /*!  
@@ -747,6 +821,7 @@ Index Agenda::nelem() const { return mml.nelem(); }
 void Agenda::push_back(const MRecord& n) {
   mml.push_back(n);
   mchecked = false;
+  mcompiled = false;
 }
 
 Agenda& Agenda::operator=(const Agenda& x) {
@@ -756,6 +831,10 @@ Agenda& Agenda::operator=(const Agenda& x) {
   moutput_push = x.moutput_push;
   moutput_dup = x.moutput_dup;
   mchecked = x.mchecked;
+  magenda_data_pos = x.magenda_data_pos;
+  mcompiled = x.mcompiled;
+  mruntime_input = x.mruntime_input;
+  msets_verbosity = x.msets_verbosity;
   return *this;
 }
 
@@ -940,6 +1019,7 @@ Agenda Agenda::deepcopy_if(Workspace& workspace) const {
   out.moutput_dup = make_same_wsvs(workspace, *this->workspace(), moutput_dup);
   out.main_agenda = main_agenda;
   out.mchecked = mchecked;
+  out.magenda_data_pos = magenda_data_pos;
 
   return out;
 }
@@ -83,6 +83,10 @@ class Agenda final {
   }
   [[nodiscard]] bool is_main_agenda() const { return main_agenda; }
   [[nodiscard]] bool checked() const { return mchecked; }
+  [[nodiscard]] bool compiled() const { return mcompiled; }
+
+  //! Position of this agenda in global_data::agenda_data
+  [[nodiscard]] Index agenda_data_pos() const;
 
   friend ostream& operator<<(ostream& os, const Agenda& a);
 
@@ -112,6 +116,21 @@ class Agenda final {
 
   /** Flag indicating that the agenda was checked for consistency */
   bool mchecked{false};
+
+  /** Position in global_data::agenda_data, set by check */
+  Index magenda_data_pos{-1};
+
+  /** Flag indicating that check has compiled the agenda for execution */
+  bool mcompiled{false};
+
+  /** Per method, the input variables that are not certainly initialized by
+      earlier methods of this agenda, and so must be checked on execution */
+  Array<ArrayOfIndex> mruntime_input{};
+
+  /** Flag indicating that some method of the agenda sets verbosity */
+  bool msets_verbosity{true};
+
+  void compile();
 };
 
 /** Method runtime data. In contrast to MdRecord, an object of this
@@ -15,11 +15,23 @@
 
 #include "arts.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 using namespace std;
 
 #include "arts_omp.h"
 
+namespace {
+//! Threads handed to the regions nested at a level by ArtsOmpInnerThreads
+struct NestedThreads {
+  int level{-1};
+  int threads{1};
+};
+
+thread_local NestedThreads nested_threads;
+}  // namespace
+
 //! Wrapper for omp_get_max_threads.
 /*! 
   This wrapper works with and without OMP support.
@@ -121,3 +133,64 @@ void arts_omp_set_dynamic(int i _U_)
   // Nothing to do here.
 #endif
 }
+
+//! Number of threads a parallel region started here may use
+/*!
+  This wrapper works with and without OMP support.
+
+  \return The maximum number of threads outside of parallel regions.
+  Inside a parallel region, the threads handed to this level by an
+  ArtsOmpInnerThreads object, or 1 if there are none.
+*/
+int arts_omp_get_available_threads() {
+#ifdef _OPENMP
+  if (not omp_in_parallel()) return omp_get_max_threads();
+  if (nested_threads.level == omp_get_level()) return nested_threads.threads;
+#endif
+  return 1;
+}
+
+ArtsOmpNestedLoop::ArtsOmpNestedLoop(long long n)
+    : nouter(1), ninner(1), nextra(0), max_active_levels(-1) {
+  const int navailable = arts_omp_get_available_threads();
+  nouter = int(std::clamp<long long>(n, 1, navailable));
+
+#ifdef _OPENMP
+  // The outermost loop enables nesting, and the loops inside it may only
+  // hand on threads if the nesting reaches that deep
+  if (not omp_in_parallel() and navailable > nouter) {
+    max_active_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(std::numeric_limits<int>::max());
+  }
+  if (omp_get_max_active_levels() <= omp_get_active_level() + 1) return;
+#endif
+
+  ninner = navailable / nouter;
+  nextra = navailable % nouter;
+}
+
+ArtsOmpNestedLoop::~ArtsOmpNestedLoop() {
+#ifdef _OPENMP
+  if (max_active_levels >= 0) omp_set_max_active_levels(max_active_levels);
+#endif
+}
+
+ArtsOmpInnerThreads::ArtsOmpInnerThreads(const ArtsOmpNestedLoop& loop)
+    : level(nested_threads.level),
+      threads(nested_threads.threads),
+      max_threads(arts_omp_get_max_threads()) {
+  const int ninner = loop.inner_threads(arts_omp_get_thread_num());
+#ifdef _OPENMP
+  nested_threads = {omp_get_level(), ninner};
+  omp_set_num_threads(ninner);
+#else
+  nested_threads = {0, ninner};
+#endif
+}
+
+ArtsOmpInnerThreads::~ArtsOmpInnerThreads() {
+  nested_threads = {level, threads};
+#ifdef _OPENMP
+  omp_set_num_threads(max_threads);
+#endif
+}
@@ -33,4 +33,62 @@ void arts_omp_set_nested(int i);
 
 void arts_omp_set_dynamic(int i);
 
+int arts_omp_get_available_threads();
+
+//! Splits the available threads between a loop and the regions nested in it
+/*!
+  The loop gets one thread per iteration, up to the number of available
+  threads.  The remaining threads are shared between the loop threads, and
+  are handed to the parallel regions nested inside an iteration by an
+  ArtsOmpInnerThreads object.  This way a loop with few iterations still
+  keeps all threads busy, if the work inside the iterations is parallel.
+
+  The loop must be run with threads() threads and static scheduling:
+
+  \code
+  const ArtsOmpNestedLoop loop{n};
+  #pragma omp parallel for num_threads(loop.threads()) if (loop.threads() > 1)
+  for (Index i = 0; i < n; i++) {
+    const ArtsOmpInnerThreads inner{loop};
+    ...
+  }
+  \endcode
+
+  Nested parallel execution is enabled while the outermost such loop is
+  alive.
+*/
+class ArtsOmpNestedLoop {
+  int nouter;
+  int ninner;
+  int nextra;
+  int max_active_levels;
+
+ public:
+  explicit ArtsOmpNestedLoop(long long n);
+  ArtsOmpNestedLoop(const ArtsOmpNestedLoop&) = delete;
+  ArtsOmpNestedLoop& operator=(const ArtsOmpNestedLoop&) = delete;
+  ~ArtsOmpNestedLoop();
+
+  //! Number of threads for the loop itself
+  [[nodiscard]] int threads() const { return nouter; }
+
+  //! Number of threads for the regions nested in loop thread ithread
+  [[nodiscard]] int inner_threads(int ithread) const {
+    return ninner + (ithread < nextra);
+  }
+};
+
+//! Hands the share of the calling loop thread to the regions nested in it
+class ArtsOmpInnerThreads {
+  int level;
+  int threads;
+  int max_threads;
+
+ public:
+  explicit ArtsOmpInnerThreads(const ArtsOmpNestedLoop& loop);
+  ArtsOmpInnerThreads(const ArtsOmpInnerThreads&) = delete;
+  ArtsOmpInnerThreads& operator=(const ArtsOmpInnerThreads&) = delete;
+  ~ArtsOmpInnerThreads();
+};
+
 #endif  // arts_omp_h
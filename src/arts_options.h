@@ -34,9 +34,24 @@ ENUMCLASS(
     Online  // Onine expects a modern .par line followed by Upper then Lower quantum numbers
 )
 
+/** Possible ways of reading HITRAN catalogs */
+ENUMCLASS(HitranReading, char, Stream, Parallel)
+
 /** Possible AddLines Speedups */
 ENUMCLASS(LblSpeedup, char, None, QuadraticIndependent, LinearIndependent)
 
+/** Possible AddLines parallelization schemes */
+ENUMCLASS(LblParallel, char, Bands, FrequencyBlocks)
+
+/** Possible AddLines Faddeeva function algorithms */
+ENUMCLASS(LblFaddeeva, char, Reference, Weideman)
+
+/** Possible storage precisions of the cross sections of a lookup table */
+ENUMCLASS(LookupStorage, char, Double, Float)
+
+/** Possible solvers of the DOIT iteration */
+ENUMCLASS(DoitSolver, char, SourceIteration, GMRES, BiCGSTAB)
+
 ENUMCLASS(SortingOption, char, ByFrequency, ByEinstein)
 
 /** Options for setting iy_main_agenda */
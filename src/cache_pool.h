@@ -0,0 +1,108 @@
+/*!
+  \file   cache_pool.h
+
+  \brief  Caches that are kept for the duration of a calculation
+
+  A cache that is kept between the calls of a method must not outlive the
+  data it was made from, and must not grow for as long as the process runs.
+  Instead of keeping such caches per thread, a CachePool keeps them while a
+  calculation, e.g. a batch, is running:
+
+  \code
+  void ybatchCalc(...) {
+    const CachePool<MyCache>::Scope scope;
+    ... // Runs the agendas
+  }
+
+  void propmat_method(...) {
+    CachePool<MyCache>::Lease cache;
+    cache->...
+  }
+  \endcode
+
+  A lease hands its cache to a single borrower, so the cache needs no lock.
+  When the lease ends, the cache goes back to the pool and can be borrowed
+  by the next call, on any thread.  All caches are destroyed when the
+  outermost scope ends.  Without a scope, a lease borrows an empty cache
+  that is destroyed with the lease.
+*/
+
+#ifndef cache_pool_h
+#define cache_pool_h
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "matpack_concepts.h"
+
+template <typename Cache>
+class CachePool {
+  inline static std::mutex mtx{};
+
+  //! The number of scopes alive
+  inline static Index nscopes{0};
+
+  //! Counts the times the last scope has ended
+  inline static Index generation{0};
+
+  //! The caches that are not borrowed
+  inline static std::vector<std::unique_ptr<Cache>> caches{};
+
+ public:
+  //! Keeps the caches of the pool while alive
+  class Scope {
+   public:
+    Scope() {
+      const std::lock_guard lock{mtx};
+      nscopes++;
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope() {
+      std::vector<std::unique_ptr<Cache>> old;
+      {
+        const std::lock_guard lock{mtx};
+        if (--nscopes) return;
+        generation++;
+        old.swap(caches);
+      }
+    }
+  };
+
+  //! Borrows a cache of the pool while alive
+  class Lease {
+    std::unique_ptr<Cache> cache;
+    Index borrowed_generation;
+    bool scoped;
+
+   public:
+    Lease() {
+      const std::lock_guard lock{mtx};
+      borrowed_generation = generation;
+      scoped = nscopes > 0;
+      if (scoped and caches.size()) {
+        cache = std::move(caches.back());
+        caches.pop_back();
+      } else {
+        cache = std::make_unique<Cache>();
+      }
+    }
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    ~Lease() {
+      const std::lock_guard lock{mtx};
+      if (scoped and nscopes and borrowed_generation == generation)
+        caches.push_back(std::move(cache));
+    }
+
+    Cache& operator*() const { return *cache; }
+    Cache* operator->() const { return cache.get(); }
+  };
+};
+
+#endif  // cache_pool_h
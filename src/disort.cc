@@ -10,15 +10,19 @@
 
 #include "disort.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "agenda_class.h"
 #include "array.h"
 #include "arts_constants.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "arts_conversions.h"
@@ -795,7 +799,7 @@ thread_local Verbosity disort_verbosity;
 void c_errmsg(const char* messag, int type) {
   #if not ARTS_LGPL
   Verbosity verbosity = disort_verbosity;
-  static int warning_limit = FALSE, num_warnings = 0;
+  static thread_local int warning_limit = FALSE, num_warnings = 0;
 
   ARTS_USER_ERROR_IF(type == DS_ERROR, "DISORT ERROR >>>  ", messag);
 
@@ -824,7 +828,7 @@ void c_errmsg(const char* messag, int type) {
 int c_write_bad_var(int quiet, const char* varnam) {
   #if not ARTS_LGPL
   const int maxmsg = 50;
-  static int nummsg = 0;
+  static thread_local int nummsg = 0;
 
   nummsg++;
   if (quiet != QUIET) {
@@ -931,6 +935,49 @@ void reduced_1datm(Vector& p,
   }
 }
 
+#if not ARTS_LGPL
+namespace {
+/** The disort_state and disort_output of one thread
+
+    The arrays are allocated for the sizes of the given state, and its
+    azimuth angles, polar angles and temperatures are copied, as they do not
+    change with frequency. Each thread can then call c_disort with its own
+    state.
+ */
+struct DisortThreadState {
+  disort_state ds;
+  disort_output out;
+
+  explicit DisortThreadState(const disort_state& shared) : ds(shared) {
+    c_disort_state_alloc(&ds);
+    c_disort_out_alloc(&ds, &out);
+    std::copy_n(shared.phi, shared.nphi, ds.phi);
+    if (shared.flag.usrang == TRUE and shared.flag.onlyfl == FALSE)
+      std::copy_n(shared.umu, shared.numu, ds.umu);
+    if (shared.flag.planck == TRUE)
+      std::copy_n(shared.temper, shared.nlyr + 1, ds.temper);
+  }
+
+  DisortThreadState(const DisortThreadState&) = delete;
+  DisortThreadState& operator=(const DisortThreadState&) = delete;
+
+  ~DisortThreadState() {
+    c_disort_out_free(&ds, &out);
+    c_disort_state_free(&ds);
+  }
+};
+
+//! One state for each thread of loop
+std::vector<std::unique_ptr<DisortThreadState>> disort_thread_states(
+    const disort_state& shared, const ArtsOmpNestedLoop& loop) {
+  std::vector<std::unique_ptr<DisortThreadState>> states;
+  for (int i = 0; i < loop.threads(); i++)
+    states.push_back(std::make_unique<DisortThreadState>(shared));
+  return states;
+}
+}  // namespace
+#endif
+
 void run_cdisort(Workspace& ws,
                  Tensor7& cloudbox_field,
                  ArrayOfMatrix& disort_aux,
@@ -985,7 +1032,6 @@ void run_cdisort(Workspace& ws,
 
   #if not ARTS_LGPL
   disort_state ds;
-  disort_output out;
 
   if (quiet == 0)
     disort_verbosity = verbosity;
@@ -1059,7 +1105,6 @@ void run_cdisort(Workspace& ws,
 
   /* Allocate memory */
   c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
 
   // Looking direction of solar beam
   ds.bc.umu0 = umu0;
@@ -1188,85 +1233,121 @@ void run_cdisort(Workspace& ws,
   ds.bc.btemp = surface_skin_t;
   ds.bc.temis = 1.;
 
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-    snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
-
-    std::memcpy(ds.dtauc,
-                dtauc(f_index, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-    std::memcpy(ds.ssalb,
-                ssalb(f_index, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-
-    // Wavenumber in [1/cm]
-    ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
-    ds.wvnmhi += ds.wvnmhi * 1e-7;
-    ds.wvnmlo -= ds.wvnmlo * 1e-7;
-
-    // set
-    ds.bc.albedo = surface_scalar_reflectivity[f_index];
-
-    // Set irradiance of incident solar beam at top boundary
-    if (suns_do) {
-      fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
-              (100 * SPEED_OF_LIGHT)*scale_factor;
-    }
-    ds.bc.fbeam = fbeam;
-
-    std::memcpy(ds.pmom,
-                pmom(f_index, joker, joker).unsafe_data_handle(),
-                sizeof(Numeric) * pmom.nrows() * pmom.ncols());
-
-    enum class Status { FIRST_TRY, RETRY, SUCCESS };
-    Status tries = Status::FIRST_TRY;
-    const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
-    do {
-      try {
-        c_disort(&ds, &out);
-        tries = Status::SUCCESS;
-      } catch (const std::runtime_error& e) {
-        //catch cases if solar zenith angle=quadrature angle
-        if (tries == Status::FIRST_TRY) {
-          // change angle
-          if (umu0 < 1 - eps) {
-            umu0 += eps;
-          } else if (umu0 > 1 - eps) {
-            umu0 -= eps;
-          }
-
-          const Numeric shift =
-              abs(Conversion::acosd(umu0) - Conversion::acosd(ds.bc.umu0));
-          CREATE_OUT1;
-          out1
-              << "Solar zenith angle coincided with one of the quadrature angles\n"
-              << "We needed to shift the solar sun angle by " << shift
-              << "deg.\n";
-
-          ds.bc.umu0 = umu0;
-          tries = Status::RETRY;
-        } else
-          throw e;
-      }
-    } while (tries != Status::SUCCESS);
-
-    for (Index i = 0; i < ds.nphi; i++) {
-      for (Index j = 0; j < ds.numu; j++) {
-        for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-          cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
-              out.uu[j + ((ds.nlyr - k - cboxlims[0]) + i * (ds.nlyr + 1)) *
-                             ds.numu] /
-              (ds.wvnmhi - ds.wvnmlo) / (100 * SPEED_OF_LIGHT);
+  // c_disort changes the arrays of its state for each frequency, so each
+  // thread of the frequency loop has its own state
+  const ArtsOmpNestedLoop f_loop{nf};
+  const auto states = disort_thread_states(ds, f_loop);
+  const Verbosity thread_verbosity = disort_verbosity;
+
+  // If the sun coincides with a quadrature angle, it does so for all
+  // frequencies, and it is shifted by the same angle for all of them
+  const Numeric eps = 2e-4; //two times the value defined in cdisort.c:3653
+  const Numeric umu0_shifted = umu0 < 1 - eps   ? umu0 + eps
+                               : umu0 > 1 - eps ? umu0 - eps
+                                                : umu0;
+  bool sun_shifted = false;
+
+  bool failed = false;
+  String fail_msg;
+
+#pragma omp parallel for num_threads(f_loop.threads()) \
+    if (f_loop.threads() > 1) schedule(dynamic) reduction(|| : sun_shifted)
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    if (failed) continue;
+
+    const ArtsOmpInnerThreads inner_threads{f_loop};
+    disort_verbosity = thread_verbosity;
+    auto& state = *states[arts_omp_get_thread_num()];
+    disort_state& ds_f = state.ds;
+    disort_output& out = state.out;
+
+    try {
+      snprintf(ds_f.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+
+      std::memcpy(ds_f.dtauc,
+                  dtauc(f_index, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds_f.nlyr);
+      std::memcpy(ds_f.ssalb,
+                  ssalb(f_index, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds_f.nlyr);
+
+      // Wavenumber in [1/cm]
+      ds_f.wvnmhi = ds_f.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
+      ds_f.wvnmhi += ds_f.wvnmhi * 1e-7;
+      ds_f.wvnmlo -= ds_f.wvnmlo * 1e-7;
+
+      // set
+      ds_f.bc.albedo = surface_scalar_reflectivity[f_index];
+
+      // Set irradiance of incident solar beam at top boundary
+      ds_f.bc.fbeam = suns_do ? suns[0].spectrum(f_index, 0) *
+                                    (ds_f.wvnmhi - ds_f.wvnmlo) *
+                                    (100 * SPEED_OF_LIGHT) * scale_factor
+                              : fbeam;
+
+      std::memcpy(ds_f.pmom,
+                  pmom(f_index, joker, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+
+      enum class Status { FIRST_TRY, RETRY, SUCCESS };
+      Status tries = Status::FIRST_TRY;
+      do {
+        try {
+          c_disort(&ds_f, &out);
+          tries = Status::SUCCESS;
+        } catch (const std::runtime_error& e) {
+          //catch cases if solar zenith angle=quadrature angle
+          if (tries == Status::FIRST_TRY and ds_f.bc.umu0 != umu0_shifted) {
+            // change angle
+            const Numeric shift = abs(Conversion::acosd(umu0_shifted) -
+                                      Conversion::acosd(ds_f.bc.umu0));
+            CREATE_OUT1;
+            out1
+                << "Solar zenith angle coincided with one of the quadrature angles\n"
+                << "We needed to shift the solar sun angle by " << shift
+                << "deg.\n";
+
+            ds_f.bc.umu0 = umu0_shifted;
+            sun_shifted = true;
+            tries = Status::RETRY;
+          } else
+            throw;
         }
-        // To avoid potential numerical problems at interpolation of the field,
-        // we copy the surface field to underground altitudes
-        for (Index k = ncboxremoved - 1; k >= 0; k--) {
-          cloudbox_field(f_index, k, 0, 0, j, i, 0) =
-              cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+      } while (tries != Status::SUCCESS);
+
+      for (Index i = 0; i < ds_f.nphi; i++) {
+        for (Index j = 0; j < ds_f.numu; j++) {
+          for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+            cloudbox_field(f_index, k + ncboxremoved, 0, 0, j, i, 0) =
+                out.uu[j + ((ds_f.nlyr - k - cboxlims[0]) +
+                            i * (ds_f.nlyr + 1)) *
+                               ds_f.numu] /
+                (ds_f.wvnmhi - ds_f.wvnmlo) / (100 * SPEED_OF_LIGHT);
+          }
+          // To avoid potential numerical problems at interpolation of the field,
+          // we copy the surface field to underground altitudes
+          for (Index k = ncboxremoved - 1; k >= 0; k--) {
+            cloudbox_field(f_index, k, 0, 0, j, i, 0) =
+                cloudbox_field(f_index, k + 1, 0, 0, j, i, 0);
+          }
         }
       }
+    } catch (const std::exception& e) {
+      ostringstream os;
+      os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
+         << " Hz)\n"
+         << e.what();
+#pragma omp critical(run_cdisort_fail)
+      {
+        failed = true;
+        fail_msg = os.str();
+      }
     }
   }
 
+  ARTS_USER_ERROR_IF(failed, fail_msg)
+  if (sun_shifted) umu0 = umu0_shifted;
+
   // Allocate aux data
   disort_aux.resize(disort_aux_vars.nelem());
   // Allocate and set (if possible here) iy_aux
@@ -1323,7 +1404,6 @@ void run_cdisort(Workspace& ws,
   }
 
   /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
   c_disort_state_free(&ds);
 
   #else
@@ -1384,7 +1464,6 @@ void run_cdisort_flux(Workspace& ws,
 #if not ARTS_LGPL
 
   disort_state ds;
-  disort_output out;
 
   if (quiet == 0)
     disort_verbosity = verbosity;
@@ -1458,7 +1537,6 @@ void run_cdisort_flux(Workspace& ws,
 
   /* Allocate memory */
   c_disort_state_alloc(&ds);
-  c_disort_out_alloc(&ds, &out);
 
   // Looking direction of solar beam
   ds.bc.umu0 = umu0;
@@ -1593,87 +1671,119 @@ void run_cdisort_flux(Workspace& ws,
     spectral_direct_irradiance_field = 0;
   }
 
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-    snprintf(ds.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
-
-    std::memcpy(ds.dtauc,
-                dtauc(f_index, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-    std::memcpy(ds.ssalb,
-                ssalb(f_index, joker).unsafe_data_handle(),
-                sizeof(Numeric) * ds.nlyr);
-
-    // Wavenumber in [1/cm]
-    ds.wvnmhi = ds.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
-    ds.wvnmhi += ds.wvnmhi * 1e-7;
-    ds.wvnmlo -= ds.wvnmlo * 1e-7;
-
-    // set
-    ds.bc.albedo = surface_scalar_reflectivity[f_index];
-
-    // Set irradiance of incident solar beam at top boundary
-    if (suns_do) {
-      fbeam = suns[0].spectrum(f_index, 0)*(ds.wvnmhi - ds.wvnmlo)*
-              (100 * SPEED_OF_LIGHT)*scale_factor;
-    }
-    ds.bc.fbeam = fbeam;
-
-    std::memcpy(ds.pmom,
-                pmom(f_index, joker, joker).unsafe_data_handle(),
-                sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+  // c_disort changes the arrays of its state for each frequency, so each
+  // thread of the frequency loop has its own state
+  const ArtsOmpNestedLoop f_loop{nf};
+  const auto states = disort_thread_states(ds, f_loop);
+  const Verbosity thread_verbosity = disort_verbosity;
 
-    c_disort(&ds, &out);
+  bool failed = false;
+  String fail_msg;
 
-    //factor for converting it into spectral radiance units
-    const Numeric conv_fac=(ds.wvnmhi - ds.wvnmlo) * (100 * SPEED_OF_LIGHT);
+#pragma omp parallel for num_threads(f_loop.threads()) \
+    if (f_loop.threads() > 1) schedule(dynamic)
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    if (failed) continue;
+
+    const ArtsOmpInnerThreads inner_threads{f_loop};
+    disort_verbosity = thread_verbosity;
+    auto& state = *states[arts_omp_get_thread_num()];
+    disort_state& ds_f = state.ds;
+    disort_output& out = state.out;
+
+    try {
+      snprintf(ds_f.header, 128, "ARTS Calc f_index = %" PRId64, f_index);
+
+      std::memcpy(ds_f.dtauc,
+                  dtauc(f_index, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds_f.nlyr);
+      std::memcpy(ds_f.ssalb,
+                  ssalb(f_index, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * ds_f.nlyr);
+
+      // Wavenumber in [1/cm]
+      ds_f.wvnmhi = ds_f.wvnmlo = (f_grid[f_index]) / (100. * SPEED_OF_LIGHT);
+      ds_f.wvnmhi += ds_f.wvnmhi * 1e-7;
+      ds_f.wvnmlo -= ds_f.wvnmlo * 1e-7;
+
+      // set
+      ds_f.bc.albedo = surface_scalar_reflectivity[f_index];
+
+      // Set irradiance of incident solar beam at top boundary
+      ds_f.bc.fbeam = suns_do ? suns[0].spectrum(f_index, 0) *
+                                    (ds_f.wvnmhi - ds_f.wvnmlo) *
+                                    (100 * SPEED_OF_LIGHT) * scale_factor
+                              : fbeam;
+
+      std::memcpy(ds_f.pmom,
+                  pmom(f_index, joker, joker).unsafe_data_handle(),
+                  sizeof(Numeric) * pmom.nrows() * pmom.ncols());
+
+      c_disort(&ds_f, &out);
+
+      //factor for converting it into spectral radiance units
+      const Numeric conv_fac=(ds_f.wvnmhi - ds_f.wvnmlo) * (100 * SPEED_OF_LIGHT);
+
+      for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+        if (suns_do){
+          // downward direct flux
+          spectral_direct_irradiance_field(f_index, k + ncboxremoved) =
+              -out.rad[ds_f.nlyr - k - cboxlims[0]].rfldir/conv_fac;
+
+          // downward total flux
+          spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 0) =
+              -(out.rad[ds_f.nlyr - k - cboxlims[0]].rfldir +
+              out.rad[ds_f.nlyr - k - cboxlims[0]].rfldn)/conv_fac;
+
+        } else {
+          // downward total flux
+          spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 0) =
+              -out.rad[ds_f.nlyr - k - cboxlims[0]].rfldn/conv_fac;
+        }
 
-    for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-      if (suns_do){
-        // downward direct flux
-        spectral_direct_irradiance_field(f_index, k + ncboxremoved) =
-            -out.rad[ds.nlyr - k - cboxlims[0]].rfldir/conv_fac;
+        // upward flux
+        spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 1) =
+            out.rad[ds_f.nlyr - k - cboxlims[0]].flup/conv_fac;
 
-        // downward total flux
-        spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 0) =
-            -(out.rad[ds.nlyr - k - cboxlims[0]].rfldir +
-            out.rad[ds.nlyr - k - cboxlims[0]].rfldn)/conv_fac;
+        // flux divergence in tau space
+        dFdtau(f_index, k + ncboxremoved) =
+             -out.rad[ds_f.nlyr - k - cboxlims[0]].dfdt;
 
-      } else {
-        // downward total flux
-        spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 0) =
-            -out.rad[ds.nlyr - k - cboxlims[0]].rfldn/conv_fac;
+        // k is running over the number of levels but deltatau, ssalb is defined for layers,
+        // therefore we need to exlude k==0 and remove one from the index.
+        if (k>0){
+          deltatau(f_index, k - 1 + ncboxremoved) = ds_f.dtauc[ds_f.nlyr - k - 1 - cboxlims[0]];
+          snglsctalbedo(f_index, k - 1 + ncboxremoved) = ds_f.ssalb[ds_f.nlyr - k - 1 - cboxlims[0]];
+        }
       }
 
-      // upward flux
-      spectral_irradiance_field(f_index, k + ncboxremoved, 0, 0, 1) =
-          out.rad[ds.nlyr - k - cboxlims[0]].flup/conv_fac;
+      // To avoid potential numerical problems at interpolation of the field,
+      // we copy the surface field to underground altitudes
+      for (Index k = ncboxremoved - 1; k >= 0; k--) {
+        spectral_irradiance_field(f_index, k, 0, 0, joker) =
+            spectral_irradiance_field(f_index, k + 1, 0, 0, joker);
 
-      // flux divergence in tau space
-      dFdtau(f_index, k + ncboxremoved) =
-           -out.rad[ds.nlyr - k - cboxlims[0]].dfdt;
-
-      // k is running over the number of levels but deltatau, ssalb is defined for layers,
-      // therefore we need to exlude k==0 and remove one from the index.
-      if (k>0){
-        deltatau(f_index, k - 1 + ncboxremoved) = ds.dtauc[ds.nlyr - k - 1 - cboxlims[0]];
-        snglsctalbedo(f_index, k - 1 + ncboxremoved) = ds.ssalb[ds.nlyr - k - 1 - cboxlims[0]];
+        if (suns_do) {
+          spectral_direct_irradiance_field(f_index, k) =
+              spectral_direct_irradiance_field(f_index, k + 1);
+        }
+        dFdtau(f_index, k) = dFdtau(f_index, k + 1);
       }
-    }
-
-    // To avoid potential numerical problems at interpolation of the field,
-    // we copy the surface field to underground altitudes
-    for (Index k = ncboxremoved - 1; k >= 0; k--) {
-      spectral_irradiance_field(f_index, k, 0, 0, joker) =
-          spectral_irradiance_field(f_index, k + 1, 0, 0, joker);
-
-      if (suns_do) {
-        spectral_direct_irradiance_field(f_index, k) =
-            spectral_direct_irradiance_field(f_index, k + 1);
+    } catch (const std::exception& e) {
+      ostringstream os;
+      os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
+         << " Hz)\n"
+         << e.what();
+#pragma omp critical(run_cdisort_flux_fail)
+      {
+        failed = true;
+        fail_msg = os.str();
       }
-      dFdtau(f_index, k) = dFdtau(f_index, k + 1);
     }
   }
 
+  ARTS_USER_ERROR_IF(failed, fail_msg)
+
   // Allocate aux data
   disort_aux.resize(disort_aux_vars.nelem());
   // Allocate and set (if possible here) iy_aux
@@ -1711,7 +1821,6 @@ void run_cdisort_flux(Workspace& ws,
 
 
   /* Free allocated memory */
-  c_disort_out_free(&ds, &out);
   c_disort_state_free(&ds);
 
   #else
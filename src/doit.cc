@@ -13,6 +13,8 @@
   ===========================================================================*/
 
 #include "doit.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -40,6 +42,7 @@
 
 inline constexpr Numeric PI=Constant::pi;
 inline constexpr Numeric RAD2DEG=Conversion::rad2deg(1);
+inline constexpr Numeric DEG2RAD=Conversion::deg2rad(1);
 
 //FIXME function name of 'rte_step_doit_replacement' should be replaced by
 //proper name
@@ -2082,3 +2085,231 @@ void doit_scat_fieldNormalize(Workspace& ws,
   else
     out2 << os.str();
 }
+
+void doit_scat_field_weights(Matrix& weights,
+                             ConstVectorView za_grid,
+                             ConstVectorView aa_grid) {
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+
+  // Trapezoidal weights, half the grid steps around each point
+  const auto trapz = [](ConstVectorView grid, Index i) {
+    const Index n = grid.nelem();
+    Numeric w = 0;
+    if (i > 0) w += grid[i] - grid[i - 1];
+    if (i < n - 1) w += grid[i + 1] - grid[i];
+    return 0.5 * DEG2RAD * w;
+  };
+
+  weights.resize(nza, naa);
+  for (Index i = 0; i < nza; i++) {
+    const Numeric w_za = trapz(za_grid, i) * sin(DEG2RAD * za_grid[i]);
+    for (Index j = 0; j < naa; j++)
+      weights(i, j) = naa > 1 ? w_za * trapz(aa_grid, j) : w_za;
+  }
+}
+
+void doit_scat_field_1D(MatrixView scat_field,
+                        ConstTensor5View pha_mat,
+                        ConstMatrixView field,
+                        ConstMatrixView weights) {
+  const Index nza_out = pha_mat.nshelves();
+  const Index nza = weights.nrows();
+  const Index naa = weights.ncols();
+  const Index stokes_dim = field.ncols();
+  ARTS_ASSERT(pha_mat.nbooks() == nza and pha_mat.npages() == naa)
+  ARTS_ASSERT(is_size(scat_field, nza_out, stokes_dim))
+
+  // The incoming field times the weights, in the order of pha_mat
+  Tensor3 weighted_field(nza, naa, stokes_dim);
+  for (Index i = 0; i < nza; i++)
+    for (Index j = 0; j < naa; j++)
+      for (Index k = 0; k < stokes_dim; k++)
+        weighted_field(i, j, k) = weights(i, j) * field(i, k);
+
+  for (Index za_out = 0; za_out < nza_out; za_out++) {
+    std::array<Numeric, 4> sum{0, 0, 0, 0};
+    for (Index i = 0; i < nza; i++)
+      for (Index j = 0; j < naa; j++)
+        for (Index k = 0; k < stokes_dim; k++)
+          for (Index l = 0; l < stokes_dim; l++)
+            sum[k] += pha_mat(za_out, i, j, k, l) * weighted_field(i, j, l);
+
+    for (Index k = 0; k < stokes_dim; k++) scat_field(za_out, k) = sum[k];
+  }
+}
+
+namespace {
+//! Sets r to b - A x and returns the number of products with A
+/*!
+  A zero start guess gives r = b without a product with A.
+*/
+Index doit_residual(
+    VectorView r,
+    ConstVectorView x,
+    ConstVectorView b,
+    const std::function<void(VectorView, ConstVectorView)>& apply) {
+  if (std::all_of(x.begin(), x.end(), [](Numeric v) { return v == 0; })) {
+    r = b;
+    return 0;
+  }
+
+  apply(r, x);
+  for (Index i = 0; i < r.nelem(); i++) r[i] = b[i] - r[i];
+  return 1;
+}
+
+Index doit_gmres(VectorView x,
+                 ConstVectorView b,
+                 const std::function<void(VectorView, ConstVectorView)>& apply,
+                 Index restart,
+                 Numeric tolerance,
+                 Index max_apply) {
+  const Index n = x.nelem();
+  const Numeric bnorm = std::sqrt(b * b);
+
+  Matrix V(restart + 1, n);
+  Matrix H(restart + 1, restart);
+  Vector cs(restart), sn(restart), g(restart + 1), y(restart);
+  Vector w(n);
+
+  Index napply = 0;
+  while (napply < max_apply) {
+    napply += doit_residual(w, x, b, apply);
+    const Numeric beta = std::sqrt(w * w);
+    if (beta <= tolerance * bnorm) break;
+
+    V(0, joker) = w;
+    V(0, joker) /= beta;
+    g = 0;
+    g[0] = beta;
+
+    Index k = 0;
+    bool converged = false;
+    while (k < restart and napply < max_apply) {
+      apply(w, V(k, joker));
+      napply++;
+
+      // Modified Gram-Schmidt
+      for (Index i = 0; i <= k; i++) {
+        H(i, k) = w * V(i, joker);
+        for (Index j = 0; j < n; j++) w[j] -= H(i, k) * V(i, j);
+      }
+      H(k + 1, k) = std::sqrt(w * w);
+      const bool exhausted = H(k + 1, k) == 0;
+      if (not exhausted) {
+        V(k + 1, joker) = w;
+        V(k + 1, joker) /= H(k + 1, k);
+      }
+
+      // Givens rotations to keep H upper triangular
+      for (Index i = 0; i < k; i++) {
+        const Numeric h = cs[i] * H(i, k) + sn[i] * H(i + 1, k);
+        H(i + 1, k) = -sn[i] * H(i, k) + cs[i] * H(i + 1, k);
+        H(i, k) = h;
+      }
+      const Numeric d = std::hypot(H(k, k), H(k + 1, k));
+      if (d == 0) break;
+      cs[k] = H(k, k) / d;
+      sn[k] = H(k + 1, k) / d;
+      H(k, k) = d;
+      H(k + 1, k) = 0;
+      g[k + 1] = -sn[k] * g[k];
+      g[k] *= cs[k];
+      k++;
+
+      // The residual norm is |g[k]|, or zero if the basis is exhausted
+      converged = std::abs(g[k]) <= tolerance * bnorm;
+      if (converged or exhausted) break;
+    }
+
+    for (Index i = k - 1; i >= 0; i--) {
+      y[i] = g[i];
+      for (Index j = i + 1; j < k; j++) y[i] -= H(i, j) * y[j];
+      y[i] /= H(i, i);
+    }
+    for (Index i = 0; i < k; i++)
+      for (Index j = 0; j < n; j++) x[j] += y[i] * V(i, j);
+
+    if (converged or k == 0) break;
+  }
+
+  return napply;
+}
+
+Index doit_bicgstab(
+    VectorView x,
+    ConstVectorView b,
+    const std::function<void(VectorView, ConstVectorView)>& apply,
+    Numeric tolerance,
+    Index max_apply) {
+  const Index n = x.nelem();
+  const Numeric bnorm = std::sqrt(b * b);
+
+  Vector r(n), r0(n), p(n, 0), v(n, 0), s(n), t(n);
+  Index napply = doit_residual(r, x, b, apply);
+  r0 = r;
+
+  Numeric rho = 1, alpha = 1, omega = 1;
+  while (napply + 2 <= max_apply and std::sqrt(r * r) > tolerance * bnorm) {
+    const Numeric rho_new = r0 * r;
+    if (rho_new == 0 or omega == 0) break;
+
+    const Numeric beta = (rho_new / rho) * (alpha / omega);
+    for (Index i = 0; i < n; i++) p[i] = r[i] + beta * (p[i] - omega * v[i]);
+    apply(v, p);
+    napply++;
+
+    alpha = rho_new / (r0 * v);
+    for (Index i = 0; i < n; i++) s[i] = r[i] - alpha * v[i];
+    if (std::sqrt(s * s) <= tolerance * bnorm) {
+      for (Index i = 0; i < n; i++) x[i] += alpha * p[i];
+      break;
+    }
+
+    apply(t, s);
+    napply++;
+
+    const Numeric tt = t * t;
+    omega = tt > 0 ? (t * s) / tt : 0;
+    for (Index i = 0; i < n; i++) {
+      x[i] += alpha * p[i] + omega * s[i];
+      r[i] = s[i] - omega * t[i];
+    }
+    rho = rho_new;
+  }
+
+  return napply;
+}
+}  // namespace
+
+Index doit_krylov_solve(
+    VectorView x,
+    ConstVectorView b,
+    const std::function<void(VectorView, ConstVectorView)>& apply,
+    Options::DoitSolver solver,
+    Index restart,
+    Numeric tolerance,
+    Index max_apply) {
+  ARTS_ASSERT(x.nelem() == b.nelem())
+  ARTS_USER_ERROR_IF(restart < 1, "The Krylov basis must have a size of at "
+                     "least 1, but *krylov_restart* is ", restart)
+  ARTS_USER_ERROR_IF(tolerance <= 0, "*krylov_tolerance* must be positive, "
+                     "but it is ", tolerance)
+
+  if (b * b == 0) {
+    x = 0;
+    return 0;
+  }
+
+  switch (solver) {
+    case Options::DoitSolver::GMRES:
+      return doit_gmres(x, b, apply, restart, tolerance, max_apply);
+    case Options::DoitSolver::BiCGSTAB:
+      return doit_bicgstab(x, b, apply, tolerance, max_apply);
+    case Options::DoitSolver::SourceIteration:
+    case Options::DoitSolver::FINAL:
+      break;
+  }
+  ARTS_USER_ERROR("No Krylov solver called ", solver)
+}
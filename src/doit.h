@@ -16,7 +16,10 @@
 #ifndef doit_h
 #define doit_h
 
+#include <functional>
+
 #include "agenda_class.h"
+#include "arts_options.h"
 #include "matpack_data.h"
 #include "ppath.h"
 #include "propagationmatrix.h"
@@ -598,6 +601,70 @@ void za_gridOpt(  //Output:
     const Numeric& acc,
     const Index& scat_za_interp);
 
+//! Integration weights of the scattering integral
+/*!
+  Weights of the incoming directions for the trapezoidal integration of
+  the scattering integral, so that the integral is a plain weighted sum.
+  With more than one azimuth angle, the integration is over the full
+  sphere, as AngIntegrate_trapezoid. With a single azimuth angle (1D), the
+  azimuthal dimension is left out, as AngIntegrate_trapezoid over the
+  zenith angles divided by 2 PI.
+
+  \param[out]  weights Weights [za_grid, aa_grid]
+  \param[in]   za_grid Zenith angle grid of the incoming directions
+  \param[in]   aa_grid Azimuth angle grid of the incoming directions
+*/
+void doit_scat_field_weights(Matrix& weights,
+                             ConstVectorView za_grid,
+                             ConstVectorView aa_grid);
+
+//! Scattering integral of a 1D cloudbox point
+/*!
+  Sums the phase matrix, prepared for the point by
+  *DoitScatteringDataPrepare*, times the weighted incoming field over all
+  incoming directions. The phase matrix is streamed once, so the cost is
+  bound by its memory bandwidth.
+
+  \param[out]  scat_field Scattered field [za_out, stokes_dim]
+  \param[in]   pha_mat Phase matrix [za_out, za_in, aa_in, stokes_dim,
+                       stokes_dim]
+  \param[in]   field Incoming field [za_in, stokes_dim]
+  \param[in]   weights As from doit_scat_field_weights [za_in, aa_in]
+*/
+void doit_scat_field_1D(MatrixView scat_field,
+                        ConstTensor5View pha_mat,
+                        ConstMatrixView field,
+                        ConstMatrixView weights);
+
+//! Matrix-free Krylov solution of a linear system
+/*!
+  Solves A x = b, where A is only known by its product with a vector. Used
+  by cloudbox_field_monoIterate for the fixed point of the DOIT update,
+  where A v is v minus the change of the update by v.
+
+  GMRES is restarted after \p restart products. BiCGSTAB needs two
+  products per step but keeps no Krylov basis. A zero start guess costs no
+  product for the first residual.
+
+  \param[in,out] x        Start guess, solution on return
+  \param[in]     b        Right hand side
+  \param[in]     apply    Sets its first argument to A times its second
+  \param[in]     solver   GMRES or BiCGSTAB
+  \param[in]     restart  Size of the Krylov basis of GMRES
+  \param[in]     tolerance Relative residual, |b - A x| / |b|, to reach
+  \param[in]     max_apply Maximum number of products with A
+
+  \return The number of products with A
+*/
+Index doit_krylov_solve(
+    VectorView x,
+    ConstVectorView b,
+    const std::function<void(VectorView, ConstVectorView)>& apply,
+    Options::DoitSolver solver,
+    Index restart,
+    Numeric tolerance,
+    Index max_apply);
+
 //! Normalization of scattered field
 /*!
   Calculate the scattered extinction field and apply the
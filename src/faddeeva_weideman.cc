@@ -0,0 +1,147 @@
+#include "faddeeva_weideman.h"
+
+#include <array>
+
+#include "arts_constants.h"
+
+namespace Weideman {
+/** Scale parameter of the series for N = 32, L = sqrt(N / sqrt(2)) */
+constexpr Numeric L = 4.756828460010884;
+
+/** Polynomial coefficients of the series, highest order first */
+constexpr std::array<Numeric, 32> a{
+    -1.3031797863050087e-12, 3.740951992625696e-12,  8.03035415941622e-12,
+    -2.1543655748246238e-11, -5.54423729148823e-11,  1.165826046811702e-10,
+    4.15374443174521e-10,    -5.231020686058407e-10, -3.2080151035618343e-09,
+    8.124890309157973e-10,   2.379755679061263e-08,  2.293043906143044e-08,
+    -1.4813078910620194e-07, -4.184076370551958e-07, 4.255833137338123e-07,
+    4.401531731492494e-06,   6.821031944001985e-06,  -2.140961920187231e-05,
+    -0.00013075449254633574, -0.00024532980270021025, 0.0003925913607005805,
+    0.004519541105349148,    0.019006155784845324,   0.057304403529837206,
+    0.1406071622689377,      0.2954445107150873,     0.5460139720639341,
+    0.9019254893648001,      1.345544169234545,      1.8256696296324813,
+    2.2635372999002676,      2.5722534081245696};
+
+/** The series for x + iy with y >= 0, written out in real arithmetic
+ *
+ * @param[out] re Real part of w
+ * @param[out] im Imaginary part of w
+ * @param[in] x Real part of z
+ * @param[in] y Imaginary part of z, must be non-negative
+ */
+constexpr void upper_half_plane(Numeric &re, Numeric &im, const Numeric x,
+                                const Numeric y) noexcept {
+  // 1 / (L - iz)
+  const Numeric dr = L + y;
+  const Numeric di = -x;
+  const Numeric n2 = dr * dr + di * di;
+  const Numeric ir = dr / n2;
+  const Numeric ii = -di / n2;
+
+  // Z = (L + iz) / (L - iz)
+  const Numeric nr = L - y;
+  const Numeric ni = x;
+  const Numeric Zr = nr * ir - ni * ii;
+  const Numeric Zi = nr * ii + ni * ir;
+
+  // p(Z) by Horner's scheme, unrolled so that the block loop is vectorized
+  Numeric pr = a[0];
+  Numeric pi = 0;
+#pragma GCC unroll 32
+  for (std::size_t k = 1; k < a.size(); k++) {
+    const Numeric t = pr * Zr - pi * Zi + a[k];
+    pi = pr * Zi + pi * Zr;
+    pr = t;
+  }
+
+  // w = (2 p(Z) / (L - iz) + 1 / sqrt(pi)) / (L - iz)
+  const Numeric qr = 2 * (pr * ir - pi * ii) + Constant::inv_sqrt_pi;
+  const Numeric qi = 2 * (pr * ii + pi * ir);
+  re = ir * qr - ii * qi;
+  im = ir * qi + ii * qr;
+}
+
+/** Where the continued fraction is used, in |Re z| + |Im z| */
+constexpr Numeric far = 50;
+
+/** The Laplace continued fraction for x + iy with y >= 0 and |x| + y >= far
+ *
+ * As Faddeeva::w does there, but with 6 terms, which are enough for all such
+ * z, so that the block loop is vectorized.  This is much cheaper than the
+ * series in the line wings.
+ *
+ * @param[out] re Real part of w
+ * @param[out] im Imaginary part of w
+ * @param[in] x Real part of z
+ * @param[in] y Imaginary part of z, must be non-negative
+ */
+constexpr void continued_fraction(Numeric &re, Numeric &im, const Numeric x,
+                                  const Numeric y) noexcept {
+  // v = z - nu / v for nu = 2.5, 2, ..., 0.5
+  Numeric vr = x;
+  Numeric vi = y;
+#pragma GCC unroll 5
+  for (int k = 5; k > 0; k--) {
+    const Numeric d = 0.5 * k / (vr * vr + vi * vi);
+    vr = x - vr * d;
+    vi = y + vi * d;
+  }
+
+  // w = i / (sqrt(pi) v)
+  const Numeric d = Constant::inv_sqrt_pi / (vr * vr + vi * vi);
+  re = vi * d;
+  im = vr * d;
+}
+
+/** Checks if w(z) is computed by the continued fraction */
+constexpr bool is_far(const Complex z) noexcept {
+  return std::abs(z.real()) + std::abs(z.imag()) >= far;
+}
+
+Complex w(Complex z) noexcept {
+  Numeric re, im;
+  if (is_far(z))
+    continued_fraction(re, im, z.real(), std::abs(z.imag()));
+  else
+    upper_half_plane(re, im, z.real(), std::abs(z.imag()));
+
+  // w(z) = 2 exp(-z^2) - w(-z) and w(-conj(z)) = conj(w(z))
+  if (z.imag() < 0) return 2.0 * std::exp(-z * z) - Complex(re, -im);
+  return {re, im};
+}
+
+void w(ComplexVectorView out, const ConstComplexVectorView &z) ARTS_NOEXCEPT {
+  const Index n = z.size();
+  ARTS_ASSERT(out.size() == n, "Must have the same size")
+
+  // Runs of values in the same region, which are few for the frequencies
+  // of a line, so that each run is a vectorized loop
+  for (Index first = 0; first < n;) {
+    const bool far_run = is_far(z[first]);
+    Index last = first + 1;
+    while (last < n and is_far(z[last]) == far_run) last++;
+
+    if (far_run) {
+      for (Index i = first; i < last; i++) {
+        Numeric re, im;
+        continued_fraction(re, im, z[i].real(), std::abs(z[i].imag()));
+        out[i] = Complex(re, im);
+      }
+    } else {
+      for (Index i = first; i < last; i++) {
+        Numeric re, im;
+        upper_half_plane(re, im, z[i].real(), std::abs(z[i].imag()));
+        out[i] = Complex(re, im);
+      }
+    }
+
+    first = last;
+  }
+
+  for (Index i = 0; i < n; i++) {
+    if (z[i].imag() < 0) {
+      out[i] = 2.0 * std::exp(-z[i] * z[i]) - std::conj(out[i]);
+    }
+  }
+}
+}  // namespace Weideman
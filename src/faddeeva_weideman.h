@@ -0,0 +1,38 @@
+/** Rational approximation of the Faddeeva function
+ * @file faddeeva_weideman.h
+ *
+ * @brief Headers for a rational approximation of the Faddeeva function
+ *
+ * Uses the rational series of J.A.C. Weideman, "Computation of the Complex
+ * Error Function", SIAM J. Numer. Anal. 31 (1994) 1497-1518, with 32 terms.
+ * Compared to Faddeeva::w of 3rdparty/Faddeeva the relative error is below
+ * 1e-12 in the complex plane.  Far from the origin, |Re z| + |Im z| >= 50,
+ * the Laplace continued fraction of Faddeeva::w is used instead, with a fixed
+ * number of terms.  The block version evaluates runs of values in either
+ * region in loops without branches that can be vectorized by the compiler.
+ */
+
+#ifndef faddeeva_weideman_h
+#define faddeeva_weideman_h
+
+#include "debug.h"
+#include "matpack_complex.h"
+#include "matpack_view.h"
+
+namespace Weideman {
+/** Computes w(z) = exp(-z^2) erfc(-iz)
+ *
+ * @param[in] z Any complex number
+ * @return The Faddeeva function at z
+ */
+Complex w(Complex z) noexcept;
+
+/** Computes w(z) = exp(-z^2) erfc(-iz) for a block of values
+ *
+ * @param[out] out The Faddeeva function at z, same size as z
+ * @param[in] z Any complex numbers
+ */
+void w(ComplexVectorView out, const ConstComplexVectorView& z) ARTS_NOEXCEPT;
+}  // namespace Weideman
+
+#endif  // faddeeva_weideman_h
@@ -7,8 +7,17 @@
 */
 
 #include "gas_abs_lookup.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
 #include <cfloat>
 #include <cmath>
+#include <cstring>
+#include <fstream>
 #include "check_input.h"
 #include "interp.h"
 #include "interpolation.h"
@@ -16,6 +25,125 @@
 #include "matpack_data.h"
 #include "messages.h"
 #include "physics_funcs.h"
+#include "xml_io.h"
+
+namespace {
+//! Identifies a memory mappable lookup table file.
+constexpr std::array<char, 8> mapped_xsec_magic{
+    'A', 'R', 'T', 'S', 'X', 'S', 'E', 'C'};
+
+//! Written as is, so that a file from a machine of other endianness is found.
+constexpr std::int64_t mapped_xsec_endian = 0x0102030405060708;
+
+//! The header of a memory mappable lookup table file.
+struct MappedXsecHeader {
+  std::array<char, 8> magic;
+  std::int64_t version;
+  std::int64_t endian;
+  std::array<std::int64_t, 4> shape;
+  std::int64_t offset;
+};
+}  // namespace
+
+//! Map the cross sections of a lookup table file.
+/*!
+  The file must have been written by MappedXsec::write. The data is mapped
+  read-only and shared, so no data is read before it is accessed.
+
+  \param filename The name of the file.
+
+  \date 2026-10-18
+*/
+MappedXsec::MappedXsec(const String& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  ARTS_USER_ERROR_IF(fd < 0,
+                     "Cannot open lookup table cross sections file ",
+                     filename,
+                     ": ",
+                     std::strerror(errno))
+
+  struct stat st {};
+  MappedXsecHeader header{};
+  const bool ok_stat = ::fstat(fd, &st) == 0;
+  const bool ok_read =
+      ok_stat and ::pread(fd, &header, sizeof header, 0) ==
+                      static_cast<ssize_t>(sizeof header);
+
+  const auto fail = [&](const auto&... msg) {
+    ::close(fd);
+    ARTS_USER_ERROR("Bad lookup table cross sections file ", filename, ":\n", msg...)
+  };
+
+  if (not ok_read) fail("Cannot read the header");
+  if (header.magic not_eq mapped_xsec_magic) fail("Not a cross sections file");
+  if (header.endian not_eq mapped_xsec_endian)
+    fail("Written on a machine with other endianness");
+  if (header.version not_eq version)
+    fail("Has version ", header.version, " but only version ", version,
+         " is supported");
+
+  const std::int64_t n =
+      header.shape[0] * header.shape[1] * header.shape[2] * header.shape[3];
+  if (header.offset < static_cast<std::int64_t>(sizeof header) or n < 0 or
+      header.offset + n * static_cast<std::int64_t>(sizeof(Numeric)) >
+          static_cast<std::int64_t>(st.st_size))
+    fail("The file is truncated or the header is corrupt");
+
+  length = static_cast<std::size_t>(st.st_size);
+  if (n > 0) {
+    addr = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+      addr = nullptr;
+      fail("Cannot map the file: ", std::strerror(errno));
+    }
+  }
+  ::close(fd);
+
+  if (addr)
+    data = reinterpret_cast<const Numeric*>(static_cast<const char*>(addr) +
+                                            header.offset);
+  shape = {header.shape[0], header.shape[1], header.shape[2], header.shape[3]};
+}
+
+MappedXsec::~MappedXsec() {
+  if (addr) ::munmap(addr, length);
+}
+
+//! Write cross sections in the memory mappable format.
+/*!
+  \param filename The name of the file.
+  \param xsec     The cross sections, as in GasAbsLookup.
+
+  \date 2026-10-18
+*/
+void MappedXsec::write(const String& filename, ConstTensor4View xsec) {
+  MappedXsecHeader header{};
+  header.magic = mapped_xsec_magic;
+  header.version = version;
+  header.endian = mapped_xsec_endian;
+  header.shape = {xsec.nbooks(), xsec.npages(), xsec.nrows(), xsec.ncols()};
+  header.offset = header_size;
+
+  std::ofstream os(filename, std::ios::binary);
+  ARTS_USER_ERROR_IF(not os, "Cannot open ", filename, " for writing")
+
+  std::array<char, header_size> first_page{};
+  std::memcpy(first_page.data(), &header, sizeof header);
+  os.write(first_page.data(), header_size);
+
+  // Write one frequency-pressure slice at a time, so that the table is never
+  // copied as a whole
+  Matrix slice;
+  for (Index b = 0; b < xsec.nbooks(); ++b) {
+    for (Index p = 0; p < xsec.npages(); ++p) {
+      slice = xsec(b, p, Range(joker), Range(joker));
+      os.write(reinterpret_cast<const char*>(slice.unsafe_data_handle()),
+               static_cast<std::streamsize>(slice.nrows() * slice.ncols() *
+                                            Index(sizeof(Numeric))));
+    }
+  }
+  ARTS_USER_ERROR_IF(not os, "Error writing ", filename)
+}
 
 //! Find positions of new grid points in old grid.
 /*! 
@@ -115,6 +243,13 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   const Index n_f_grid = f_grid.nelem();
   const Index n_p_grid = p_grid.nelem();
 
+  // The cross sections, possibly memory mapped, and their dimensions, also
+  // when they are stored in single precision:
+  const ConstTensor4View table = XsecView();
+  const bool single = storage == Options::LookupStorage::Float;
+  const ConstTensor4View dims =
+      single ? ConstTensor4View{nullptr, xsec_float_shape} : table;
+
   out2 << "  Original table: " << n_species << " species, " << n_f_grid
        << " frequencies.\n"
        << "  Adapt to:       " << n_current_species << " species, "
@@ -210,7 +345,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, 1, n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", dims, 1, n_species, n_f_grid, n_p_grid);
     } else {
       //     Standard case (temperature perturbations,
       //     but no vmr perturbations):
@@ -218,7 +353,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
       //     b = n_species
       //     c = n_f_grid
       //     d = n_p_grid
-      chk_size("xsec", xsec, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
+      chk_size("xsec", dims, t_pert.nelem(), n_species, n_f_grid, n_p_grid);
     }
   } else {
     //     Full case (with temperature perturbations and
@@ -232,7 +367,7 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
     Index c = n_f_grid;
     Index d = n_p_grid;
 
-    chk_size("xsec", xsec, a, b, c, d);
+    chk_size("xsec", dims, a, b, c, d);
   }
 
   // We also need indices to the positions of the original species
@@ -385,49 +520,100 @@ void GasAbsLookup::Adapt(const ArrayOfArrayOfSpeciesTag& current_species,
   }
 
   // Absorption coefficients:
-  new_table.xsec.resize(
-      xsec.nbooks(),
-      n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
-      n_current_f_grid,
-      xsec.ncols());
-
-  // We have to copy the right species and frequencies from the old to
-  // the new table. Temperature perturbations and pressure grid remain
-  // the same.
-
-  // Do species:
-  for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
-    // n_v is the number of VMR perturbations
-    Index n_v;
-    if (current_non_linear[i_s])
-      n_v = n_nls_pert;
-    else
-      n_v = 1;
-
-    //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
-    //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
-
-    // Do frequencies:
-    for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
-      if (i_current_species[i_s] >= 0) {
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
-            xsec(Range(joker),
-                 Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
-                 i_current_f_grid[i_f],
-                 Range(joker));
-      } else {
-        // Here we handle the case of the trivial species, which we simply
-        // set to NAN:
-        new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+  //
+  // A memory mapped table that already has exactly the current species and
+  // frequencies stays mapped, so that it remains shared with other
+  // processes. Otherwise only the selected parts are copied, which for a
+  // mapped table means that only they are read from disk.
+  bool keep_map = xsec_map and n_current_species == n_species and
+                  n_current_f_grid == n_f_grid;
+  for (Index i = 0; keep_map and i < n_current_species; ++i)
+    keep_map = i_current_species[i] == i;
+  for (Index i = 0; keep_map and i < n_current_f_grid; ++i)
+    keep_map = i_current_f_grid[i] == i;
+
+  if (keep_map) {
+    out2 << "  Keeping the memory mapped table.\n";
+    new_table.xsec_map = xsec_map;
+  } else if (single) {
+    // Same as below, but staying in single precision
+    new_table.storage = storage;
+    new_table.xsec_float_shape = {
+        dims.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        dims.ncols()};
+    new_table.xsec_float.resize(new_table.xsec_float_shape[0] *
+                                new_table.xsec_float_shape[1] *
+                                new_table.xsec_float_shape[2] *
+                                new_table.xsec_float_shape[3]);
+
+    for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
+      const Index n_v = current_non_linear[i_s] ? n_nls_pert : 1;
+      for (Index a = 0; a < dims.nbooks(); ++a) {
+        for (Index v = 0; v < n_v; ++v) {
+          for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
+            for (Index i_p = 0; i_p < n_p_grid; ++i_p) {
+              new_table.xsec_float[new_table.float_pos(a, sp + v, i_f, i_p)] =
+                  i_current_species[i_s] >= 0
+                      ? xsec_float[float_pos(
+                            a,
+                            original_spec_pos_in_xsec[i_current_species[i_s]] +
+                                v,
+                            i_current_f_grid[i_f],
+                            i_p)]
+                      : NAN;
+            }
+          }
+        }
       }
-
-      //           cout << "result: " << xsec( Range(joker),
-      //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
-      //                                       i_current_f_grid[i_f],
-      //                                       Range(joker) ) << endl;
+      sp += n_v;
     }
+  } else {
+    new_table.xsec.resize(
+        dims.nbooks(),
+        n_current_species + n_current_nonlinear_species * (n_nls_pert - 1),
+        n_current_f_grid,
+        dims.ncols());
+
+    // We have to copy the right species and frequencies from the old to
+    // the new table. Temperature perturbations and pressure grid remain
+    // the same.
+
+    // Do species:
+    for (Index i_s = 0, sp = 0; i_s < n_current_species; ++i_s) {
+      // n_v is the number of VMR perturbations
+      Index n_v;
+      if (current_non_linear[i_s])
+        n_v = n_nls_pert;
+      else
+        n_v = 1;
+
+      //      cout << "i_s / sp / n_v = " << i_s << " / " << sp << " / " << n_v << endl;
+      //      cout << "orig_pos = " << original_spec_pos_in_xsec[i_current_species[i_s]] << endl;
+
+      // Do frequencies:
+      for (Index i_f = 0; i_f < n_current_f_grid; ++i_f) {
+        if (i_current_species[i_s] >= 0) {
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) =
+              table(Range(joker),
+                    Range(original_spec_pos_in_xsec[i_current_species[i_s]], n_v),
+                    i_current_f_grid[i_f],
+                    Range(joker));
+        } else {
+          // Here we handle the case of the trivial species, which we simply
+          // set to NAN:
+          new_table.xsec(Range(joker), Range(sp, n_v), i_f, Range(joker)) = NAN;
+        }
 
-    sp += n_v;
+        //           cout << "result: " << xsec( Range(joker),
+        //                                       Range(original_spec_pos_in_xsec[i_current_species[i_s]],n_v),
+        //                                       i_current_f_grid[i_f],
+        //                                       Range(joker) ) << endl;
+      }
+
+      sp += n_v;
+    }
   }
 
   // 4. Replace original table by the new one.
@@ -560,6 +746,13 @@ void GasAbsLookup::Extract(Matrix& sga,
   // Check dimension of t_ref:
   ARTS_ASSERT(is_size(t_ref, n_p_grid));
 
+  // The cross sections, possibly memory mapped, and their dimensions, also
+  // when they are stored in single precision:
+  const ConstTensor4View table = XsecView();
+  const bool single = storage == Options::LookupStorage::Float;
+  [[maybe_unused]] const ConstTensor4View dims =
+      single ? ConstTensor4View{nullptr, xsec_float_shape} : table;
+
   // Check dimension of xsec:
   DEBUG_ONLY({
     Index a, b, c, d;
@@ -580,7 +773,7 @@ void GasAbsLookup::Extract(Matrix& sga,
     //            << b << ", "
     //            << c << ", "
     //            << d << "\n";
-    ARTS_ASSERT(is_size(xsec, a, b, c, d));
+    ARTS_ASSERT(is_size(dims, a, b, c, d));
   })
 
   // Make sure that log_p_grid is initialized:
@@ -1030,20 +1223,40 @@ void GasAbsLookup::Extract(Matrix& sga,
         itw = &itw_noH2O;
       }
 
-      // Get the right view on xsec.
-      ConstTensor3View this_xsec =
-          xsec(Range(joker),                 // Temperature range
-               Range(fpi, this_h2o_extent),  // VMR profile range
-               Range(joker),                 // Frequency range
-               this_p_grid_index);           // Pressure index
-
       // Do interpolation.
-      reinterp(res,        // result
-               this_xsec,  // input
-               *itw,       // weights
-               *tlag,
-               *vlag,
-               *flag);  // grid positions
+      if (single) {
+        // As reinterp, but reading the single precision cross sections
+        // where they are, and summing in double precision
+        for (Index it = 0; it < res.npages(); ++it) {
+          const LagrangeInterpolation& tl = (*tlag)[it];
+          for (Index iv = 0; iv < res.nrows(); ++iv) {
+            const LagrangeInterpolation& vl = (*vlag)[iv];
+            for (Index iff = 0; iff < res.ncols(); ++iff) {
+              const LagrangeInterpolation& fl = (*flag)[iff];
+              Numeric x = 0;
+              for (Index a = 0; a < Index(tl.size()); ++a)
+                for (Index v = 0; v < Index(vl.size()); ++v)
+                  for (Index f = 0; f < Index(fl.size()); ++f)
+                    x += (*itw)(it, iv, iff, a, v, f) *
+                         xsec_float[float_pos(tl.pos + a,
+                                              fpi + vl.pos + v,
+                                              fl.pos + f,
+                                              this_p_grid_index)];
+              res(it, iv, iff) = x;
+            }
+          }
+        }
+      } else {
+        reinterp(res,  // result
+                 table(Range(joker),                 // Temperature range
+                       Range(fpi, this_h2o_extent),  // VMR profile range
+                       Range(joker),                 // Frequency range
+                       this_p_grid_index),           // Pressure index
+                 *itw,                               // weights
+                 *tlag,
+                 *vlag,
+                 *flag);  // grid positions
+      }
 
       // Increase fpi. fpi marks the position of the first profile
       // of the current species in xsec. This is needed to find
@@ -1057,7 +1270,7 @@ void GasAbsLookup::Extract(Matrix& sga,
 
     // fpi should have reached the end of that dimension of xsec. Check
     // this with an assertion:
-    ARTS_ASSERT(fpi == xsec.npages());
+    ARTS_ASSERT(fpi == dims.npages());
 
   }  // End of pressure index loop (below and above gp)
 
@@ -1103,6 +1316,417 @@ void GasAbsLookup::Extract(Matrix& sga,
   // That's it, we're done!
 }
 
+//! Interpolation weights for extracting many atmospheric states at once.
+/*!
+  Does the checks and the grid position and weight calculations of Extract
+  for all states, so that the batched Extract only has to sum up the
+  table. Like Extract with f_interp_order 0, the states are extracted on
+  the frequency grid of the table, and new_f_grid is only checked against
+  it.
+
+  \param[out] weights The interpolation weights of the states.
+
+  \param[in] p_interp_order Interpolation order for pressure.
+
+  \param[in] t_interp_order Interpolation order for temperature.
+
+  \param[in] h2o_interp_order Interpolation order for water vapor.
+
+  \param[in] p The pressures [Pa]. Dimension: [n_states].
+
+  \param[in] T The temperatures [K]. Dimension: [n_states].
+
+  \param[in] abs_vmrs The VMRs [absolute number]. Dimension:
+             [n_states, n_species].
+
+  \param[in] new_f_grid The frequency grid of the states, must be the one
+             of the table.
+
+  \param[in] extpolfac How much extrapolation to allow.
+
+  \date 2026-10-18
+*/
+void GasAbsLookup::ExtractWeights(GasAbsLookupWeights& weights,
+                                  const Index& p_interp_order,
+                                  const Index& t_interp_order,
+                                  const Index& h2o_interp_order,
+                                  ConstVectorView p,
+                                  ConstVectorView T,
+                                  ConstMatrixView abs_vmrs,
+                                  ConstVectorView new_f_grid,
+                                  const Numeric& extpolfac) const {
+  const Index n_species = species.nelem();
+  const Index n_nls = nonlinear_species.nelem();
+  const Index n_f_grid = f_grid.nelem();
+  const Index n_p_grid = p_grid.nelem();
+  const Index n_t_pert = t_pert.nelem();
+  const Index n_nls_pert = nls_pert.nelem();
+  const Index n_states = p.nelem();
+
+  ARTS_USER_ERROR_IF(log_p_grid.nelem() != n_p_grid,
+                     "The lookup table internal variable log_p_grid is not "
+                     "initialized.\nUse the abs_lookupAdapt method!")
+  ARTS_USER_ERROR_IF(n_p_grid < p_interp_order + 1,
+                     "The number of pressure grid points in the table (",
+                     n_p_grid, ") is not enough for the desired order of "
+                     "interpolation (", p_interp_order, ").")
+  ARTS_USER_ERROR_IF(n_nls_pert != 0 and n_nls_pert < h2o_interp_order + 1,
+                     "The number of humidity perturbation grid points in the "
+                     "table (", n_nls_pert, ") is not enough for the desired "
+                     "order of interpolation (", h2o_interp_order, ").")
+  ARTS_USER_ERROR_IF(n_t_pert != 0 and n_t_pert < t_interp_order + 1,
+                     "The number of temperature perturbation grid points in "
+                     "the table (", n_t_pert, ") is not enough for the "
+                     "desired order of interpolation (", t_interp_order, ").")
+  ARTS_USER_ERROR_IF(T.nelem() != n_states or
+                         not is_size(abs_vmrs, n_states, n_species),
+                     "Number of species in lookup table does not match number\n"
+                     "of species for which you want to extract absorption,\n"
+                     "or there is not one temperature per pressure.")
+
+  // The same margin as in Extract, just below the wind jacobian perturbation
+  const Numeric allowed_f_margin = 0.09;
+  ARTS_USER_ERROR_IF(new_f_grid.nelem() != n_f_grid,
+                     "The frequency grid has to have the same size as in the "
+                     "lookup table.")
+  ARTS_USER_ERROR_IF(
+      n_f_grid > 0 and
+          (abs(f_grid[0] - new_f_grid[0]) > allowed_f_margin or
+           abs(f_grid[n_f_grid - 1] - new_f_grid[n_f_grid - 1]) >
+               allowed_f_margin),
+      "f_grid inconsistent with lookup table.\n"
+      "f_grid ranges from ", new_f_grid[0], " to ", new_f_grid[n_f_grid - 1],
+      " Hz, the table from ", f_grid[0], " to ", f_grid[n_f_grid - 1], " Hz.")
+
+  Index h2o_index = -1;
+  if (n_nls > 0) {
+    h2o_index = find_first_species(species, Species::Species::Water);
+    ARTS_USER_ERROR_IF(
+        h2o_index == -1,
+        "With nonlinear species, at least one species must be a H2O species.")
+  }
+
+  const Index np = weights.np = p_interp_order + 1;
+  const Index nt = weights.nt = n_t_pert ? t_interp_order + 1 : 1;
+  const Index nv = weights.nv = n_nls ? h2o_interp_order + 1 : 1;
+  weights.ppos.resize(n_states);
+  weights.tpos.resize(n_states * np);
+  weights.vpos.resize(n_states * np);
+  weights.pw.resize(n_states, np);
+  weights.tw.resize(n_states, np, nt);
+  weights.vw.resize(n_states, np, nv);
+  weights.n.resize(n_states);
+
+  for (Index is = 0; is < n_states; is++) {
+    // Check that p is inside the grid. (p_grid is sorted in decreasing order.)
+    if (n_p_grid > 1) {
+      const Numeric p_max = p_grid[0] + 0.5 * (p_grid[0] - p_grid[1]);
+      const Numeric p_min = p_grid[n_p_grid - 1] -
+                            0.5 * (p_grid[n_p_grid - 2] - p_grid[n_p_grid - 1]);
+      ARTS_USER_ERROR_IF(p[is] > p_max or p[is] < p_min,
+                         "Problem with gas absorption lookup table.\n"
+                         "Pressure p is outside the range covered by the lookup "
+                         "table.\nYour p value is ", p[is], " Pa.\n"
+                         "The allowed range is ", p_min, " to ", p_max, ".\n"
+                         "We allow a bit of extrapolation, but NOT SO MUCH!")
+    }
+
+    const LagrangeInterpolation plag(
+        0, std::log(p[is]), log_p_grid, p_interp_order);
+    weights.ppos[is] = plag.pos;
+    for (Index k = 0; k < np; k++) weights.pw(is, k) = plag.lx[k];
+    weights.n[is] = number_density(p[is], T[is]);
+
+    for (Index k = 0; k < np; k++) {
+      const Index ip = plag.pos + k;
+
+      weights.tpos[is * np + k] = 0;
+      weights.tw(is, k, joker) = 1;
+      if (n_t_pert) {
+        const Numeric T_offset = T[is] - t_ref[ip];
+        const Numeric t_min = t_pert[0] - extpolfac * (t_pert[1] - t_pert[0]);
+        const Numeric t_max =
+            t_pert[n_t_pert - 1] +
+            extpolfac * (t_pert[n_t_pert - 1] - t_pert[n_t_pert - 2]);
+        ARTS_USER_ERROR_IF(T_offset > t_max or T_offset < t_min,
+                           "Problem with gas absorption lookup table.\n"
+                           "Temperature T is outside the range covered by the "
+                           "lookup table.\nYour temperature was ", T[is],
+                           " K at a pressure of ", p[is], " Pa.\n"
+                           "The temperature offset value is ", T_offset, ".\n"
+                           "The allowed range is ", t_min, " to ", t_max, ".\n"
+                           "We allow a bit of extrapolation, but NOT SO MUCH!")
+
+        const LagrangeInterpolation tlag(0, T_offset, t_pert, t_interp_order);
+        weights.tpos[is * np + k] = tlag.pos;
+        for (Index it = 0; it < nt; it++) weights.tw(is, k, it) = tlag.lx[it];
+      }
+
+      weights.vpos[is * np + k] = 0;
+      weights.vw(is, k, joker) = 1;
+      if (n_nls) {
+        const Numeric effective_vmr_ref = vmrs_ref(h2o_index, ip);
+        const Numeric VMR_frac = abs_vmrs(is, h2o_index) / effective_vmr_ref;
+        const Numeric x_min =
+            nls_pert[0] - extpolfac * (nls_pert[1] - nls_pert[0]);
+        const Numeric x_max =
+            nls_pert[n_nls_pert - 1] +
+            extpolfac * (nls_pert[n_nls_pert - 1] - nls_pert[n_nls_pert - 2]);
+        ARTS_USER_ERROR_IF(VMR_frac > x_max or VMR_frac < x_min,
+                           "Problem with gas absorption lookup table.\n"
+                           "VMR for H2O (species ", h2o_index,
+                           ") is outside the range covered by the lookup "
+                           "table.\nYour VMR was ", abs_vmrs(is, h2o_index),
+                           " at a pressure of ", p[is], " Pa.\n"
+                           "The reference VMR value there is ",
+                           effective_vmr_ref, "\n"
+                           "The fractional VMR relative to the reference value "
+                           "is ", VMR_frac, ".\n"
+                           "The allowed range is ", x_min, " to ", x_max, ".\n"
+                           "We allow a bit of extrapolation, but NOT SO MUCH!")
+
+        const LagrangeInterpolation vlag(
+            0, VMR_frac, nls_pert, h2o_interp_order);
+        weights.vpos[is * np + k] = vlag.pos;
+        for (Index iv = 0; iv < nv; iv++) weights.vw(is, k, iv) = vlag.lx[iv];
+      }
+    }
+  }
+}
+
+//! Extract scalar gas absorption coefficients for many atmospheric states.
+/*!
+  The same as Extract with f_interp_order 0, but with the interpolation
+  weights of all states computed up front by ExtractWeights. The weighted
+  table columns are summed directly into sga with the frequency as the
+  innermost loop, so nothing is allocated.
+
+  \param[out] sga The scalar gas absorption coefficients [1/m]. Dimension:
+              [n_states, n_species, n_f_grid].
+
+  \param[in] select_abs_species If not empty, only this species is set,
+             all others are zero.
+
+  \param[in] weights The interpolation weights of the states, from
+             ExtractWeights.
+
+  \param[in] abs_vmrs The VMRs [absolute number] the weights were computed
+             for. Dimension: [n_states, n_species].
+
+  \date 2026-10-18
+*/
+void GasAbsLookup::Extract(Tensor3View sga,
+                           const ArrayOfSpeciesTag& select_abs_species,
+                           const GasAbsLookupWeights& weights,
+                           ConstMatrixView abs_vmrs) const {
+  const Index n_species = species.nelem();
+  const Index n_f_grid = f_grid.nelem();
+  const Index n_nls_pert = nls_pert.nelem();
+  const Index n_states = weights.n.nelem();
+  const Index np = weights.np;
+  const Index nt = weights.nt;
+
+  ARTS_USER_ERROR_IF(not is_size(sga, n_states, n_species, n_f_grid),
+                     "The output must have dimension [", n_states, ", ",
+                     n_species, ", ", n_f_grid, "]")
+  ARTS_ASSERT(is_size(abs_vmrs, n_states, n_species))
+
+  const ConstTensor4View table = XsecView();
+  const bool single = storage == Options::LookupStorage::Float;
+
+  for (Index is = 0; is < n_states; is++) {
+    // fpi marks the position of the first profile of the current species
+    Index fpi = 0;
+    for (Index si = 0; si < n_species; si++) {
+      const bool do_VMR = std::find(nonlinear_species.begin(),
+                                    nonlinear_species.end(),
+                                    si) != nonlinear_species.end();
+      const Index this_fpi = fpi;
+      fpi += do_VMR ? n_nls_pert : 1;
+
+      VectorView res = sga(is, si, joker);
+      res = 0;
+
+      // Species not stored in the table are zero, as in Extract
+      if (species[si].Zeeman() or species[si].FreeElectrons() or
+          species[si].Particles()) {
+        ARTS_USER_ERROR_IF(do_VMR,
+                           "Problem with gas absorption lookup table.\n"
+                           "VMR interpolation is not allowed for species \"",
+                           species[si][0].Name(), "\"")
+        continue;
+      }
+
+      if (select_abs_species.nelem() and species[si] != select_abs_species)
+        continue;
+
+      const Index nv = do_VMR ? weights.nv : 1;
+      for (Index k = 0; k < np; k++) {
+        const Index ip = weights.ppos[is] + k;
+        for (Index it = 0; it < nt; it++) {
+          const Index ti = weights.tpos[is * np + k] + it;
+          const Numeric w_pt = weights.pw(is, k) * weights.tw(is, k, it);
+          for (Index iv = 0; iv < nv; iv++) {
+            const Index vi =
+                this_fpi + (do_VMR ? weights.vpos[is * np + k] + iv : 0);
+            const Numeric w = do_VMR ? w_pt * weights.vw(is, k, iv) : w_pt;
+
+            if (single) {
+              const float* x = xsec_float.data() + float_pos(ti, vi, 0, ip);
+              const Index stride = xsec_float_shape[3];
+              for (Index f = 0; f < n_f_grid; f++) res[f] += w * x[f * stride];
+            } else {
+              const ConstVectorView x = table(ti, vi, joker, ip);
+              for (Index f = 0; f < n_f_grid; f++) res[f] += w * x[f];
+            }
+          }
+        }
+      }
+
+      res *= weights.n[is] * abs_vmrs(is, si);
+    }
+  }
+}
+
+//! A copy of the cross sections in double precision.
+/*!
+  Works for all storages of the table.
+
+  \return The cross sections.
+
+  \date 2026-10-18
+*/
+Tensor4 GasAbsLookup::XsecCopy() const {
+  if (storage == Options::LookupStorage::Double) return Tensor4{XsecView()};
+
+  Tensor4 out(xsec_float_shape[0],
+              xsec_float_shape[1],
+              xsec_float_shape[2],
+              xsec_float_shape[3]);
+  for (Index a = 0; a < out.nbooks(); ++a)
+    for (Index b = 0; b < out.npages(); ++b)
+      for (Index c = 0; c < out.nrows(); ++c)
+        for (Index d = 0; d < out.ncols(); ++d)
+          out(a, b, c, d) = xsec_float[float_pos(a, b, c, d)];
+  return out;
+}
+
+//! Change the precision the cross sections are stored in.
+/*!
+  Converting to Float rounds the cross sections to single precision.
+  A memory mapped table is copied to memory in the new precision.
+
+  \param[in] new_storage The new storage.
+
+  \date 2026-10-18
+*/
+void GasAbsLookup::SetStorage(Options::LookupStorage new_storage) {
+  if (new_storage == storage and not xsec_map) return;
+
+  switch (new_storage) {
+    case Options::LookupStorage::Double:
+      xsec = XsecCopy();
+      xsec_float = std::vector<float>{};
+      xsec_float_shape = {0, 0, 0, 0};
+      break;
+    case Options::LookupStorage::Float: {
+      const ConstTensor4View table = XsecView();
+      xsec_float_shape = {
+          table.nbooks(), table.npages(), table.nrows(), table.ncols()};
+      xsec_float.resize(table.size());
+      for (Index a = 0; a < table.nbooks(); ++a)
+        for (Index b = 0; b < table.npages(); ++b)
+          for (Index c = 0; c < table.nrows(); ++c)
+            for (Index d = 0; d < table.ncols(); ++d)
+              xsec_float[float_pos(a, b, c, d)] =
+                  static_cast<float>(table(a, b, c, d));
+      xsec = Tensor4{};
+    } break;
+    case Options::LookupStorage::FINAL:
+      ARTS_ASSERT(false, "Bad storage")
+  }
+
+  xsec_map.reset();
+  storage = new_storage;
+}
+
+//! Write the table in the memory mappable format.
+/*!
+  Everything but the cross sections is written as an ASCII XML file, with
+  empty cross sections. The cross sections are written to a separate file
+  with the extension ".xsec" added, see MappedXsec.
+
+  \param[in] filename  The name of the XML file.
+  \param[in] verbosity Verbosity settings.
+
+  \date 2026-10-18
+*/
+void GasAbsLookup::WriteMapped(const String& filename,
+                               const Verbosity& verbosity) const {
+  CREATE_OUT2;
+
+  GasAbsLookup meta;
+  meta.species = species;
+  meta.nonlinear_species = nonlinear_species;
+  meta.f_grid = f_grid;
+  meta.p_grid = p_grid;
+  meta.vmrs_ref = vmrs_ref;
+  meta.t_ref = t_ref;
+  meta.t_pert = t_pert;
+  meta.nls_pert = nls_pert;
+
+  xml_write_to_file(filename, meta, FILE_TYPE_ASCII, 0, verbosity);
+
+  const String xsec_filename{add_basedir(filename) + ".xsec"};
+  out2 << "  Writing " << xsec_filename << '\n';
+  // The mapped format is always double precision
+  const Tensor4 single =
+      storage == Options::LookupStorage::Float ? XsecCopy() : Tensor4{};
+  MappedXsec::write(xsec_filename,
+                    storage == Options::LookupStorage::Float
+                        ? ConstTensor4View{single}
+                        : XsecView());
+}
+
+//! Read a table written by WriteMapped.
+/*!
+  The cross sections are memory mapped, not read. They are paged in when
+  they are accessed, typically by Adapt.
+
+  \param[in] filename  The name of the XML file.
+  \param[in] verbosity Verbosity settings.
+
+  \date 2026-10-18
+*/
+void GasAbsLookup::ReadMapped(const String& filename,
+                              const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  String xml_file = filename;
+  find_xml_file(xml_file, verbosity);
+
+  GasAbsLookup meta;
+  xml_read_from_file_base(xml_file, meta, verbosity);
+
+  const String xsec_filename{xml_file + ".xsec"};
+  out2 << "  Mapping " << xsec_filename << '\n';
+  meta.xsec_map = std::make_shared<const MappedXsec>(xsec_filename);
+
+  const Index a = std::max<Index>(meta.t_pert.nelem(), 1);
+  const Index b =
+      meta.species.nelem() +
+      meta.nonlinear_species.nelem() * (meta.nls_pert.nelem() - 1);
+  ARTS_USER_ERROR_IF(
+      not is_size(meta.xsec_map->Xsec(), a, b, meta.f_grid.nelem(),
+                  meta.p_grid.nelem()),
+      "The cross sections in ", xsec_filename,
+      " do not match the table in ", xml_file, ".\n"
+      "Expected shape: [", a, ", ", b, ", ", meta.f_grid.nelem(), ", ",
+      meta.p_grid.nelem(), "]")
+
+  *this = std::move(meta);
+}
+
 const Vector& GasAbsLookup::GetFgrid() const { return f_grid; }
 
 const Vector& GasAbsLookup::GetPgrid() const { return p_grid; }
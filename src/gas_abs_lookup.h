@@ -9,6 +9,12 @@
 #ifndef gas_abs_lookup_h
 #define gas_abs_lookup_h
 
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arts_options.h"
 #include "species_tags.h"
 #include "absorption.h"
 #include "interp.h"
@@ -21,6 +27,84 @@ class bofstream;
 class Agenda;
 class Workspace;
 
+//! A read-only memory map of the cross sections of a lookup table.
+/*! The file starts with a header of MappedXsec::header_size bytes:
+    an 8-byte magic string, the format version, an endianness marker,
+    the four dimensions of the cross section tensor, and the offset of the
+    data, all as 64-bit integers. The cross sections follow as native
+    doubles in the same order as in GasAbsLookup::xsec, so all frequencies
+    and pressures of one species and temperature perturbation are
+    contiguous.
+
+    The mapping is shared, so all processes on a node that map the same
+    file share one copy of the data in the page cache. Pages are only read
+    from disk when they are first accessed. */
+class MappedXsec {
+ public:
+  //! The current version of the file format.
+  static constexpr std::int64_t version = 1;
+
+  //! The size of the header, and the offset of the data.
+  static constexpr std::int64_t header_size = 4096;
+
+  // Documentation is with the implementation!
+  explicit MappedXsec(const String& filename);
+
+  MappedXsec(const MappedXsec&) = delete;
+  MappedXsec& operator=(const MappedXsec&) = delete;
+
+  ~MappedXsec();
+
+  //! The mapped cross sections.
+  ConstTensor4View Xsec() const {
+    return ConstTensor4View{const_cast<Numeric*>(data), shape};
+  }
+
+  // Documentation is with the implementation!
+  static void write(const String& filename, ConstTensor4View xsec);
+
+ private:
+  //! The start of the mapping.
+  void* addr{nullptr};
+
+  //! The length of the mapping [bytes].
+  std::size_t length{0};
+
+  //! The start of the cross sections in the mapping.
+  const Numeric* data{nullptr};
+
+  //! The shape of the cross sections.
+  std::array<Index, 4> shape{0, 0, 0, 0};
+};
+
+//! Interpolation weights of atmospheric states in a lookup table.
+/*! Set by GasAbsLookup::ExtractWeights and used by the batched
+    GasAbsLookup::Extract.  Temperature and H2O are interpolated separately
+    for each pressure level of the pressure interpolation, so their grid
+    positions and weights have one entry per state and pressure level.
+
+    The members keep their size between uses, so a weights object that is
+    reused for as many states is not reallocated. */
+struct GasAbsLookupWeights {
+  //! Number of weights per state in pressure, temperature and H2O
+  Index np{0}, nt{0}, nv{0};
+
+  //! Pressure grid position of each state
+  ArrayOfIndex ppos;
+
+  //! Temperature and H2O grid positions [state * np + pressure level]
+  ArrayOfIndex tpos, vpos;
+
+  //! Pressure weights [state, pressure level]
+  Matrix pw;
+
+  //! Temperature and H2O weights [state, pressure level, weight]
+  Tensor3 tw, vw;
+
+  //! Number density of each state [1/m^3]
+  Vector n;
+};
+
 //! An absorption lookup table.
 /*! This class holds an absorption lookup table, as well as all
     information that is necessary to use the table to extract
@@ -36,7 +120,9 @@ class GasAbsLookup {
         t_ref(),
         t_pert(),
         nls_pert(),
-        xsec() { /* Nothing to do here */
+        xsec(),
+        xsec_map(),
+        xsec_float() { /* Nothing to do here */
   }
 
   // Documentation is with the implementation!
@@ -57,6 +143,29 @@ class GasAbsLookup {
                ConstVectorView new_f_grid,
                const Numeric& extpolfac) const;
 
+  // Documentation is with the implementation!
+  void ExtractWeights(GasAbsLookupWeights& weights,
+                      const Index& p_interp_order,
+                      const Index& t_interp_order,
+                      const Index& h2o_interp_order,
+                      ConstVectorView p,
+                      ConstVectorView T,
+                      ConstMatrixView abs_vmrs,
+                      ConstVectorView new_f_grid,
+                      const Numeric& extpolfac) const;
+
+  // Documentation is with the implementation!
+  void Extract(Tensor3View sga,
+               const ArrayOfSpeciesTag& select_abs_species,
+               const GasAbsLookupWeights& weights,
+               ConstMatrixView abs_vmrs) const;
+
+  // Documentation is with the implementation!
+  void WriteMapped(const String& filename, const Verbosity& verbosity) const;
+
+  // Documentation is with the implementation!
+  void ReadMapped(const String& filename, const Verbosity& verbosity);
+
   const Vector& GetFgrid() const;
 
   const Vector& GetPgrid() const;
@@ -93,6 +202,9 @@ class GasAbsLookup {
       const Agenda& abs_xsec_agenda,
       // GIN
       const Numeric& lowest_vmr,
+      const String& storage,
+      const String& checkpoint_file,
+      const Numeric& checkpoint_interval,
       // Verbosity object:
       const Verbosity& verbosity);
 
@@ -159,8 +271,40 @@ class GasAbsLookup {
   /** The vector of perturbations for the VMRs of the nonlinear species */
   Vector& NLSPert() {return nls_pert;}
   
-  /** Absorption cross sections */
-  Tensor4& Xsec() {return xsec;}
+  /** Absorption cross sections
+   *
+   * A memory mapped table is copied to memory first, since the
+   * mapping is read-only.  A table in single precision must be converted
+   * with SetStorage first, or be read with XsecCopy.
+   */
+  Tensor4& Xsec() {
+    ARTS_USER_ERROR_IF(storage == Options::LookupStorage::Float,
+                       "The cross sections of the lookup table are stored "
+                       "in single precision.\n"
+                       "Set the storage to Double to access them.")
+    if (xsec_map) {
+      xsec = xsec_map->Xsec();
+      xsec_map.reset();
+    }
+    return xsec;
+  }
+
+  /** Absorption cross sections, from memory or from the mapped file
+   *
+   * Empty if the table is stored in single precision.
+   */
+  ConstTensor4View XsecView() const {
+    return xsec_map ? xsec_map->Xsec() : ConstTensor4View{xsec};
+  }
+
+  // Documentation is with the implementation!
+  Tensor4 XsecCopy() const;
+
+  /** The precision the cross sections are stored in */
+  Options::LookupStorage Storage() const { return storage; }
+
+  // Documentation is with the implementation!
+  void SetStorage(Options::LookupStorage new_storage);
 
   friend ostream& operator<<(ostream& os, const GasAbsLookup& gal);
   
@@ -278,8 +422,36 @@ class GasAbsLookup {
 
     Note that the last three dimensions are identical to the
     dimensions of abs_per_tg in ARTS-1-0. This should simplify
-    computation of the lookup table with the old ARTS version.  */
+    computation of the lookup table with the old ARTS version.
+
+    Empty if the table is memory mapped, see xsec_map.  */
   Tensor4 xsec;
+
+  //! Memory mapped absorption cross sections.
+  /*! If set, this replaces xsec. Copies of the table share the mapping,
+    which is released with the last copy. */
+  std::shared_ptr<const MappedXsec> xsec_map;
+
+  //! The precision the cross sections are stored in.
+  /*! If Float, xsec is empty and the cross sections are kept in
+    xsec_float instead. */
+  Options::LookupStorage storage{Options::LookupStorage::Double};
+
+  //! Single precision absorption cross sections.
+  /*! Same order as xsec, with dimensions xsec_float_shape. Halves the
+    memory and the memory bandwidth of the table. Cross sections below
+    the smallest normal float, about 1e-38 m^2, lose relative precision. */
+  std::vector<float> xsec_float;
+
+  //! The dimensions of xsec_float.
+  std::array<Index, 4> xsec_float_shape{0, 0, 0, 0};
+
+  //! Index into xsec_float.
+  Index float_pos(Index a, Index b, Index c, Index d) const noexcept {
+    return ((a * xsec_float_shape[1] + b) * xsec_float_shape[2] + c) *
+               xsec_float_shape[3] +
+           d;
+  }
 };
 
 #endif  //  gas_abs_lookup_h
@@ -21,37 +21,6 @@
 #include "species.h"
 #include "wigner_functions.h"
 
-#if DO_FAST_WIGNER
-#define WIGNER3 fw3jja6
-#define WIGNER6 fw6jja
-#else
-#define WIGNER3 wig3jj
-#define WIGNER6 wig6jj
-#endif
-
-Numeric wig3(const Rational& a,
-             const Rational& b,
-             const Rational& c,
-             const Rational& d,
-             const Rational& e,
-             const Rational& f) noexcept {
-  return WIGNER3(
-      a.toInt(2), b.toInt(2), c.toInt(2), d.toInt(2), e.toInt(2), f.toInt(2));
-}
-
-Numeric wig6(const Rational& a,
-             const Rational& b,
-             const Rational& c,
-             const Rational& d,
-             const Rational& e,
-             const Rational& f) noexcept {
-  return WIGNER6(
-      a.toInt(2), b.toInt(2), c.toInt(2), d.toInt(2), e.toInt(2), f.toInt(2));
-}
-
-#undef WIGNER3
-#undef WIGNER6
-
 namespace Absorption::LineMixing {
 EquivalentLines::EquivalentLines(const ComplexMatrix& W,
                                  const Vector& pop,
@@ -166,7 +135,7 @@ namespace Makarov2020etal {
  * @return The reduced dipole
  */
 Numeric reduced_dipole(const Rational Ju, const Rational Jl, const Rational N) {
-  return (iseven(Jl + N) ? 1 : -1) * sqrt(6 * (2*Jl + 1) * (2*Ju + 1)) * wigner6j(1, 1, 1, Jl, Ju, N);
+  return (iseven(Jl + N) ? 1 : -1) * sqrt(6 * (2*Jl + 1) * (2*Ju + 1)) * wigner6j_cached(1, 1, 1, Jl, Ju, N);
 };
 } // namespace Makarov2020etal
 
@@ -395,7 +364,6 @@ void relaxation_matrix_offdiagonal(
     return out;
   }();
 
-  wig_thread_temp_init(maxL);
   for (Index i = 0; i < n; i++) {
     auto& J = band.lines[sorting[i]].localquanta.val[QuantumNumberType::J];
     auto& N = band.lines[sorting[i]].localquanta.val[QuantumNumberType::N];
@@ -428,11 +396,11 @@ void relaxation_matrix_offdiagonal(
           wigner_limits(wigner3j_limits<3>(Ni_p, Ni),
                         {Rational(2), std::numeric_limits<Index>::max()});
       for (Rational L = L0; L <= L1; L += 2) {
-        const Numeric a = wig3(Ni_p, Ni, L, 0, 0, 0);
-        const Numeric b = wig3(Nf_p, Nf, L, 0, 0, 0);
-        const Numeric c = wig6(L, Ji, Ji_p, Si, Ni_p, Ni);
-        const Numeric d = wig6(L, Jf, Jf_p, Sf, Nf_p, Nf);
-        const Numeric e = wig6(L, Ji, Ji_p, 1, Jf_p, Jf);
+        const Numeric a = wigner3j_cached(Ni_p, Ni, L, 0, 0, 0);
+        const Numeric b = wigner3j_cached(Nf_p, Nf, L, 0, 0, 0);
+        const Numeric c = wigner6j_cached(L, Ji, Ji_p, Si, Ni_p, Ni);
+        const Numeric d = wigner6j_cached(L, Jf, Jf_p, Sf, Nf_p, Nf);
+        const Numeric e = wigner6j_cached(L, Ji, Ji_p, 1, Jf_p, Jf);
         sum += a * b * c * d * e * Numeric(2 * L + 1) * Q[L.toIndex()] / Om[L.toIndex()];
       }
       sum *= scl * Om[Ni.toIndex()];
@@ -442,9 +410,6 @@ void relaxation_matrix_offdiagonal(
       W(j, i) = sum * std::exp((erot(Nf_p) - erot(Nf)) / kelvin2joule(T));
     }
   }
-  wig_temp_free();
-
-  ARTS_USER_ERROR_IF(errno == EDOM, "Cannot compute the wigner symbols")
 
   // Sum rule correction
   for (Index i = 0; i < n; i++) {
@@ -547,9 +512,9 @@ void relaxation_matrix_offdiagonal(MatrixView W,
       
       Numeric sum=0;
       for (; L<=Lf; L+=2) {
-        const Numeric a = wigner3j(Ji_p, L, Ji, li, 0, -li);
-        const Numeric b = wigner3j(Jf_p, L, Jf, lf, 0, -lf);
-        const Numeric c = wigner6j(Ji, Jf, 1, Jf_p, Ji_p, L);
+        const Numeric a = wigner3j_cached(Ji_p, L, Ji, li, 0, -li);
+        const Numeric b = wigner3j_cached(Jf_p, L, Jf, lf, 0, -lf);
+        const Numeric c = wigner6j_cached(Ji, Jf, 1, Jf_p, Ji_p, L);
         const Numeric QL = rovib_data.Q(L, T, band.T0, erot(L));
         const Numeric ECS = rovib_data.Omega(T, band.T0, band.SpeciesMass(), erot(L), erot(L-2));
         sum += a * b * c * Numeric(2 * L + 1) * QL / ECS;
@@ -4,13 +4,16 @@
 #include "partfun.h"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
+#include <unordered_map>
 
 #include "lineshape.h"
 #include "physics_funcs.h"
 #include "species.h"
 
 #include <Faddeeva/Faddeeva.hh>
+#include "faddeeva_weideman.h"
 
 using Constant::inv_pi;
 using Constant::inv_sqrt_pi;
@@ -25,6 +28,24 @@ constexpr Numeric ln_16 =
     2.772588722239781237668928485832706272302000537441021016482720037973574487879;
 
 namespace LineShape {
+/** The Faddeeva function w(z) by the selected algorithm
+ *
+ * @param[in] z Any complex number
+ * @param[in] faddeeva The algorithm
+ * @return w(z)
+ */
+Complex faddeeva_w(const Complex z,
+                   const Options::LblFaddeeva faddeeva) noexcept {
+  switch (faddeeva) {
+  case Options::LblFaddeeva::Weideman:
+    return Weideman::w(z);
+  case Options::LblFaddeeva::Reference: [[fallthrough]];
+  case Options::LblFaddeeva::FINAL: { /* Leave last */
+  }
+  }
+  return Faddeeva::w(z);
+}
+
 Complex Doppler::operator()(Numeric f) noexcept {
   x = (f - mF0) * invGD;
   F = invGD * inv_sqrt_pi * std::exp(-pow2(x));
@@ -33,14 +54,29 @@ Complex Doppler::operator()(Numeric f) noexcept {
 
 Complex Voigt::operator()(Numeric f) noexcept {
   real_val(z) = invGD * (f - mF0);
-  F = inv_sqrt_pi * invGD * Faddeeva::w(z);
+  F = inv_sqrt_pi * invGD * faddeeva_w(z, faddeeva);
+  dF = 2 * invGD * (Complex(0, inv_pi * invGD) - z * F);
+  return F;
+}
+
+Index Voigt::faddeeva_arguments(Complex &arg1, Complex &arg2,
+                                Numeric f) const noexcept {
+  arg1 = Complex(invGD * (f - mF0), z.imag());
+  arg2 = 0;
+  return 1;
+}
+
+Complex Voigt::operator()(Numeric f, Complex w1, Complex) noexcept {
+  real_val(z) = invGD * (f - mF0);
+  F = inv_sqrt_pi * invGD * w1;
   dF = 2 * invGD * (Complex(0, inv_pi * invGD) - z * F);
   return F;
 }
 
 SpeedDependentVoigt::SpeedDependentVoigt(Numeric F0_noshift, const Output &ls,
-                                         Numeric GD_div_F0, Numeric dZ) noexcept
-    : mF0(F0_noshift + dZ + ls.D0 - 1.5 * ls.D2),
+                                         Numeric GD_div_F0, Numeric dZ,
+                                         Options::LblFaddeeva faddeeva_) noexcept
+    : faddeeva(faddeeva_), mF0(F0_noshift + dZ + ls.D0 - 1.5 * ls.D2),
       invGD(sqrt_ln_2 / nonstd::abs(GD_div_F0 * mF0)),
       invc2(1.0 / Complex(ls.G2, ls.D2)), dx(Complex(ls.G0 - 1.5 * ls.G2, mF0)),
       x(dx * invc2), sqrty(invc2 / (2 * invGD)),
@@ -405,13 +441,25 @@ Complex SpeedDependentVoigt::dFdT(const Output &d, Numeric T) const noexcept {
 }
 
 Complex SpeedDependentVoigt::operator()(Numeric f) noexcept {
-  imag_val(dx) = mF0 - f;
-  x = dx * invc2;
-  update_calcs();
+  set_frequency(f);
   calc();
   return F;
 }
 
+Index SpeedDependentVoigt::faddeeva_arguments(Complex &arg1, Complex &arg2,
+                                              Numeric f) noexcept {
+  set_frequency(f);
+  return arguments(arg1, arg2);
+}
+
+Complex SpeedDependentVoigt::operator()(Numeric f, Complex w1_,
+                                        Complex w2_) noexcept {
+  Complex arg1, arg2;
+  faddeeva_arguments(arg1, arg2, f);
+  calc(w1_, w2_);
+  return F;
+}
+
 constexpr Numeric abs_squared(Complex z) noexcept {
   return pow2(z.real()) + pow2(z.imag());
 }
@@ -435,32 +483,62 @@ void SpeedDependentVoigt::update_calcs() noexcept {
     calcs = init(Complex(1, 1));
 }
 
-void SpeedDependentVoigt::calc() noexcept {
+void SpeedDependentVoigt::set_frequency(Numeric f) noexcept {
+  imag_val(dx) = mF0 - f;
+  x = dx * invc2;
+  update_calcs();
+}
+
+Index SpeedDependentVoigt::arguments(Complex &arg1, Complex &arg2) noexcept {
+  arg1 = 0;
+  arg2 = 0;
   switch (calcs) {
   case CalcType::Full:
     sq = std::sqrt(x + sqrty * sqrty);
-    w1 = Faddeeva::w(1i * (sq - sqrty));
-    w2 = Faddeeva::w(1i * (sq + sqrty));
+    arg1 = 1i * (sq - sqrty);
+    arg2 = 1i * (sq + sqrty);
+    return 2;
+  case CalcType::Voigt:
+    arg1 = 1i * dx * invGD;
+    return 1;
+  case CalcType::LowXandHighY:
+    sq = std::sqrt(x + sqrty * sqrty);
+    arg1 = 1i * dx * invGD;
+    arg2 = 1i * (sq + sqrty);
+    return 2;
+  case CalcType::LowYandLowX:
+    sq = std::sqrt(x);
+    arg1 = 1i * sq;
+    return 1;
+  case CalcType::LowYandHighX:
+    return 0;
+  }
+  return 0;
+}
+
+void SpeedDependentVoigt::calc(Complex w1_, Complex w2_) noexcept {
+  switch (calcs) {
+  case CalcType::Full:
+    w1 = w1_;
+    w2 = w2_;
     F = inv_sqrt_pi * invGD * (w1 - w2);
     dw1 = 2i * (inv_sqrt_pi - (sq - sqrty) * w1);
     dw2 = 2i * (inv_sqrt_pi - (sq + sqrty) * w2);
     break;
   case CalcType::Voigt:
-    w1 = Faddeeva::w(1i * dx * invGD);
+    w1 = w1_;
     F = inv_sqrt_pi * invGD * w1;
     dw1 = 2i * (inv_sqrt_pi - dx * invGD * w1);
     break;
   case CalcType::LowXandHighY:
-    sq = std::sqrt(x + sqrty * sqrty);
-    w1 = Faddeeva::w(1i * dx * invGD);
-    w2 = Faddeeva::w(1i * (sq + sqrty));
+    w1 = w1_;
+    w2 = w2_;
     F = inv_sqrt_pi * invGD * (w1 - w2);
     dw1 = 2i * (inv_sqrt_pi - dx * invGD * w1);
     dw2 = 2i * (inv_sqrt_pi - (sq + sqrty) * w2);
     break;
   case CalcType::LowYandLowX:
-    sq = std::sqrt(x);
-    w1 = Faddeeva::w(1i * sq);
+    w1 = w1_;
     F = 2 * inv_pi * invc2 * (1 - sqrt_pi * sq * w1);
     dw1 = 2i * (inv_sqrt_pi - sq * w1);
     break;
@@ -470,9 +548,17 @@ void SpeedDependentVoigt::calc() noexcept {
   }
 }
 
+void SpeedDependentVoigt::calc() noexcept {
+  Complex arg1, arg2;
+  const Index n = arguments(arg1, arg2);
+  calc(n > 0 ? faddeeva_w(arg1, faddeeva) : Complex{},
+       n > 1 ? faddeeva_w(arg2, faddeeva) : Complex{});
+}
+
 HartmannTran::HartmannTran(Numeric F0_noshift, const Output &ls,
-                           Numeric GD_div_F0, Numeric dZ) noexcept
-    : G0(ls.G0), D0(ls.D0), G2(ls.G2), D2(ls.D2), FVC(ls.FVC), ETA(ls.ETA),
+                           Numeric GD_div_F0, Numeric dZ,
+                           Options::LblFaddeeva faddeeva_) noexcept
+    : faddeeva(faddeeva_), G0(ls.G0), D0(ls.D0), G2(ls.G2), D2(ls.D2), FVC(ls.FVC), ETA(ls.ETA),
       mF0(F0_noshift + dZ + (1 - ls.ETA) * (ls.D0 - 1.5 * ls.D2)),
       invGD(sqrt_ln_2 / nonstd::abs(GD_div_F0 * mF0)),
       deltax(ls.FVC + (1 - ls.ETA) * (ls.G0 - 3 * ls.G2 / 2), mF0),
@@ -1743,14 +1829,24 @@ Complex HartmannTran::dFdT(const Output &d, Numeric T) const noexcept {
 }
 
 Complex HartmannTran::operator()(Numeric f) noexcept {
-  imag_val(deltax) = mF0 - f;
-  x = deltax / ((1 - ETA) * Complex(G2, D2));
-  sqrtxy = std::sqrt(x + sqrty * sqrty);
-  update_calcs();
+  set_frequency(f);
   calc();
   return F;
 }
 
+Index HartmannTran::faddeeva_arguments(Complex &arg1, Complex &arg2,
+                                       Numeric f) noexcept {
+  set_frequency(f);
+  return arguments(arg1, arg2);
+}
+
+Complex HartmannTran::operator()(Numeric f, Complex w1_, Complex w2_) noexcept {
+  Complex arg1, arg2;
+  faddeeva_arguments(arg1, arg2, f);
+  calc(w1_, w2_);
+  return F;
+}
+
 HartmannTran::CalcType HartmannTran::init(const Complex c2t) const noexcept {
   if (abs_squared(c2t) == 0)
     return CalcType::Noc2tHighZ; // nb. Value of high/low changes elsewhere
@@ -1768,13 +1864,54 @@ void HartmannTran::update_calcs() noexcept {
   calcs = init((1 - ETA) * Complex(G2, D2));
 }
 
-void HartmannTran::calc() noexcept {
+void HartmannTran::set_frequency(Numeric f) noexcept {
+  imag_val(deltax) = mF0 - f;
+  x = deltax / ((1 - ETA) * Complex(G2, D2));
+  sqrtxy = std::sqrt(x + sqrty * sqrty);
+  update_calcs();
+}
+
+Index HartmannTran::arguments(Complex &arg1, Complex &arg2) noexcept {
+  arg1 = 0;
+  arg2 = 0;
   switch (calcs) {
   case CalcType::Full:
     z1 = sqrtxy - sqrty;
     z2 = sqrtxy + sqrty;
-    w1 = Faddeeva::w(1i * z1);
-    w2 = Faddeeva::w(1i * z2);
+    arg1 = 1i * z1;
+    arg2 = 1i * z2;
+    return 2;
+  case CalcType::Noc2tLowZ:
+  case CalcType::Noc2tHighZ:
+    z1 = deltax * invGD;
+    arg1 = 1i * z1;
+    return 1;
+  case CalcType::LowXandHighY:
+    z1 = deltax * invGD;
+    z2 = sqrtxy + sqrty;
+    arg1 = 1i * z1;
+    arg2 = 1i * z2;
+    return 2;
+  case CalcType::LowYandLowX:
+    sqrtx = std::sqrt(x);
+    z1 = sqrtxy;
+    z2 = sqrtx;
+    arg1 = 1i * z1;
+    arg2 = 1i * z2;
+    return 2;
+  case CalcType::LowYandHighX:
+    z1 = sqrtxy;
+    arg1 = 1i * z1;
+    return 1;
+  }
+  return 0;
+}
+
+void HartmannTran::calc(Complex w1_, Complex w2_) noexcept {
+  switch (calcs) {
+  case CalcType::Full:
+    w1 = w1_;
+    w2 = w2_;
     A = sqrt_pi * invGD * (w1 - w2);
     B = (-1 + sqrt_pi / (2 * sqrty) * (1 - pow2(z1)) * w1 -
          sqrt_pi / (2 * sqrty) * (1 - pow2(z2)) * w2) /
@@ -1782,8 +1919,7 @@ void HartmannTran::calc() noexcept {
     break;
   case CalcType::Noc2tLowZ:
   case CalcType::Noc2tHighZ:
-    z1 = deltax * invGD;
-    w1 = Faddeeva::w(1i * z1);
+    w1 = w1_;
     A = sqrt_pi * invGD * w1;
     if (abs_squared(z1) < 16e6) {
       calcs = CalcType::Noc2tLowZ;
@@ -1794,19 +1930,14 @@ void HartmannTran::calc() noexcept {
     }
     break;
   case CalcType::LowXandHighY:
-    z1 = deltax * invGD;
-    z2 = sqrtxy + sqrty;
-    w1 = Faddeeva::w(1i * z1);
-    w2 = Faddeeva::w(1i * z2);
+    w1 = w1_;
+    w2 = w2_;
     A = sqrt_pi * invGD * (w1 - w2);
     B = invGD * (sqrt_pi * w1 + 1 / z1 / 2 - 3 / pow3(z1) / 4);
     break;
   case CalcType::LowYandLowX:
-    sqrtx = std::sqrt(x);
-    z1 = sqrtxy;
-    z2 = sqrtx;
-    w1 = Faddeeva::w(1i * z1);
-    w2 = Faddeeva::w(1i * z2);
+    w1 = w1_;
+    w2 = w2_;
     A = (2 * sqrt_pi / ((1 - ETA) * Complex(G2, D2))) * (inv_sqrt_pi - z2 * w2);
     B = (1 / ((1 - ETA) * Complex(G2, D2))) *
         (-1 +
@@ -1814,8 +1945,7 @@ void HartmannTran::calc() noexcept {
          2 * sqrt_pi * z1 * w1);
     break;
   case CalcType::LowYandHighX:
-    z1 = sqrtxy;
-    w1 = Faddeeva::w(1i * z1);
+    w1 = w1_;
     A = (1 / ((1 - ETA) * Complex(G2, D2))) * (1 / x - 3 / pow2(x) / 2);
     B = (1 / ((1 - ETA) * Complex(G2, D2))) *
         (-1 + (1 - x - 2 * sqrty * sqrty) * (1 / x - 3 / pow2(x) / 2) +
@@ -1830,6 +1960,13 @@ void HartmannTran::calc() noexcept {
   F = inv_pi * A / K;
 }
 
+void HartmannTran::calc() noexcept {
+  Complex arg1, arg2;
+  const Index n = arguments(arg1, arg2);
+  calc(n > 0 ? faddeeva_w(arg1, faddeeva) : Complex{},
+       n > 1 ? faddeeva_w(arg2, faddeeva) : Complex{});
+}
+
 VanVleckHuber::VanVleckHuber(Numeric F0, Numeric T) noexcept
     : c1(Constant::h / (2.0 * Constant::k * T)), tanh_c1f0(std::tanh(c1 * F0)),
       inv_denom(1.0 / (F0 * tanh_c1f0)) {}
@@ -2213,6 +2350,7 @@ struct ComputeValues {
   const Index jac_size;
   const Index max_jac_size;
   const bool do_nlte;
+  std::array<ComplexVector, 2> *const faddeeva;
 
   [[nodiscard]] Index jac_pos(Index iv, Index ij) const noexcept {
     return jac_size * iv + ij;
@@ -2221,21 +2359,23 @@ struct ComputeValues {
   ComputeValues(ComplexVector &F_, ComplexMatrix &dF_, ComplexVector &N_,
                 ComplexMatrix &dN_, const Vector &f_grid, const Index start,
                 const Index nv, const ArrayOfDerivatives &derivs_,
-                const bool do_nlte_) noexcept
+                const bool do_nlte_,
+                std::array<ComplexVector, 2> &faddeeva_) noexcept
       : F(F_.data_handle() + start),
         dF(dF_.data_handle() + start * derivs_.size()),
         N(N_.data_handle() + start),
         dN(dN_.data_handle() + start * derivs_.size()),
         f(f_grid.data_handle() + start), size(nv), derivs(derivs_),
         jac_size(derivs_.size()), max_jac_size(active_nelem(derivs)),
-        do_nlte(do_nlte_) {}
+        do_nlte(do_nlte_), faddeeva(&faddeeva_) {}
 
   ComputeValues(Complex &F_, std::vector<Complex> &dF_, Complex &N_,
                 std::vector<Complex> &dN_, const Numeric &f_lim,
                 const ArrayOfDerivatives &derivs_, const bool do_nlte_) noexcept
       : F(&F_), dF(dF_.data()), N(&N_), dN(dN_.data()), f(&f_lim), size(1),
         derivs(derivs_), jac_size(derivs.nelem()),
-        max_jac_size(active_nelem(derivs)), do_nlte(do_nlte_) {}
+        max_jac_size(active_nelem(derivs)), do_nlte(do_nlte_),
+        faddeeva(nullptr) {}
 
   ComputeValues &operator-=(const ComputeValues &cut) ARTS_NOEXCEPT {
     ARTS_ASSERT(cut.size == 1, "Not a cutoff limit")
@@ -2315,9 +2455,44 @@ Complex Calculator::operator()(Numeric f) noexcept {
   return std::visit([f](auto &&LS) { return LS(f); }, ls);
 }
 
+bool Calculator::faddeeva_block() const noexcept {
+  return std::visit(
+      [](auto &&LS) {
+        if constexpr (requires { LS.faddeeva; })
+          return LS.faddeeva == Options::LblFaddeeva::Weideman;
+        else
+          return false;
+      },
+      ls);
+}
+
+Index Calculator::faddeeva_arguments(Complex &arg1, Complex &arg2,
+                                     Numeric f) noexcept {
+  return std::visit(
+      [&](auto &&LS) -> Index {
+        if constexpr (requires { LS.faddeeva_arguments(arg1, arg2, f); })
+          return LS.faddeeva_arguments(arg1, arg2, f);
+        else
+          return 0;
+      },
+      ls);
+}
+
+Complex Calculator::operator()(Numeric f, Complex w1, Complex w2) noexcept {
+  return std::visit(
+      [&](auto &&LS) -> Complex {
+        if constexpr (requires { LS(f, w1, w2); })
+          return LS(f, w1, w2);
+        else
+          return LS(f);
+      },
+      ls);
+}
+
 Calculator::Calculator(const Type type, const Numeric F0, const Output &X,
                        const Numeric DC, const Numeric DZ,
-                       bool manually_mirrored) noexcept
+                       bool manually_mirrored,
+                       Options::LblFaddeeva faddeeva) noexcept
     : ls(Noshape{}) {
   if (not manually_mirrored) {
     switch (type) {
@@ -2330,15 +2505,15 @@ Calculator::Calculator(const Type type, const Numeric F0, const Output &X,
       break;
     case Type::VP: [[fallthrough]];
     case Type::SplitVP:
-      ls = Voigt(F0, X, DC, DZ);
+      ls = Voigt(F0, X, DC, DZ, faddeeva);
       break;
     case Type::SDVP: [[fallthrough]];
     case Type::SplitSDVP:
-      ls = SpeedDependentVoigt(F0, X, DC, DZ);
+      ls = SpeedDependentVoigt(F0, X, DC, DZ, faddeeva);
       break;
     case Type::HTP: [[fallthrough]];
     case Type::SplitHTP:
-      ls = HartmannTran(F0, X, DC, DZ);
+      ls = HartmannTran(F0, X, DC, DZ, faddeeva);
       break;
     case Type::FINAL: { /*leave last*/
     }
@@ -2348,17 +2523,17 @@ Calculator::Calculator(const Type type, const Numeric F0, const Output &X,
 
 Calculator::Calculator(const Absorption::MirroringType mirror, const Type type,
                        const Numeric F0, const Output &X, const Numeric DC,
-                       const Numeric DZ)
+                       const Numeric DZ, Options::LblFaddeeva faddeeva)
     : ls(Noshape{}) {
   switch (mirror) {
   case Absorption::MirroringType::Lorentz:
     ls = Lorentz(-F0, mirroredOutput(X));
     break;
   case Absorption::MirroringType::SameAsLineShape:
-    *this = {type, -F0, mirroredOutput(X), -DC, -DZ, false};
+    *this = {type, -F0, mirroredOutput(X), -DC, -DZ, false, faddeeva};
     break;
   case Absorption::MirroringType::Manual:
-    *this = {type, F0, mirroredOutput(X), -DC, -DZ, false};
+    *this = {type, F0, mirroredOutput(X), -DC, -DZ, false, faddeeva};
     break;
   case Absorption::MirroringType::None:
     break;
@@ -2598,6 +2773,49 @@ IntensityCalculator::IntensityCalculator(
           InternalDerivativesSetupImpl(X, X2 __VA_OPT__(, __VA_ARGS__))        \
               InternalDerivativesSetupImpl(X, X3 __VA_OPT__(, __VA_ARGS__))
 
+/** The line shape at all frequencies of a frequency loop
+ *
+ * For line shapes with Calculator::faddeeva_block(), the arguments of the
+ * Faddeeva function are gathered for all frequencies first, and w(z) is then
+ * evaluated for the whole block by the vectorized Weideman::w.  Other line
+ * shapes are called per frequency.
+ */
+class FaddeevaBlock {
+  Calculator &ls;
+  const Numeric *const f;
+  const Index nv;
+  ComplexVector *const w;
+  Index nw{0};
+
+ public:
+  /** Evaluates w(z) of the line shape for all frequencies if possible
+   *
+   * @param[in] ls_ The line shape calculator
+   * @param[in] com The frequencies and the scratch space
+   * @param[in] part The scratch space to use, one per calculator in the loop
+   */
+  FaddeevaBlock(Calculator &ls_, ComputeValues &com, Index part) noexcept
+      : ls(ls_), f(com.f), nv(com.size),
+        w(com.faddeeva ? &(*com.faddeeva)[part] : nullptr) {
+    if (not w or not ls.faddeeva_block()) return;
+
+    // Arguments in the first half and w(z) in the second half of the buffer
+    if (w->size() < 4 * nv) w->resize(4 * nv);
+    for (Index iv = 0; iv < nv; iv++) {
+      nw = std::max(nw, ls.faddeeva_arguments((*w)[iv], (*w)[nv + iv], f[iv]));
+    }
+
+    if (nw)
+      Weideman::w((*w)[Range(2 * nv, nw * nv)], (*w)[Range(0, nw * nv)]);
+  }
+
+  //! The line shape at the frequency index, see Calculator::operator()
+  Complex operator()(Index iv) noexcept {
+    if (nw == 0) return ls(f[iv]);
+    return ls(f[iv], (*w)[2 * nv + iv], nw > 1 ? (*w)[3 * nv + iv] : Complex{});
+  }
+};
+
 /** Cutoff frequency loop of the line shape call
  *
  * This simply adds to the four output vectors/matrices for
@@ -2675,14 +2893,17 @@ void cutoff_frequency_loop(ComputeValues &com, Calculator &ls,
   const Numeric Si = ls_str.S();
   const Numeric DNi = ls_str.N();
 
+  FaddeevaBlock ls_block(ls, com, 0);
+  FaddeevaBlock ls_mirr_block(ls_mirr, com, 1);
+
   for (Index iv = 0; iv < nv; iv++) {
     const Numeric f = com.f[iv];
 
     const Numeric Sn = ls_norm(f);
     const Numeric S = Sz * Sn * Si;
     const Numeric DS = Sz * Sn * DNi;
-    const Complex Fm = std::conj(ls_mirr(f) - ls_mirr_cut.F());
-    const Complex Fls = ls(f) - ls_cut.F() + Fm;
+    const Complex Fm = std::conj(ls_mirr_block(iv) - ls_mirr_cut.F());
+    const Complex Fls = ls_block(iv) - ls_cut.F() + Fm;
     com.F[iv] += S * LM * Fls;
     if (do_nlte) {
       com.N[iv] += DS * LM * Fls;
@@ -2898,14 +3119,17 @@ void frequency_loop(ComputeValues &com, Calculator &ls, Calculator &ls_mirr,
   const Numeric Si = ls_str.S();
   const Numeric DNi = ls_str.N();
 
+  FaddeevaBlock ls_block(ls, com, 0);
+  FaddeevaBlock ls_mirr_block(ls_mirr, com, 1);
+
   for (Index iv = 0; iv < nv; iv++) {
     const Numeric f = com.f[iv];
 
     const Numeric Sn = ls_norm(f);
     const Numeric S = Sz * Sn * Si;
     const Numeric DS = Sz * Sn * DNi;
-    const Complex Fm = std::conj(ls_mirr(f));
-    const Complex Fls = ls(f) + Fm;
+    const Complex Fm = std::conj(ls_mirr_block(iv));
+    const Complex Fls = ls_block(iv) + Fm;
     com.F[iv] += S * LM * Fls;
     if (do_nlte) {
       com.N[iv] += DS * LM * Fls;
@@ -3080,14 +3304,15 @@ void frequency_loop(ComputeValues &com, Calculator &ls, Calculator &ls_mirr,
  * @param[in] ls_str The line strength calculator. \f$ S_i \f$
  * @param[in] ls_norm The normalization calculator. \f$ S_n \f$
  * @param[in] derivs A list of pre-computed derivative values and keys
+ * @param[in] faddeeva_type Algorithm for the Faddeeva function
  */
 void cutoff_loop_sparse_linear(
     ComputeData &com, ComputeData &sparse_com, Normalizer ls_norm,
     const IntensityCalculator ls_str, const AbsorptionLines &band,
     const ArrayOfDerivatives &derivs, const Output X, const Numeric &T,
     const Numeric &H, const Numeric &sparse_lim, const Numeric &DC,
-    const Index i,
-    const Zeeman::Polarization zeeman_polarization) ARTS_NOEXCEPT {
+    const Index i, const Zeeman::Polarization zeeman_polarization,
+    const Options::LblFaddeeva faddeeva_type) ARTS_NOEXCEPT {
   // Basic settings
   const bool do_nlte = ls_str.do_nlte();
   const bool do_cutoff = band.cutoff not_eq Absorption::CutoffType::None;
@@ -3106,15 +3331,17 @@ void cutoff_loop_sparse_linear(
 
   // Get the compute data view
   ComputeValues comval(com.F, com.dF, com.N, com.dN, com.f_grid, dense_start,
-                       dense_size, derivs, do_nlte);
+                       dense_size, derivs, do_nlte, com.faddeeva);
 
   // Get views of the sparse data
   ComputeValues sparse_low_range(
       sparse_com.F, sparse_com.dF, sparse_com.N, sparse_com.dN,
-      sparse_com.f_grid, sparse_low_start, sparse_low_size, derivs, do_nlte);
+      sparse_com.f_grid, sparse_low_start, sparse_low_size, derivs, do_nlte,
+      sparse_com.faddeeva);
   ComputeValues sparse_upp_range(
       sparse_com.F, sparse_com.dF, sparse_com.N, sparse_com.dN,
-      sparse_com.f_grid, sparse_upp_start, sparse_upp_size, derivs, do_nlte);
+      sparse_com.f_grid, sparse_upp_start, sparse_upp_size, derivs, do_nlte,
+      sparse_com.faddeeva);
 
   const Index nz = band.ZeemanCount(i, zeeman_polarization);
   for (Index iz = 0; iz < nz; iz++) {
@@ -3122,9 +3349,10 @@ void cutoff_loop_sparse_linear(
     const Numeric Sz = band.ZeemanStrength(i, zeeman_polarization, iz);
     const Complex LM = Complex(1 + X.G, -X.Y);
     Calculator ls(band.lineshapetype, band.lines[i].F0, X, DC, dfdH * H,
-                  band.mirroring == Absorption::MirroringType::Manual);
+                  band.mirroring == Absorption::MirroringType::Manual,
+                  faddeeva_type);
     Calculator ls_mirr(band.mirroring, band.lineshapetype, band.lines[i].F0, X,
-                       DC, dfdH * H);
+                       DC, dfdH * H, faddeeva_type);
 
     if (do_cutoff) {
       // Initialize and set the cutoff values
@@ -3170,8 +3398,8 @@ void cutoff_loop_sparse_triple(
     const IntensityCalculator ls_str, const AbsorptionLines &band,
     const ArrayOfDerivatives &derivs, const Output X, const Numeric &T,
     const Numeric &H, const Numeric &sparse_lim, const Numeric &DC,
-    const Index i,
-    const Zeeman::Polarization zeeman_polarization) ARTS_NOEXCEPT {
+    const Index i, const Zeeman::Polarization zeeman_polarization,
+    const Options::LblFaddeeva faddeeva_type) ARTS_NOEXCEPT {
   // Basic settings
   const bool do_nlte = ls_str.do_nlte();
   const bool do_cutoff = band.cutoff not_eq Absorption::CutoffType::None;
@@ -3190,15 +3418,17 @@ void cutoff_loop_sparse_triple(
 
   // Get the compute data view
   ComputeValues comval(com.F, com.dF, com.N, com.dN, com.f_grid, dense_start,
-                       dense_size, derivs, do_nlte);
+                       dense_size, derivs, do_nlte, com.faddeeva);
 
   // Get views of the sparse data
   ComputeValues sparse_low_range(
       sparse_com.F, sparse_com.dF, sparse_com.N, sparse_com.dN,
-      sparse_com.f_grid, sparse_low_start, sparse_low_size, derivs, do_nlte);
+      sparse_com.f_grid, sparse_low_start, sparse_low_size, derivs, do_nlte,
+      sparse_com.faddeeva);
   ComputeValues sparse_upp_range(
       sparse_com.F, sparse_com.dF, sparse_com.N, sparse_com.dN,
-      sparse_com.f_grid, sparse_upp_start, sparse_upp_size, derivs, do_nlte);
+      sparse_com.f_grid, sparse_upp_start, sparse_upp_size, derivs, do_nlte,
+      sparse_com.faddeeva);
 
   const Index nz = band.ZeemanCount(i, zeeman_polarization);
   for (Index iz = 0; iz < nz; iz++) {
@@ -3206,9 +3436,10 @@ void cutoff_loop_sparse_triple(
     const Numeric Sz = band.ZeemanStrength(i, zeeman_polarization, iz);
     const Complex LM = Complex(1 + X.G, -X.Y);
     Calculator ls(band.lineshapetype, band.lines[i].F0, X, DC, dfdH * H,
-                  band.mirroring == Absorption::MirroringType::Manual);
+                  band.mirroring == Absorption::MirroringType::Manual,
+                  faddeeva_type);
     Calculator ls_mirr(band.mirroring, band.lineshapetype, band.lines[i].F0, X,
-                       DC, dfdH * H);
+                       DC, dfdH * H, faddeeva_type);
 
     if (do_cutoff) {
       // Initialize and set the cutoff values
@@ -3286,13 +3517,15 @@ void cutoff_loop_sparse_triple(
  * @param[in] ls_str The line strength calculator. \f$ S_i \f$
  * @param[in] ls_norm The normalization calculator. \f$ S_n \f$
  * @param[in] derivs A list of pre-computed derivative values and keys
+ * @param[in] faddeeva_type Algorithm for the Faddeeva function
  */
 void cutoff_loop(ComputeData &com, Normalizer ls_norm,
                  const IntensityCalculator ls_str, const AbsorptionLines &band,
                  const ArrayOfDerivatives &derivs, const Output X,
                  const Numeric &T, const Numeric &H, const Numeric &DC,
                  const Index i,
-                 const Zeeman::Polarization zeeman_polarization) ARTS_NOEXCEPT {
+                 const Zeeman::Polarization zeeman_polarization,
+                 const Options::LblFaddeeva faddeeva_type) ARTS_NOEXCEPT {
   // Basic settings
   const bool do_nlte = ls_str.do_nlte();
   const bool do_cutoff = band.cutoff not_eq Absorption::CutoffType::None;
@@ -3306,7 +3539,7 @@ void cutoff_loop(ComputeData &com, Normalizer ls_norm,
 
   // Get the compute data view
   ComputeValues comval(com.F, com.dF, com.N, com.dN, com.f_grid, cutstart,
-                       cutsize, derivs, do_nlte);
+                       cutsize, derivs, do_nlte, com.faddeeva);
 
   const Index nz = band.ZeemanCount(i, zeeman_polarization);
   for (Index iz = 0; iz < nz; iz++) {
@@ -3314,9 +3547,10 @@ void cutoff_loop(ComputeData &com, Normalizer ls_norm,
     const Numeric Sz = band.ZeemanStrength(i, zeeman_polarization, iz);
     const Complex LM = Complex(1 + X.G, -X.Y);
     Calculator ls(band.lineshapetype, band.lines[i].F0, X, DC, dfdH * H,
-                  band.mirroring == Absorption::MirroringType::Manual);
+                  band.mirroring == Absorption::MirroringType::Manual,
+                  faddeeva_type);
     Calculator ls_mirr(band.mirroring, band.lineshapetype, band.lines[i].F0, X,
-                       DC, dfdH * H);
+                       DC, dfdH * H, faddeeva_type);
 
     if (do_cutoff) {
       // Initialize and set the cutoff values
@@ -3335,6 +3569,410 @@ void cutoff_loop(ComputeData &com, Normalizer ls_norm,
   }
 }
 
+BandKernel::BandKernel(const AbsorptionLines &band)
+    : nl(band.NumLines()), nb(band.NumBroadeners()), T0(band.T0),
+      column_type(nb * nVars, TemperatureModel::None),
+      line_type(nb * nVars * nl, TemperatureModel::None),
+      coeffs(nb, nVars, ModelParameters::N, nl, 0) {
+  for (Index ib = 0; ib < nb; ib++) {
+    for (Index iv = 0; iv < nVars; iv++) {
+      const Index icol = ib * nVars + iv;
+      for (Index i = 0; i < nl; i++) {
+        const ModelParameters &mp = band.lines[i].lineshape[ib].Data()[iv];
+        line_type[icol * nl + i] = mp.type;
+        coeffs(ib, iv, 0, i) = mp.X0;
+        coeffs(ib, iv, 1, i) = mp.X1;
+        coeffs(ib, iv, 2, i) = mp.X2;
+        coeffs(ib, iv, 3, i) = mp.X3;
+
+        if (i == 0)
+          column_type[icol] = mp.type;
+        else if (column_type[icol] not_eq mp.type)
+          column_type[icol] = TemperatureModel::FINAL;
+      }
+    }
+  }
+}
+
+void BandKernel::evaluate(VectorView x, Index ib, Index iv,
+                          Numeric T) const noexcept {
+  using std::log;
+  using std::pow;
+
+  const Index icol = ib * nVars + iv;
+  const ConstVectorView X0 = coeffs(ib, iv, 0, joker);
+  const ConstVectorView X1 = coeffs(ib, iv, 1, joker);
+  const ConstVectorView X2 = coeffs(ib, iv, 2, joker);
+  const ConstVectorView X3 = coeffs(ib, iv, 3, joker);
+  const Numeric r = T0 / T;
+
+  // Same as ModelParameters::at but per column
+  switch (column_type[icol]) {
+  case TemperatureModel::None:
+    x = 0;
+    break;
+  case TemperatureModel::T0:
+    x = X0;
+    break;
+  case TemperatureModel::T1:
+    for (Index i = 0; i < nl; i++) x[i] = X0[i] * pow(r, X1[i]);
+    break;
+  case TemperatureModel::T2:
+    for (Index i = 0; i < nl; i++)
+      x[i] = X0[i] * pow(r, X1[i]) * (1 + X2[i] * log(T / T0));
+    break;
+  case TemperatureModel::T3:
+    for (Index i = 0; i < nl; i++) x[i] = X0[i] + X1[i] * (T - T0);
+    break;
+  case TemperatureModel::T4:
+    for (Index i = 0; i < nl; i++)
+      x[i] = (X0[i] + X1[i] * (r - 1.)) * pow(r, X2[i]);
+    break;
+  case TemperatureModel::T5:
+    for (Index i = 0; i < nl; i++) x[i] = X0[i] * pow(r, 0.25 + 1.5 * X1[i]);
+    break;
+  case TemperatureModel::DPL:
+    for (Index i = 0; i < nl; i++)
+      x[i] = X0[i] * pow(r, X1[i]) + X2[i] * pow(r, X3[i]);
+    break;
+  case TemperatureModel::POLY:
+    for (Index i = 0; i < nl; i++)
+      x[i] = X0[i] + T * (X1[i] + T * (X2[i] + T * X3[i]));
+    break;
+  case TemperatureModel::LM_AER: [[fallthrough]];
+  case TemperatureModel::FINAL:
+    for (Index i = 0; i < nl; i++)
+      x[i] = ModelParameters(line_type[icol * nl + i], X0[i], X1[i], X2[i],
+                             X3[i])
+                 .at(T, T0);
+    break;
+  }
+}
+
+/** The pressure scaling of a line shape variable
+ *
+ * Same as in SingleSpeciesModel::at
+ *
+ * @param[in] iv The variable index
+ * @param[in] P The pressure
+ * @return The scaling
+ */
+constexpr Numeric pressure_scaling(Index iv, Numeric P) noexcept {
+  switch (Variable(iv)) {
+  case Variable::ETA:
+    return 1;
+  case Variable::G: [[fallthrough]];
+  case Variable::DV:
+    return P * P;
+  default:
+    return P;
+  }
+}
+
+Index BandKernel::nbytes() const noexcept {
+  Index n = Index(sizeof(BandKernel)) + coeffs.size() * Index(sizeof(Numeric)) +
+            (column_type.nelem() + line_type.nelem()) *
+                Index(sizeof(TemperatureModel));
+  for (auto &entry : cache)
+    n += Index(entry.key.size() * sizeof(std::int64_t)) +
+         entry.X.size() * Index(sizeof(Numeric));
+  return n;
+}
+
+bool BandKernel::Matches(const AbsorptionLines &band) const noexcept {
+  if (band.NumLines() not_eq nl or band.NumBroadeners() not_eq nb or
+      band.T0 not_eq T0)
+    return false;
+
+  for (Index ib = 0; ib < nb; ib++) {
+    for (Index iv = 0; iv < nVars; iv++) {
+      const Index icol = ib * nVars + iv;
+      for (Index i = 0; i < nl; i++) {
+        const ModelParameters &mp = band.lines[i].lineshape[ib].Data()[iv];
+        if (line_type[icol * nl + i] not_eq mp.type or
+            coeffs(ib, iv, 0, i) not_eq mp.X0 or
+            coeffs(ib, iv, 1, i) not_eq mp.X1 or
+            coeffs(ib, iv, 2, i) not_eq mp.X2 or
+            coeffs(ib, iv, 3, i) not_eq mp.X3)
+          return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+void BandKernel::Cache(Numeric resolution) {
+  if (resolution == cache_resolution) return;
+
+  cache_resolution = resolution;
+  cache_pos = 0;
+  cache.clear();
+}
+
+std::vector<std::int64_t> BandKernel::cache_key(
+    Index tag, Numeric T, Numeric P, const ConstVectorView &vmrs) const {
+  std::vector<std::int64_t> key;
+  key.reserve(3 + 2 * vmrs.nelem());
+  key.push_back(tag);
+
+  const auto add = [&key, scl = cache_resolution > 0
+                                    ? 1.0 / std::log1p(cache_resolution)
+                                    : 0.0](Numeric x) {
+    if (scl == 0) {
+      key.push_back(std::bit_cast<std::int64_t>(x));
+    } else {
+      key.push_back(x > 0 ? 1 : x < 0 ? -1 : 0);
+      if (x not_eq 0) key.push_back(std::llround(std::log(std::abs(x)) * scl));
+    }
+  };
+
+  add(T);
+  add(P);
+  for (Numeric x : vmrs) add(x);
+  return key;
+}
+
+const Matrix *BandKernel::cache_find(
+    const std::vector<std::int64_t> &key) const {
+  for (auto &entry : cache)
+    if (entry.key == key) return &entry.X;
+  return nullptr;
+}
+
+void BandKernel::cache_add(std::vector<std::int64_t> &&key,
+                           const Matrix &X) const {
+  if (cache.size() < static_cast<std::size_t>(max_cache_size)) {
+    cache.push_back({std::move(key), X});
+  } else {
+    cache[cache_pos] = {std::move(key), X};
+    cache_pos = (cache_pos + 1) % max_cache_size;
+  }
+}
+
+void BandKernel::ShapeParameters(Matrix &X, Numeric T, Numeric P,
+                                 const Vector &vmrs) const ARTS_NOEXCEPT {
+  ARTS_ASSERT(vmrs.nelem() == nb, "Must have one VMR per broadener")
+
+  std::vector<std::int64_t> key;
+  if (cache_resolution >= 0) {
+    key = cache_key(-1, T, P, vmrs);
+    if (const Matrix *cached = cache_find(key)) {
+      X = *cached;
+      return;
+    }
+  }
+
+  X.resize(nVars, nl);
+  X = 0;
+
+  Vector x(nl);
+  for (Index ib = 0; ib < nb; ib++) {
+    for (Index iv = 0; iv < nVars; iv++) {
+      evaluate(x, ib, iv, T);
+      const Numeric scl = vmrs[ib] * pressure_scaling(iv, P);
+      for (Index i = 0; i < nl; i++) X(iv, i) += scl * x[i];
+    }
+  }
+
+  if (cache_resolution >= 0) cache_add(std::move(key), X);
+}
+
+void BandKernel::ShapeParameters(Matrix &X, Numeric T, Numeric P,
+                                 Index ib) const ARTS_NOEXCEPT {
+  ARTS_ASSERT(ib >= 0 and ib < nb, "Bad broadener index")
+
+  std::vector<std::int64_t> key;
+  if (cache_resolution >= 0) {
+    key = cache_key(ib, T, P, Vector{});
+    if (const Matrix *cached = cache_find(key)) {
+      X = *cached;
+      return;
+    }
+  }
+
+  X.resize(nVars, nl);
+  for (Index iv = 0; iv < nVars; iv++) {
+    evaluate(X(iv, joker), ib, iv, T);
+    X(iv, joker) *= pressure_scaling(iv, P);
+  }
+
+  if (cache_resolution >= 0) cache_add(std::move(key), X);
+}
+
+/** A hash of the line shape data of a band
+ *
+ * Bands that BandKernel::Matches the same kernel have the same hash
+ *
+ * @param[in] band A band
+ * @return The hash
+ */
+std::size_t band_kernel_hash(const AbsorptionLines &band) noexcept {
+  std::size_t h = std::hash<Index>{}(band.NumLines());
+  const auto combine = [&h](std::size_t x) {
+    h ^= x + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+  };
+
+  combine(std::hash<Index>{}(band.NumBroadeners()));
+  combine(std::hash<Numeric>{}(band.T0));
+  for (auto &line : band.lines)
+    for (auto &ssm : line.lineshape.Data())
+      combine(std::hash<Numeric>{}(ssm.Data().front().X0));
+  return h;
+}
+
+const BandKernel &KernelCache::kernel(const AbsorptionLines &band,
+                                      Numeric resolution) {
+  const std::size_t h = band_kernel_hash(band);
+  auto [first, last] = kernels.equal_range(h);
+  auto it = std::find_if(first, last, [&band](auto &hk) {
+    return hk.second.kernel.Matches(band);
+  });
+
+  // Count the states the kernel has remembered since it was last found
+  if (it not_eq last) {
+    it->second.kernel.Cache(resolution);
+    const Index n = it->second.kernel.nbytes();
+    bytes += n - it->second.nbytes;
+    it->second.nbytes = n;
+  }
+
+  // Forget everything rather than grow without bound
+  if (bytes > max_bytes) {
+    kernels.clear();
+    bytes = 0;
+    it = last = kernels.end();
+  }
+
+  if (it == last) {
+    BandKernel kernel(band);
+    kernel.Cache(resolution);
+    const Index n = kernel.nbytes();
+    bytes += n;
+    it = kernels.emplace(h, Entry{std::move(kernel), n});
+  }
+
+  return it->second.kernel;
+}
+
+/** The shape parameters of a line from the output of BandKernel
+ *
+ * @param[in] X As from BandKernel::ShapeParameters
+ * @param[in] i The line index
+ * @return The shape parameters of line i
+ */
+Output kernel_output(const Matrix &X, Index i) noexcept {
+  static_assert(nVars == 9, "Must update");
+  return {X(0, i), X(1, i), X(2, i), X(3, i), X(4, i),
+          X(5, i), X(6, i), X(7, i), X(8, i)};
+}
+
+bool plain_voigt_band(const AbsorptionLines &band,
+                      const ArrayOfRetrievalQuantity &jacobian_quantities,
+                      const Zeeman::Polarization zeeman_polarization,
+                      const Options::LblSpeedup speedup_type) noexcept {
+  return band.lineshapetype == Type::VP and
+         band.mirroring == Absorption::MirroringType::None and
+         band.normalization == Absorption::NormalizationType::None and
+         band.population == Absorption::PopulationType::LTE and
+         zeeman_polarization == Zeeman::Polarization::None and
+         speedup_type == Options::LblSpeedup::None and
+         std::none_of(jacobian_quantities.begin(), jacobian_quantities.end(),
+                      [](auto &deriv) { return deriv.propmattype(); });
+}
+
+/** Loop all the lines of a plain Voigt band using the SoA kernel
+ *
+ * Gives the same cross-section as line_loop() for bands where
+ * plain_voigt_band() is true.  The line centers, Doppler widths, and scaled
+ * strengths of all lines are set up column by column from the kernel, and
+ * each line is then added to the cross-section in a loop over its
+ * frequencies that needs no per-frequency dispatch.  With the Weideman
+ * algorithm, w(z) is evaluated for all frequencies of a line at once.
+ *
+ * @param[in,out] com The cross-section
+ * @param[in] band The absorption band
+ * @param[in] kernel The SoA line shape data of band
+ * @param[in] nlte A map of NLTE data
+ * @param[in] vmrs The band volume mixing ratio
+ * @param[in] P The atmospheric pressure
+ * @param[in] T The atmospheric temperature
+ * @param[in] QT The partition function at the temperature
+ * @param[in] QT0 The partition function at the reference temperature
+ * @param[in] dQTdT The derivative of the partition function at the temperature
+ * wrt temperature
+ * @param[in] r The number density of the isotopologue
+ * @param[in] drdSELFVMR The derivative of r wrt the VMR of the species
+ * @param[in] drdT The derivative of r wrt temperature
+ * @param[in] faddeeva_type Algorithm for the Faddeeva function
+ */
+void kernel_line_loop(ComputeData &com, const AbsorptionLines &band,
+                      const BandKernel &kernel, const EnergyLevelMap &nlte,
+                      const Vector &vmrs, const Numeric &P, const Numeric &T,
+                      const Numeric QT, const Numeric QT0, const Numeric dQTdT,
+                      const Numeric r, const Numeric drdSELFVMR,
+                      const Numeric drdT,
+                      const Options::LblFaddeeva faddeeva_type) ARTS_NOEXCEPT {
+  const Index nl = band.NumLines();
+  const bool do_cutoff = band.cutoff not_eq Absorption::CutoffType::None;
+
+  Matrix X;
+  kernel.ShapeParameters(X, T, P, vmrs);
+  if (not band.DoLineMixing(P)) {
+    X(Index(Variable::Y), joker) = 0;
+    X(Index(Variable::G), joker) = 0;
+    X(Index(Variable::DV), joker) = 0;
+  }
+  const ConstVectorView G0 = X(Index(Variable::G0), joker);
+  const ConstVectorView D0 = X(Index(Variable::D0), joker);
+  const ConstVectorView Y = X(Index(Variable::Y), joker);
+  const ConstVectorView G = X(Index(Variable::G), joker);
+  const ConstVectorView DV = X(Index(Variable::DV), joker);
+
+  // Same as the Voigt and IntensityCalculator of each line
+  const Numeric DC = band.DopplerConstant(T);
+  Vector mF0(nl), invGD(nl);
+  for (Index i = 0; i < nl; i++) mF0[i] = band.lines[i].F0 + D0[i] + DV[i];
+  for (Index i = 0; i < nl; i++) invGD[i] = 1.0 / std::abs(DC * mF0[i]);
+
+  ComplexVector SLM(nl);
+  for (Index i = 0; i < nl; i++) {
+    SLM[i] = IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT, nlte,
+                                 band, i)
+                 .S() *
+             Complex(1 + G[i], -Y[i]);
+  }
+
+  // Arguments of w(z) in the first half and w(z) in the second half
+  ComplexVector &w = com.faddeeva[0];
+  if (w.size() < 2 * com.f_grid.size()) w.resize(2 * com.f_grid.size());
+
+  const Numeric *const f = com.f_grid.data_handle();
+  for (Index i = 0; i < nl; i++) {
+    const Numeric fu = band.CutoffFreq(i, D0[i]);
+    const Numeric fl = band.CutoffFreqMinus(i, D0[i]);
+    const auto [start, nv] = limited_range(fl, fu, com.f_grid);
+    if (not nv) continue;
+
+    const Numeric y = invGD[i] * G0[i];
+    for (Index iv = 0; iv < nv; iv++)
+      w[iv] = Complex(invGD[i] * (f[start + iv] - mF0[i]), y);
+
+    if (faddeeva_type == Options::LblFaddeeva::Weideman) {
+      Weideman::w(w[Range(nv, nv)], w[Range(0, nv)]);
+    } else {
+      for (Index iv = 0; iv < nv; iv++)
+        w[nv + iv] = faddeeva_w(w[iv], faddeeva_type);
+    }
+
+    const Numeric c = inv_sqrt_pi * invGD[i];
+    const Complex zcut(invGD[i] * (fu - mF0[i]), y);
+    const Complex Fcut = do_cutoff ? c * faddeeva_w(zcut, faddeeva_type) : 0;
+    for (Index iv = 0; iv < nv; iv++)
+      com.F[start + iv] += SLM[i] * (c * w[nv + iv] - Fcut);
+  }
+}
+
 /** Loop all the lines of the band
  *
  * This function is not possible to run on multiple cores.  Such parallelisms
@@ -3365,6 +4003,8 @@ void cutoff_loop(ComputeData &com, Normalizer ls_norm,
  * @param[in] QT0 The partition function at the reference temperature
  * @param[in] dQTdT The derivative of the partition function at the temperature
  * wrt temperature
+ * @param[in] faddeeva_type Algorithm for the Faddeeva function
+ * @param[in] kernel If not nullptr, the SoA line shape data of band
  */
 void line_loop(ComputeData &com, ComputeData &sparse_com,
                const AbsorptionLines &band,
@@ -3375,18 +4015,37 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
                const Numeric QT, const Numeric QT0, const Numeric dQTdT,
                const Numeric r, const Numeric drdSELFVMR, const Numeric drdT,
                const Zeeman::Polarization zeeman_polarization,
-               const Options::LblSpeedup speedup_type) ARTS_NOEXCEPT {
+               const Options::LblSpeedup speedup_type,
+               const Options::LblFaddeeva faddeeva_type,
+               const BandKernel *kernel) ARTS_NOEXCEPT {
   const Index nj = jacobian_quantities.nelem();
   const Index nl = band.NumLines();
 
+  if (kernel and plain_voigt_band(band, jacobian_quantities,
+                                  zeeman_polarization, speedup_type)) {
+    kernel_line_loop(com, band, *kernel, nlte, vmrs, P, T, QT, QT0, dQTdT, r,
+                     drdSELFVMR, drdT, faddeeva_type);
+    return;
+  }
+
   // Derivatives are allocated ahead of all loops
   ArrayOfDerivatives derivs(nj);
 
   // Doppler constant
   const Numeric DC = band.DopplerConstant(T);
 
+  // Line mixing is turned off above the pressure limit
+  const bool no_linemixing = not band.DoLineMixing(P);
+
   if (not independent_per_broadener(band.lineshapetype)) {
+    Matrix Xs;
+    if (kernel) kernel->ShapeParameters(Xs, T, P, vmrs);
+
     for (Index i = 0; i < nl; i++) {
+      const Output X = kernel
+                           ? kernel_output(Xs, i).no_linemixing(no_linemixing)
+                           : band.ShapeParameters(i, T, P, vmrs);
+
       // Pre-compute the derivatives
       for (Index ij = 0; ij < nj; ij++) {
         const auto &deriv = jacobian_quantities[ij];
@@ -3437,8 +4096,8 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
         cutoff_loop(com, Normalizer(band.normalization, band.lines[i].F0, T),
                     IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT,
                                         nlte, band, i),
-                    band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, DC,
-                    i, zeeman_polarization);
+                    band, derivs, X, T, H, DC,
+                    i, zeeman_polarization, faddeeva_type);
         break;
       case Options::LblSpeedup::QuadraticIndependent:
         cutoff_loop_sparse_triple(
@@ -3446,8 +4105,8 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
             Normalizer(band.normalization, band.lines[i].F0, T),
             IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT, nlte,
                                 band, i),
-            band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, sparse_lim,
-            DC, i, zeeman_polarization);
+            band, derivs, X, T, H, sparse_lim,
+            DC, i, zeeman_polarization, faddeeva_type);
         break;
       case Options::LblSpeedup::LinearIndependent:
         cutoff_loop_sparse_linear(
@@ -3455,16 +4114,24 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
             Normalizer(band.normalization, band.lines[i].F0, T),
             IntensityCalculator(T, QT, QT0, dQTdT, r, drdSELFVMR, drdT, nlte,
                                 band, i),
-            band, derivs, band.ShapeParameters(i, T, P, vmrs), T, H, sparse_lim,
-            DC, i, zeeman_polarization);
+            band, derivs, X, T, H, sparse_lim,
+            DC, i, zeeman_polarization, faddeeva_type);
         break;
       case Options::LblSpeedup::FINAL: { /* Leave last */
       }
       }
     }
   } else {
+    ArrayOfMatrix Xs(kernel ? band.NumBroadeners() : 0);
+    for (Index ib = 0; ib < Xs.nelem(); ib++)
+      kernel->ShapeParameters(Xs[ib], T, P, ib);
+
     for (Index i = 0; i < nl; i++) {
       for (Index ib=0; ib<band.NumBroadeners(); ib++) {
+        const Output X =
+            kernel ? kernel_output(Xs[ib], i).no_linemixing(no_linemixing)
+                   : band.ShapeParameters(i, T, P, ib);
+
         // Pre-compute the derivatives
         for (Index ij = 0; ij < nj; ij++) {
           const auto &deriv = jacobian_quantities[ij];
@@ -3521,22 +4188,22 @@ void line_loop(ComputeData &com, ComputeData &sparse_com,
         switch (speedup_type) {
         case Options::LblSpeedup::None:
           cutoff_loop(com, Normalizer(band.normalization, band.lines[i].F0, T),
-                      ls_str, band, derivs, band.ShapeParameters(i, T, P, ib),
-                      T, H, DC, i, zeeman_polarization);
+                      ls_str, band, derivs, X,
+                      T, H, DC, i, zeeman_polarization, faddeeva_type);
           break;
         case Options::LblSpeedup::QuadraticIndependent:
           cutoff_loop_sparse_triple(
               com, sparse_com,
               Normalizer(band.normalization, band.lines[i].F0, T), ls_str, band,
-              derivs, band.ShapeParameters(i, T, P, ib), T, H, sparse_lim, DC,
-              i, zeeman_polarization);
+              derivs, X, T, H, sparse_lim, DC,
+              i, zeeman_polarization, faddeeva_type);
           break;
         case Options::LblSpeedup::LinearIndependent:
           cutoff_loop_sparse_linear(
               com, sparse_com,
               Normalizer(band.normalization, band.lines[i].F0, T), ls_str, band,
-              derivs, band.ShapeParameters(i, T, P, ib), T, H, sparse_lim, DC,
-              i, zeeman_polarization);
+              derivs, X, T, H, sparse_lim, DC,
+              i, zeeman_polarization, faddeeva_type);
           break;
         case Options::LblSpeedup::FINAL: { /* Leave last */
         }
@@ -3555,7 +4222,9 @@ void compute(ComputeData &com, ComputeData &sparse_com,
              const Numeric &H, const Numeric &sparse_lim,
              const Zeeman::Polarization zeeman_polarization,
              const Options::LblSpeedup speedup_type,
-             const bool robust) ARTS_NOEXCEPT {
+             const bool robust,
+             const Options::LblFaddeeva faddeeva_type,
+             const BandKernel *kernel) ARTS_NOEXCEPT {
   [[maybe_unused]] const Index nj = jacobian_quantities.nelem();
   const Index nl = band.NumLines();
   const Index nv = com.f_grid.nelem();
@@ -3604,7 +4273,7 @@ void compute(ComputeData &com, ComputeData &sparse_com,
               dsingle_partition_function_dT(T, band.Isotopologue()),
               self_vmr * dnumdensdVMR, dnumdensdVMR,
               self_vmr * isot_ratio * dnumber_density_dt(P, T),
-              zeeman_polarization, speedup_type);
+              zeeman_polarization, speedup_type, faddeeva_type, kernel);
 
     com_safe.enforce_positive_absorption();
     sparse_com_safe.enforce_positive_absorption();
@@ -3619,7 +4288,7 @@ void compute(ComputeData &com, ComputeData &sparse_com,
               dsingle_partition_function_dT(T, band.Isotopologue()),
               self_vmr * dnumdensdVMR, dnumdensdVMR,
               self_vmr * isot_ratio * dnumber_density_dt(P, T),
-              zeeman_polarization, speedup_type);
+              zeeman_polarization, speedup_type, faddeeva_type, kernel);
   }
 }
 
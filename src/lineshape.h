@@ -1,10 +1,15 @@
 #ifndef lineshapes_h
 #define lineshapes_h
 
+#include <array>
+#include <cstdint>
 #include <string_view>
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "arts_conversions.h"
+#include "cache_pool.h"
 #include "energylevelmap.h"
 #include "linescaling.h"
 #include "nonstd.h"
@@ -125,16 +130,20 @@ struct Voigt {
   Numeric mF0;
   Numeric invGD;
   Complex z;
+  Options::LblFaddeeva faddeeva;
 
   constexpr Voigt(Numeric F0_noshift,
                   const Output &ls,
                   Numeric DC,
-                  Numeric dZ) noexcept
+                  Numeric dZ,
+                  Options::LblFaddeeva faddeeva_ =
+                      Options::LblFaddeeva::Reference) noexcept
       : F(),
         dF(),
         mF0(F0_noshift + dZ + ls.D0 + ls.DV),
         invGD(1.0 / nonstd::abs(DC * mF0)),
-        z(invGD * Complex(-mF0, ls.G0)) {}
+        z(invGD * Complex(-mF0, ls.G0)),
+        faddeeva(faddeeva_) {}
 
   [[nodiscard]] constexpr Complex dFdf() const noexcept { return dF; }
   [[nodiscard]] constexpr Complex dFdF0() const noexcept { return -dF; }
@@ -166,6 +175,23 @@ struct Voigt {
 
   Complex operator()(Numeric f) noexcept;
 
+  /** Sets the argument of the Faddeeva function at f
+   *
+   * @param[out] arg1 The argument of w(z)
+   * @param[out] arg2 Set to 0, it is not used
+   * @param[in] f The frequency
+   * @return The number of arguments used, 1
+   */
+  Index faddeeva_arguments(Complex &arg1, Complex &arg2, Numeric f) const noexcept;
+
+  /** Call operator on frequency with w(z) of faddeeva_arguments()
+   *
+   * @param[in] f The frequency
+   * @param[in] w1 w(z) of the first argument
+   * @return The line shape
+   */
+  Complex operator()(Numeric f, Complex w1, Complex) noexcept;
+
   [[nodiscard]] bool OK() const noexcept { return invGD > 0; }
 };  // Voigt
 
@@ -181,6 +207,7 @@ struct SpeedDependentVoigt {
   };
 
   Complex F;
+  Options::LblFaddeeva faddeeva;
 
   Numeric mF0;
   Numeric invGD;
@@ -198,7 +225,9 @@ struct SpeedDependentVoigt {
   SpeedDependentVoigt(Numeric F0_noshift,
                       const Output &ls,
                       Numeric GD_div_F0,
-                      Numeric dZ) noexcept;
+                      Numeric dZ,
+                      Options::LblFaddeeva faddeeva_ =
+                          Options::LblFaddeeva::Reference) noexcept;
 
   [[nodiscard]] Complex dFdf() const noexcept;
   [[nodiscard]] Complex dFdF0() const noexcept;
@@ -215,8 +244,29 @@ struct SpeedDependentVoigt {
 
   Complex operator()(Numeric f) noexcept;
 
+  /** Sets the state at f and the arguments of the Faddeeva function
+   *
+   * @param[out] arg1 The first argument of w(z), 0 if not used
+   * @param[out] arg2 The second argument of w(z), 0 if not used
+   * @param[in] f The frequency
+   * @return The number of arguments used, 0, 1, or 2
+   */
+  Index faddeeva_arguments(Complex &arg1, Complex &arg2, Numeric f) noexcept;
+
+  /** Call operator on frequency with w(z) of faddeeva_arguments()
+   *
+   * @param[in] f The frequency
+   * @param[in] w1_ w(z) of the first argument
+   * @param[in] w2_ w(z) of the second argument
+   * @return The line shape
+   */
+  Complex operator()(Numeric f, Complex w1_, Complex w2_) noexcept;
+
   [[nodiscard]] CalcType init(const Complex c2) const noexcept;
   void update_calcs() noexcept;
+  void set_frequency(Numeric f) noexcept;
+  Index arguments(Complex &arg1, Complex &arg2) noexcept;
+  void calc(Complex w1_, Complex w2_) noexcept;
   void calc() noexcept;
 };  // SpeedDependentVoigt
 
@@ -233,6 +283,7 @@ struct HartmannTran {
   };
 
   Complex F;
+  Options::LblFaddeeva faddeeva;
 
   Numeric G0;
   Numeric D0;
@@ -263,7 +314,9 @@ struct HartmannTran {
   HartmannTran(Numeric F0_noshift,
                const Output &ls,
                Numeric GD_div_F0,
-               Numeric dZ) noexcept;
+               Numeric dZ,
+               Options::LblFaddeeva faddeeva_ =
+                   Options::LblFaddeeva::Reference) noexcept;
 
   [[nodiscard]] Complex dFdf() const noexcept;
   [[nodiscard]] Complex dFdF0() const noexcept;
@@ -280,8 +333,29 @@ struct HartmannTran {
 
   Complex operator()(Numeric f) noexcept;
 
+  /** Sets the state at f and the arguments of the Faddeeva function
+   *
+   * @param[out] arg1 The first argument of w(z), 0 if not used
+   * @param[out] arg2 The second argument of w(z), 0 if not used
+   * @param[in] f The frequency
+   * @return The number of arguments used, 0, 1, or 2
+   */
+  Index faddeeva_arguments(Complex &arg1, Complex &arg2, Numeric f) noexcept;
+
+  /** Call operator on frequency with w(z) of faddeeva_arguments()
+   *
+   * @param[in] f The frequency
+   * @param[in] w1_ w(z) of the first argument
+   * @param[in] w2_ w(z) of the second argument
+   * @return The line shape
+   */
+  Complex operator()(Numeric f, Complex w1_, Complex w2_) noexcept;
+
   [[nodiscard]] CalcType init(const Complex c2t) const noexcept;
   void update_calcs() noexcept;
+  void set_frequency(Numeric f) noexcept;
+  Index arguments(Complex &arg1, Complex &arg2) noexcept;
+  void calc(Complex w1_, Complex w2_) noexcept;
   void calc() noexcept;
 };  // HartmannTran
 
@@ -702,19 +776,50 @@ class Calculator {
   //! Call operator on frequency.  Must call this before any of the derivatives
   Complex operator()(Numeric f) noexcept;
 
+  /** Whether the Faddeeva function is evaluated for many frequencies at once
+   *
+   * True for the Voigt-like line shapes with the Weideman algorithm, see
+   * faddeeva_arguments()
+   */
+  [[nodiscard]] bool faddeeva_block() const noexcept;
+
+  /** Sets the arguments of the Faddeeva function at f
+   *
+   * @param[out] arg1 The first argument of w(z), 0 if not used
+   * @param[out] arg2 The second argument of w(z), 0 if not used
+   * @param[in] f The frequency
+   * @return The number of arguments used, 0 for line shapes without w(z)
+   */
+  Index faddeeva_arguments(Complex &arg1, Complex &arg2, Numeric f) noexcept;
+
+  /** Call operator on frequency with w(z) of faddeeva_arguments()
+   *
+   * Gives the same results as operator()(f), but w(z) is not computed here.
+   * Must call this before any of the derivatives
+   *
+   * @param[in] f The frequency
+   * @param[in] w1 w(z) of the first argument
+   * @param[in] w2 w(z) of the second argument
+   * @return The line shape
+   */
+  Complex operator()(Numeric f, Complex w1, Complex w2) noexcept;
+
   Calculator(const Type type,
              const Numeric F0,
              const Output &X,
              const Numeric DC,
              const Numeric DZ,
-             bool manually_mirrored) noexcept;
+             bool manually_mirrored,
+             Options::LblFaddeeva faddeeva =
+                 Options::LblFaddeeva::Reference) noexcept;
 
   Calculator(const Absorption::MirroringType mirror,
              const Type type,
              const Numeric F0,
              const Output &X,
              const Numeric DC,
-             const Numeric DZ);
+             const Numeric DZ,
+             Options::LblFaddeeva faddeeva = Options::LblFaddeeva::Reference);
 };  // Calculator
 
 class Normalizer {
@@ -843,6 +948,9 @@ struct ComputeData {
   const Vector &f_grid;
   const bool do_nlte;
 
+  //! Scratch space for w(z) of a line and its mirror, see Calculator::faddeeva_block()
+  std::array<ComplexVector, 2> faddeeva{};
+
   ComputeData(const Vector &f,
               const ArrayOfRetrievalQuantity &jacobian_quantities,
               const bool nlte) noexcept
@@ -897,6 +1005,153 @@ struct ComputeData {
   }
 };
 
+/** Structure-of-arrays copy of the line shape data of a band
+ *
+ * Built once from an AbsorptionLines.  The coefficients of the line shape
+ * model are stored as one contiguous array per broadening species, variable,
+ * and coefficient, so that the shape parameters of all lines are evaluated
+ * column by column.  A column where all lines share a temperature model is
+ * evaluated without per-line dispatch.
+ *
+ * The kernel can optionally remember the shape parameters of the atmospheric
+ * states it has seen, see Cache().  The remembered states are not protected
+ * by any lock, so a caching kernel must not be shared between threads.
+ */
+class BandKernel {
+  Index nl;
+  Index nb;
+  Numeric T0;
+
+  //! The temperature model of a column, or FINAL if it differs between lines
+  Array<TemperatureModel> column_type;
+
+  //! The temperature model of each line, size nb * nVars * nl
+  Array<TemperatureModel> line_type;
+
+  //! The coefficients X0-X3, size nb x nVars x ModelParameters::N x nl
+  Tensor4 coeffs;
+
+  //! Shape parameters of a previously seen state
+  struct CacheEntry {
+    std::vector<std::int64_t> key;
+    Matrix X;
+  };
+
+  //! The relative resolution of the cache keys, negative if not caching
+  Numeric cache_resolution{-1};
+
+  //! The next entry to overwrite once the cache is full
+  mutable Index cache_pos{0};
+
+  mutable std::vector<CacheEntry> cache{};
+
+  void evaluate(VectorView x, Index ib, Index iv, Numeric T) const noexcept;
+
+  [[nodiscard]] std::vector<std::int64_t> cache_key(
+      Index tag, Numeric T, Numeric P, const ConstVectorView &vmrs) const;
+
+  const Matrix *cache_find(const std::vector<std::int64_t> &key) const;
+
+  void cache_add(std::vector<std::int64_t> &&key, const Matrix &X) const;
+
+ public:
+  //! The maximum number of states remembered by a caching kernel
+  static constexpr Index max_cache_size = 256;
+
+  explicit BandKernel(const AbsorptionLines &band);
+
+  [[nodiscard]] Index NumLines() const noexcept { return nl; }
+
+  [[nodiscard]] Index NumBroadeners() const noexcept { return nb; }
+
+  //! Size of the kernel and the shape parameters it remembers
+  [[nodiscard]] Index nbytes() const noexcept;
+
+  /** Checks if the kernel describes the line shape data of a band
+   *
+   * @param[in] band A band
+   * @return true if this kernel could have been built from band
+   */
+  [[nodiscard]] bool Matches(const AbsorptionLines &band) const noexcept;
+
+  /** Sets how the shape parameters of previous states are remembered
+   *
+   * With a negative resolution nothing is remembered.  With zero resolution
+   * the temperature, pressure, and VMRs must match exactly to reuse the shape
+   * parameters of a previous state.  Otherwise the states are binned on a
+   * logarithmic grid with the given relative resolution and all states in a
+   * bin reuse the shape parameters of the first state seen in that bin.
+   *
+   * Changing the resolution forgets all remembered states.
+   *
+   * @param[in] resolution The relative resolution of the state bins
+   */
+  void Cache(Numeric resolution);
+
+  /** Sets the shape parameters of all lines
+   *
+   * Same as AbsorptionLines::ShapeParameters(i, T, P, vmrs) for each line i
+   * but without the line mixing pressure limit
+   *
+   * @param[out] X The parameters, size nVars x NumLines()
+   * @param[in] T The temperature
+   * @param[in] P The pressure
+   * @param[in] vmrs The volume mixing ratios of the broadening species
+   */
+  void ShapeParameters(Matrix &X, Numeric T, Numeric P,
+                       const Vector &vmrs) const ARTS_NOEXCEPT;
+
+  /** Sets the shape parameters of all lines for a single broadener
+   *
+   * Same as AbsorptionLines::ShapeParameters(i, T, P, ib) for each line i
+   * but without the line mixing pressure limit
+   *
+   * @param[out] X The parameters, size nVars x NumLines()
+   * @param[in] T The temperature
+   * @param[in] P The pressure
+   * @param[in] ib The broadening species index
+   */
+  void ShapeParameters(Matrix &X, Numeric T, Numeric P,
+                       Index ib) const ARTS_NOEXCEPT;
+};
+
+/** The caching BandKernels of the bands seen during a calculation
+ *
+ * The kernels are found again by the line shape data of the band, so any band
+ * with the same line shape data reuses the kernel and the shape parameters it
+ * remembers, see BandKernel::Cache().  Borrow the caches from KernelCachePool,
+ * which keeps them while a KernelCachePool::Scope is alive.
+ */
+class KernelCache {
+  struct Entry {
+    BandKernel kernel;
+
+    //! The size of the kernel when it was last counted
+    Index nbytes;
+  };
+
+  std::unordered_multimap<std::size_t, Entry> kernels{};
+
+  Index bytes{0};
+
+ public:
+  //! Size at which all kernels are forgotten
+  static constexpr Index max_bytes = 64 * 1024 * 1024;
+
+  /** A caching kernel of the band
+   *
+   * @param[in] band The band
+   * @param[in] resolution The relative resolution of the state bins
+   * @return A kernel of the band, valid until the next call
+   */
+  const BandKernel &kernel(const AbsorptionLines &band, Numeric resolution);
+
+  //! Size of the kernels and the shape parameters they remember
+  [[nodiscard]] Index nbytes() const noexcept { return bytes; }
+};
+
+using KernelCachePool = CachePool<KernelCache>;
+
 /** Compute the absorption of an absorption band
  *
  * For a single line the line shape is
@@ -935,6 +1190,8 @@ struct ComputeData {
  * @param[in] zeeman_polarization Type of Zeeman polarization
  * @param[in] speedup_type Type of sparse grid interactions
  * @param[in] robust If true, a band with line mixing parameters guarantees non-negative output by allocating its own com and sparse_com for local calculations
+ * @param[in] faddeeva_type Algorithm for the Faddeeva function of the Voigt-like line shapes
+ * @param[in] kernel If not nullptr, the shape parameters are evaluated from this BandKernel of band
  */
 void compute(ComputeData &com,
              ComputeData &sparse_com,
@@ -951,7 +1208,30 @@ void compute(ComputeData &com,
              const Numeric &sparse_lim,
              const Zeeman::Polarization zeeman_polarization,
              const Options::LblSpeedup speedup_type,
-             const bool robust) ARTS_NOEXCEPT;
+             const bool robust,
+             const Options::LblFaddeeva faddeeva_type =
+                 Options::LblFaddeeva::Reference,
+             const BandKernel *kernel = nullptr) ARTS_NOEXCEPT;
+
+/** Whether compute() evaluates a band from the arrays of its BandKernel
+ *
+ * The lines of such a band are set up column by column from the kernel, and
+ * each line is added to the cross-section in a loop over its frequencies
+ * without per-frequency dispatch.  This is much faster than going line by
+ * line, so callers should pass a kernel for these bands even if they do not
+ * remember shape parameters between calls.
+ *
+ * @param[in] band The absorption band
+ * @param[in] jacobian_quantities As WSV
+ * @param[in] zeeman_polarization The type of Zeeman polarization to consider
+ * @param[in] speedup_type The sparse grid speedup
+ * @return true for Voigt lines in LTE without derivatives, Zeeman splitting,
+ * normalization, mirroring, or sparse grid
+ */
+bool plain_voigt_band(const AbsorptionLines &band,
+                      const ArrayOfRetrievalQuantity &jacobian_quantities,
+                      const Zeeman::Polarization zeeman_polarization,
+                      const Options::LblSpeedup speedup_type) noexcept;
 
 Vector linear_sparse_f_grid(const Vector &f_grid,
                             const Numeric &sparse_df) ARTS_NOEXCEPT;
@@ -12,6 +12,7 @@
 #include <cmath>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "absorption.h"
@@ -817,6 +818,41 @@ Vector create_sparse_f_grid_internal(const Vector& f_grid,
   return sparse_f_grid;
 }
 
+/** Adds the computed line-by-line data to the output variables
+ *
+ * The frequency range selects where in the outputs com is added, so that
+ * a com computed for a block of f_grid can be added directly
+ */
+void add_compute_data_internal(PropagationMatrix& propmat_clearsky,
+                               StokesVector& nlte_source,
+                               ArrayOfPropagationMatrix& dpropmat_clearsky_dx,
+                               ArrayOfStokesVector& dnlte_source_dx,
+                               const LineShape::ComputeData& com,
+                               const ArrayOfRetrievalQuantity& jacobian_quantities,
+                               const Range& frange) {
+  const Index nq = jacobian_quantities.nelem();
+
+  // Sum up the propagation matrix
+  propmat_clearsky.Kjj()[frange] += com.F.real();
+
+  // Sum up the Jacobian
+  for (Index j = 0; j < nq; j++) {
+    if (not jacobian_quantities[j].propmattype()) continue;
+    dpropmat_clearsky_dx[j].Kjj()[frange] += com.dF.real()(joker, j);
+  }
+
+  if (com.do_nlte) {
+    // Sum up the source vector
+    nlte_source.Kjj()[frange] += com.N.real();
+
+    // Sum up the Jacobian
+    for (Index j = 0; j < nq; j++) {
+      if (not jacobian_quantities[j].propmattype()) continue;
+      dnlte_source_dx[j].Kjj()[frange] += com.dN.real()(joker, j);
+    }
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddLines(  // Workspace reference:
     // WS Output:
@@ -842,6 +878,9 @@ void propmat_clearskyAddLines(  // Workspace reference:
     const Numeric& sparse_lim,
     const String& speedup_option,
     const Index& robust,
+    const String& parallel_option,
+    const String& faddeeva_option,
+    const Numeric& cache_resolution,
     // Verbosity object:
     const Verbosity& verbosity) {
   // Size of problem
@@ -900,13 +939,109 @@ void propmat_clearskyAddLines(  // Workspace reference:
   ARTS_USER_ERROR_IF(
       sparse_lim <= 0 and speedup_type not_eq Options::LblSpeedup::None,
       "Must have a sparse limit if you set speedup_option")
+  const Options::LblParallel parallel_type =
+      Options::toLblParallelOrThrow(parallel_option);
+  const Options::LblFaddeeva faddeeva_type =
+      Options::toLblFaddeevaOrThrow(faddeeva_option);
+  ARTS_USER_ERROR_IF(
+      parallel_type == Options::LblParallel::FrequencyBlocks and
+          speedup_type not_eq Options::LblSpeedup::None,
+      "Cannot combine lines_parallel_option \"FrequencyBlocks\" with a "
+      "speedup_option.\nThe sparse grid is shared by all frequency blocks.")
+
+  // The structure-of-arrays kernels are always faster for plain Voigt bands.
+  // Other bands only gain from them when they remember the shape parameters
+  // of earlier calls.  They are borrowed from the calculation this call is
+  // part of, e.g. a ybatchCalc
+  using KernelLease = std::optional<LineShape::KernelCachePool::Lease>;
+  const auto band_kernel =
+      [cache_resolution, &jacobian_quantities, speedup_type](
+          KernelLease& kernels,
+          const AbsorptionLines& band) -> const LineShape::BandKernel* {
+    if (cache_resolution < 0 and
+        not LineShape::plain_voigt_band(band,
+                                        jacobian_quantities,
+                                        Zeeman::Polarization::None,
+                                        speedup_type))
+      return nullptr;
+    if (not kernels) kernels.emplace();
+    return &(*kernels)->kernel(band, cache_resolution);
+  };
+
+  // Bands and frequency blocks use the threads that are left here, also
+  // when called from inside an iyb_calc or ppath point loop
+  const int nthreads = arts_omp_get_available_threads();
+
+  if (parallel_type == Options::LblParallel::FrequencyBlocks and
+      nthreads > 1) {
+    // Every thread owns a disjoint block of f_grid and computes all bands
+    // on it.  The results go straight into the output variables, so there
+    // are neither per-thread copies of the full data nor a reduction
+    const Index nblocks = std::min(nf, Index(nthreads));
+
+#pragma omp parallel for schedule(static) num_threads(int(nblocks))
+    for (Index iblock = 0; iblock < nblocks; iblock++) {
+      const Index fstart = (iblock * nf) / nblocks;
+      const Range frange(fstart, ((iblock + 1) * nf) / nblocks - fstart);
+      const Vector f_block{f_grid[frange]};
+      KernelLease kernels;
+
+      LineShape::ComputeData bcom(f_block, jacobian_quantities, nlte_do);
+      LineShape::ComputeData bsparse_com(
+          f_grid_sparse, jacobian_quantities, nlte_do);
+
+      for (Index ispecies = 0; ispecies < ns; ispecies++) {
+        if (select_abs_species.nelem() and
+            select_abs_species not_eq abs_species[ispecies])
+          continue;
+
+        // Skip it if there are no species or there is Zeeman requested
+        if (not abs_species[ispecies].nelem() or
+            abs_species[ispecies].Zeeman() or
+            not abs_lines_per_species[ispecies].nelem())
+          continue;
+
+        for (auto& band : abs_lines_per_species[ispecies]) {
+          LineShape::compute(bcom,
+                             bsparse_com,
+                             band,
+                             jacobian_quantities,
+                             rtp_nlte,
+                             band.BroadeningSpeciesVMR(rtp_vmr, abs_species),
+                             abs_species[ispecies],
+                             rtp_vmr[ispecies],
+                             isotopologue_ratios[band.Isotopologue()],
+                             rtp_pressure,
+                             rtp_temperature,
+                             0,
+                             sparse_lim,
+                             Zeeman::Polarization::None,
+                             speedup_type,
+                             robust not_eq 0,
+                             faddeeva_type,
+                             band_kernel(kernels, band));
+        }
+      }
+
+      add_compute_data_internal(propmat_clearsky,
+                                nlte_source,
+                                dpropmat_clearsky_dx,
+                                dnlte_source_dx,
+                                bcom,
+                                jacobian_quantities,
+                                frange);
+    }
+
+    return;
+  }
 
   // Calculations data
   LineShape::ComputeData com(f_grid, jacobian_quantities, nlte_do);
   LineShape::ComputeData sparse_com(
       f_grid_sparse, jacobian_quantities, nlte_do);
 
-  if (arts_omp_in_parallel()) {
+  if (nthreads == 1) {
+    KernelLease kernels;
     for (Index ispecies = 0; ispecies < ns; ispecies++) {
       if (select_abs_species.nelem() and
           select_abs_species not_eq abs_species[ispecies])
@@ -933,7 +1068,9 @@ void propmat_clearskyAddLines(  // Workspace reference:
                           sparse_lim,
                           Zeeman::Polarization::None,
                           speedup_type,
-                          robust not_eq 0);
+                          robust not_eq 0,
+                          faddeeva_type,
+                          band_kernel(kernels, band));
       }
     }
   } else {  // In parallel
@@ -944,15 +1081,17 @@ void propmat_clearskyAddLines(  // Workspace reference:
     }(abs_lines_per_species);
 
     std::vector<LineShape::ComputeData> vcom(
-        arts_omp_get_max_threads(),
+        nthreads,
         LineShape::ComputeData{
             f_grid, jacobian_quantities, static_cast<bool>(nlte_do)});
     std::vector<LineShape::ComputeData> vsparse_com(
-        arts_omp_get_max_threads(),
+        nthreads,
         LineShape::ComputeData{
             f_grid_sparse, jacobian_quantities, static_cast<bool>(nlte_do)});
 
-#pragma omp parallel for schedule(dynamic)
+    std::vector<KernelLease> vkernels(nthreads);
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
     for (Index i = 0; i < nbands; i++) {
       const auto [ispecies, iband] =
           flat_index(i, abs_species, abs_lines_per_species);
@@ -982,7 +1121,9 @@ void propmat_clearskyAddLines(  // Workspace reference:
                          sparse_lim,
                          Zeeman::Polarization::None,
                          speedup_type,
-                         robust not_eq 0);
+                         robust not_eq 0,
+                         faddeeva_type,
+                         band_kernel(vkernels[arts_omp_get_thread_num()], band));
     }
 
     for (auto& pcom: vcom) com += pcom;
@@ -1002,25 +1143,13 @@ void propmat_clearskyAddLines(  // Workspace reference:
     }
   }
 
-  // Sum up the propagation matrix
-  propmat_clearsky.Kjj() += com.F.real();
-
-  // Sum up the Jacobian
-  for (Index j = 0; j < nq; j++) {
-    if (not jacobian_quantities[j].propmattype()) continue;
-    dpropmat_clearsky_dx[j].Kjj() += com.dF.real()(joker, j);
-  }
-
-  if (nlte_do) {
-    // Sum up the source vector
-    nlte_source.Kjj() += com.N.real();
-
-    // Sum up the Jacobian
-    for (Index j = 0; j < nq; j++) {
-      if (not jacobian_quantities[j].propmattype()) continue;
-      dnlte_source_dx[j].Kjj() += com.dN.real()(joker, j);
-    }
-  }
+  add_compute_data_internal(propmat_clearsky,
+                            nlte_source,
+                            dpropmat_clearsky_dx,
+                            dnlte_source_dx,
+                            com,
+                            jacobian_quantities,
+                            Range(0, nf));
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -1237,6 +1366,9 @@ void propmat_clearsky_agendaAuto(// Workspace reference:
     const Numeric& force_p,
     const Numeric& force_t,
     const Index& ignore_errors,
+    const Numeric& lines_cache_resolution,
+    const String& lines_faddeeva_option,
+    const String& lines_parallel_option,
     const Numeric& lines_sparse_df,
     const Numeric& lines_sparse_lim,
     const String& lines_speedup_option,
@@ -1277,7 +1409,10 @@ void propmat_clearsky_agendaAuto(// Workspace reference:
                SetWsv{"lines_sparse_df", lines_sparse_df},
                SetWsv{"lines_sparse_lim", lines_sparse_lim},
                SetWsv{"lines_speedup_option", lines_speedup_option},
-               SetWsv{"no_negatives", no_negatives});
+               SetWsv{"no_negatives", no_negatives},
+               SetWsv{"lines_parallel_option", lines_parallel_option},
+               SetWsv{"lines_faddeeva_option", lines_faddeeva_option},
+               SetWsv{"lines_cache_resolution", lines_cache_resolution});
   }
 
   // propmat_clearskyAddZeeman
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <filesystem>
 #include <limits>
 #include <map>
 
@@ -15,10 +16,12 @@
 #include "agenda_class.h"
 #include "arts.h"
 #include "arts_omp.h"
+#include "artstime.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "cloudbox.h"
 #include "debug.h"
+#include "file.h"
 #include "gas_abs_lookup.h"
 #include "global_data.h"
 #include "gridded_fields.h"
@@ -30,6 +33,7 @@
 #include "physics_funcs.h"
 #include "propagationmatrix.h"
 #include "rng.h"
+#include "xml_io.h"
 
 using GriddedFieldGrids::GFIELD4_FIELD_NAMES;
 using GriddedFieldGrids::GFIELD4_P_GRID;
@@ -44,6 +48,27 @@ void abs_lookupInit(GasAbsLookup& x, const Verbosity& verbosity) {
   out2 << "  Created an empty gas absorption lookup table.\n";
 }
 
+//! Writes a partially computed lookup table as a checkpoint
+/*!
+  The table is first written to a temporary file that then replaces the
+  old checkpoint, so that an interrupted write does not destroy it.  The
+  binary part is moved first.  If interrupted in between, the old header
+  describes the new data, which has the same shape.
+
+  \param filename   Name of the checkpoint file
+  \param abs_lookup The partially computed table
+  \param verbosity  Verbosity
+*/
+static void abs_lookupWriteCheckpoint(const String& filename,
+                                      const GasAbsLookup& abs_lookup,
+                                      const Verbosity& verbosity) {
+  const String tmp_filename = filename + ".tmp";
+  xml_write_to_file(tmp_filename, abs_lookup, FILE_TYPE_BINARY, 0, verbosity);
+  std::filesystem::rename((tmp_filename + ".bin").c_str(),
+                          (filename + ".bin").c_str());
+  std::filesystem::rename(tmp_filename.c_str(), filename.c_str());
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void abs_lookupCalc(  // Workspace reference:
     Workspace& ws,
@@ -62,11 +87,17 @@ void abs_lookupCalc(  // Workspace reference:
     const Agenda& propmat_clearsky_agenda,
     // GIN
     const Numeric& lowest_vmr,
+    const String& storage,
+    const String& checkpoint_file,
+    const Numeric& checkpoint_interval,
     // Verbosity object:
     const Verbosity& verbosity) {
   CREATE_OUT2;
   CREATE_OUT3;
 
+  const Options::LookupStorage storage_type =
+      Options::toLookupStorageOrThrow(storage);
+
   ARTS_USER_ERROR_IF(
       propmat_clearsky_agenda.name() not_eq "propmat_clearsky_agenda",
       R"--(
@@ -82,10 +113,6 @@ absorption calculations but the output is in cross-sections
 
 Your current lowest_vmr value is: )--", lowest_vmr)
 
-  // We need this temporary variable to make a local copy of all VMRs,
-  // where we then perturb the H2O profile as needed
-  Matrix these_all_vmrs = abs_vmrs;
-
   // We will be calling an absorption agenda one species at a
   // time. This is better than doing all simultaneously, because is
   // saves memory and allows for consistent treatment of nonlinear
@@ -102,23 +129,8 @@ Your current lowest_vmr value is: )--", lowest_vmr)
 
   // 3. Input to absorption calculations:
 
-  // Absorption vmrs and temperature:
-  Matrix this_vmr(1, n_p_grid);
-  Vector abs_h2o(n_p_grid);
-  Vector this_t;  // Has same dimension, but is
-                  // initialized by assignment later.
-  const EnergyLevelMap this_nlte_dummy;
-
-  // Species list, lines, and line shapes, all with only 1 element:
-  ArrayOfArrayOfSpeciesTag this_species(1);
-
-  // List of active species for agenda call. Will always be filled with only
-  // one species.
-  ArrayOfIndex abs_species_active(1);
-
-  // Local copy of nls_pert and t_pert:
-  Vector these_nls_pert;  // Is resized every time when used
-  Vector these_t_pert;    // Is resized later on
+  // Local copy of t_pert:
+  Vector these_t_pert;  // Is resized later on
 
   // 4. Checks of input parameter correctness:
   const Index h2o_index = find_first_species(abs_species, Species::fromShortName("H2O"));
@@ -225,6 +237,10 @@ Your current lowest_vmr value is: )--", lowest_vmr)
 
     abs_lookup.xsec.resize(a, b, c, d);
     abs_lookup.xsec = NAN;
+    abs_lookup.xsec_map.reset();
+    abs_lookup.storage = Options::LookupStorage::Double;
+    abs_lookup.xsec_float = std::vector<float>{};
+    abs_lookup.xsec_float_shape = {0, 0, 0, 0};
   }
 
   // 6.a. Set up these_t_pert. This is done so that we can use the
@@ -244,195 +260,175 @@ Your current lowest_vmr value is: )--", lowest_vmr)
 
   // 7. Now we have to fill abs_lookup.xsec with the right values!
 
-  String fail_msg;
-  bool failed = false;
-
-  // Loop species:
+  // 7.a. Set up the work items. Each item is one pressure level of one
+  // temperature and H2O VMR perturbation of one species. They are
+  // distributed dynamically, so that all threads are kept busy also when
+  // there are few perturbations, or when some species are much more
+  // expensive than others.
+  struct WorkItem {
+    Index species;  // Index in abs_species
+    Index spec;     // Index in the second dimension of abs_lookup.xsec
+    Index nls;      // Index in abs_nls_pert, or -1 if not perturbed
+    Index t;        // Index in these_t_pert
+    Index p;        // Index in abs_p
+  };
+
+  std::vector<WorkItem> work;
   for (Index i = 0, spec = 0; i < n_species; ++i) {
     // Skipping Zeeman and free_electrons species.
     // (Mixed tag groups between those and other species are not allowed.)
-    if (abs_species[i].Zeeman() || abs_species[i].FreeElectrons() || abs_species[i].Particles()) {
+    if (abs_species[i].Zeeman() || abs_species[i].FreeElectrons() ||
+        abs_species[i].Particles()) {
       spec++;
       continue;
     }
 
-    // spec is the index for the second dimension of abs_lookup.xsec.
-
-    // Prepare absorption agenda input for this species:
-    out2 << "  Doing species " << i + 1 << " of " << n_species << ": "
-         << abs_species[i] << ".\n";
+    const Index these_nls_pert_nelem = non_linear[i] ? n_nls_pert : 1;
+    for (Index s = 0; s < these_nls_pert_nelem; ++s, ++spec)
+      for (Index j = 0; j < these_t_pert_nelem; ++j)
+        for (Index p = 0; p < n_p_grid; ++p)
+          work.push_back({i, spec, non_linear[i] ? s : -1, j, p});
+  }
 
-    // Set active species:
-    abs_species_active[0] = i;
+  // 7.b. Resume from a checkpoint. Columns without NaN are complete.
+  String checkpoint_path = checkpoint_file;
+  if (checkpoint_file.size() and find_xml_file_existence(checkpoint_path)) {
+    GasAbsLookup checkpoint;
+    xml_read_from_file(checkpoint_path, checkpoint, verbosity);
+
+    ARTS_USER_ERROR_IF(
+        checkpoint.species not_eq abs_lookup.species or
+            checkpoint.nonlinear_species not_eq abs_lookup.nonlinear_species or
+            not(checkpoint.f_grid == abs_lookup.f_grid) or
+            not(checkpoint.p_grid == abs_lookup.p_grid) or
+            not(checkpoint.vmrs_ref == abs_lookup.vmrs_ref) or
+            not(checkpoint.t_ref == abs_lookup.t_ref) or
+            not(checkpoint.t_pert == abs_lookup.t_pert) or
+            not(checkpoint.nls_pert == abs_lookup.nls_pert) or
+            checkpoint.xsec.shape() not_eq abs_lookup.xsec.shape(),
+        "The checkpoint file ",
+        checkpoint_path,
+        " was written for another setup.\n"
+        "Remove it to compute the table from scratch.")
+
+    abs_lookup.xsec = checkpoint.xsec;
+    std::erase_if(work, [&](const WorkItem& w) {
+      return std::none_of(abs_lookup.xsec(w.t, w.spec, joker, w.p).begin(),
+                          abs_lookup.xsec(w.t, w.spec, joker, w.p).end(),
+                          [](Numeric x) { return std::isnan(x); });
+    });
+
+    out2 << "  Resuming from checkpoint " << checkpoint_path << ", "
+         << work.size() << " work items remain.\n";
+  }
 
-    // Get a dummy list of tag groups with only the current element:
-    this_species[0].resize(abs_species[i].nelem());
-    this_species[0] = abs_species[i];
+  // 7.c. Compute the work items. This is done in blocks, so that progress
+  // can be reported and checkpoints written between the blocks.
+  const Index n_work = static_cast<Index>(work.size());
+  const Index block_size = 16 * arts_omp_get_max_threads();
+  Vector species_time(n_species, 0);
+  Time last_checkpoint{};
 
-    // Set up these_nls_pert. This is done so that we can use the
-    // same loop over the perturbations, independent of
-    // whether we have nonlinear species or not.
-    if (non_linear[i]) {
-      out2 << "  This is a species with H2O VMR perturbations.\n";
-      these_nls_pert.resize(n_nls_pert);
-      these_nls_pert = abs_nls_pert;
-    } else {
-      these_nls_pert.resize(1);
-      these_nls_pert = 1;
-    }
+  String fail_msg;
+  bool failed = false;
 
-    // Loop these_nls_pert:
-    for (Index s = 0; s < these_nls_pert.nelem(); ++s, ++spec) {
-      // Remember, spec is the index for the second dimension of
-      // abs_lookup.xsec
+  WorkspaceOmpParallelCopyGuard wss{ws};
 
-      if (non_linear[i]) {
-        out2 << "  Doing H2O VMR variant " << s + 1 << " of " << n_nls_pert
-             << ": " << abs_nls_pert[s] << ".\n";
-      }
+  for (Index first = 0; first < n_work; first += block_size) {
+    const Index last = std::min(first + block_size, n_work);
 
-      // Make a local copy of the VMRs, and manipulate the H2O VMR within it.
-      // Note: We do not need a runtime error check that h2o_index is ok here,
-      // because earlier on we throw an error if there is no H2O species although we
-      // need it. So, if h2o_indes is -1, we here simply assume that there
-      // should not be a perturbation
-      if (h2o_index >= 0) {
-        these_all_vmrs(h2o_index, joker) = abs_vmrs(h2o_index, joker);
-        these_all_vmrs(h2o_index, joker) *=
-            these_nls_pert[s];  // Add perturbation
-      }
+#pragma omp parallel for if (!arts_omp_in_parallel()) schedule(dynamic) \
+    firstprivate(wss)
+    for (Index k = first; k < last; ++k) {
+      // Skip remaining iterations if an error occurred
+      if (failed) continue;
 
-      // VMR for this species (still needed by interfact to continua):
-      // FIXME: This variable may go away eventually, when the continuum
-      // part no longer needs it.
-      this_vmr(0, joker) = these_all_vmrs(i, joker);
-
-      // For abs_h2o, we can always add the perturbations (it will
-      // not make a difference if the species itself is also H2O).
-      // Attention, we need to treat here also the case that there
-      // is no H2O species. We will then set abs_h2o to
-      // -1. Absorption routines that do not really need abs_h2o
-      // will still run.
-      //
-      // FIXME: abs_h2o is currently still needed by the continuum part.
-      // Should go away eventually.
-      if (h2o_index == -1) {
-        // The case without H2O species.
-        abs_h2o.resize(1);
-        abs_h2o = -1;
-      } else {
-        // The normal case.
-        abs_h2o = these_all_vmrs(h2o_index, joker);
+      // The try block here is necessary to correctly handle
+      // exceptions inside the parallel region.
+      try {
+        const WorkItem& w = work[k];
+        const Time start{};
+
+        // The VMRs at this level, with the H2O VMR perturbed for nonlinear
+        // species.  There is an H2O species whenever there are nonlinear
+        // species, this is checked above.
+        Vector rtp_vmr{abs_vmrs(joker, w.p)};
+        if (w.nls >= 0) rtp_vmr[h2o_index] *= abs_nls_pert[w.nls];
+        for (auto& x : rtp_vmr) x = std::max(lowest_vmr, x);
+
+        // The perturbed temperature
+        const Numeric t = abs_t[w.p] + these_t_pert[w.t];
+
+        // Perform the propagation matrix computations
+        PropagationMatrix K;
+        StokesVector S;
+        ArrayOfPropagationMatrix dK;
+        ArrayOfStokesVector dS;
+        propmat_clearsky_agendaExecute(wss,
+                                       K,
+                                       S,
+                                       dK,
+                                       dS,
+                                       {},
+                                       abs_species[w.species],
+                                       f_grid,
+                                       {},
+                                       {},
+                                       abs_p[w.p],
+                                       t,
+                                       {},
+                                       rtp_vmr,
+                                       propmat_clearsky_agenda);
+
+        // Store the cross-sections in the right place
+        K.Kjj() /= rtp_vmr[w.species] * number_density(abs_p[w.p], t);
+        abs_lookup.xsec(w.t, w.spec, joker, w.p) = K.Kjj();
+
+        const Numeric dt = TimeStep(Time{} - start).count();
+#pragma omp critical(abs_lookupCalc_timing)
+        species_time[w.species] += dt;
+      }  // end of try block
+      catch (const std::runtime_error& e) {
+#pragma omp critical(abs_lookupCalc_fail)
+        {
+          fail_msg = e.what();
+          failed = true;
+        }
       }
+    }  // end of parallel for loop
 
-      // Loop temperature perturbations
-      // ------------------------------
-
-      // We use a parallel for loop for this.
-
-      // There is something strange here: abs_lookup seems to be
-      // "shared" by default, although I have set default(none). I
-      // suspect that the reason for this behavior is that
-      // abs_lookup is a return by reference parameter of this
-      // function. Anyway, shared is the correct setting for
-      // abs_lookup, so there is no problem.
+    if (failed) throw runtime_error(fail_msg);
 
-  WorkspaceOmpParallelCopyGuard wss{ws};
+    out3 << "  Finished " << last << " of " << n_work << " work items.\n";
 
-#pragma omp parallel for if (                                         \
-    !arts_omp_in_parallel() &&                                        \
-    these_t_pert_nelem >=                                             \
-        arts_omp_get_max_threads()) private(this_t)                   \
-    firstprivate(wss)
-      for (Index j = 0; j < these_t_pert_nelem; ++j) {
-        // Skip remaining iterations if an error occurred
-        if (failed) continue;
-
-        // The try block here is necessary to correctly handle
-        // exceptions inside the parallel region.
-        try {
-          if (0 != n_t_pert) {
-            // We first prepare the output in a string here,
-            // so that we can write it to out3 with a single
-            // operation. This avoids messy output from
-            // multiple threads.
-            ostringstream os;
-
-            os << "  Doing temperature variant " << j + 1 << " of " << n_t_pert
-               << ": " << these_t_pert[j] << ".\n";
-
-            out3 << os.str();
-          }
+    if (checkpoint_file.size() and last < n_work and
+        TimeStep(Time{} - last_checkpoint).count() >= checkpoint_interval) {
+      abs_lookupWriteCheckpoint(checkpoint_file, abs_lookup, verbosity);
+      last_checkpoint = Time{};
+      out2 << "  Wrote checkpoint after " << last << " of " << n_work
+           << " work items.\n";
+    }
+  }
 
-          // Create perturbed temperature profile:
-          this_t = abs_lookup.t_ref;
-          this_t += these_t_pert[j];
-
-          // Store in the right place:
-          // Loop through all altitudes
-          for (Index p = 0; p < n_p_grid; ++p) {
-            PropagationMatrix K;
-            StokesVector S;
-            ArrayOfPropagationMatrix dK;
-            ArrayOfStokesVector dS;
-            Vector rtp_vmr{these_all_vmrs(joker, p)};
-            for (auto& x : rtp_vmr) x = std::max(lowest_vmr, x);
-
-            // Perform the propagation matrix computations
-            propmat_clearsky_agendaExecute(wss,
-                                           K,
-                                           S,
-                                           dK,
-                                           dS,
-                                           {},
-                                           abs_species[i],
-                                           f_grid,
-                                           {},
-                                           {},
-                                           abs_p[p],
-                                           this_t[p],
-                                           {},
-                                           rtp_vmr,
-                                           propmat_clearsky_agenda);
-            K.Kjj() /= rtp_vmr[i] * number_density(abs_p[p], this_t[p]);
-            abs_lookup.xsec(j, spec, Range(joker), p) = K.Kjj();
-
-            // There used to be a division by the number density
-            // n here. This is no longer necessary, since
-            // abs_xsec_per_species now contains true absorption
-            // cross sections.
-
-            // IMPORTANT: There was a bug in my old Matlab
-            // function "create_lookup.m" to generate the lookup
-            // table. (The number density was always the
-            // reference one, and did not change for different
-            // temperatures.) Patricks Atmlab function
-            // "arts_abstable_from_arts1.m" did *not* have this bug.
-
-            // Calculate the number density for the given pressure and
-            // temperature:
-            // n = n0*T0/p0 * p/T or n = p/kB/t, ideal gas law
-            //                  const Numeric n = number_density( abs_lookup.p_grid[p],
-            //                                                    this_t[p]   );
-            //                  abs_lookup.xsec( j, spec, Range(joker), p ) /= n;
-          }
-        }  // end of try block
-        catch (const std::runtime_error& e) {
-#pragma omp critical(abs_lookupCalc_fail)
-          {
-            fail_msg = e.what();
-            failed = true;
-          }
-        }
-      }  // end of parallel for loop
+  // 7.d. Report the timings. These are summed over all threads.
+  for (Index i = 0; i < n_species; ++i) {
+    if (species_time[i] > 0)
+      out2 << "  Species " << abs_species[i] << " took " << species_time[i]
+           << " s.\n";
+  }
 
-      if (failed) throw runtime_error(fail_msg);
-    }
+  // The checkpoint is not needed anymore
+  if (checkpoint_file.size() and find_xml_file_existence(checkpoint_path)) {
+    std::filesystem::remove(checkpoint_path.c_str());
+    std::filesystem::remove((checkpoint_path + ".bin").c_str());
   }
 
   // 6. Initialize fgp_default.
   abs_lookup.flag_default = my_interp::lagrange_interpolation_list<LagrangeInterpolation>(abs_lookup.f_grid, abs_lookup.f_grid, 0);
 
+  // 9. Convert to the requested precision.
+  abs_lookup.SetStorage(storage_type);
+
   // Set the abs_lookup_is_adapted flag. After all, the table fits the
   // current frequency grid and species selection.
   abs_lookup_is_adapted = 1;
@@ -1984,6 +1980,27 @@ void abs_lookupAdapt(GasAbsLookup& abs_lookup,
   abs_lookup_is_adapted = 1;
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupReadMapped(GasAbsLookup& abs_lookup,
+                          const String& filename,
+                          const Verbosity& verbosity) {
+  abs_lookup.ReadMapped(filename, verbosity);
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupSetStorage(GasAbsLookup& abs_lookup,
+                          const String& storage,
+                          const Verbosity&) {
+  abs_lookup.SetStorage(Options::toLookupStorageOrThrow(storage));
+}
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void abs_lookupWriteMapped(const GasAbsLookup& abs_lookup,
+                           const String& filename,
+                           const Verbosity& verbosity) {
+  abs_lookup.WriteMapped(filename, verbosity);
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void propmat_clearskyAddFromLookup(
     PropagationMatrix& propmat_clearsky,
@@ -2006,9 +2023,6 @@ void propmat_clearskyAddFromLookup(
     const Verbosity& verbosity) {
   CREATE_OUT3;
 
-  // Variables needed by abs_lookup.Extract:
-  Matrix abs_scalar_gas, dabs_scalar_gas_df, dabs_scalar_gas_dt;
-
   // Check if the table has been adapted:
   if (1 != abs_lookup_is_adapted)
     throw runtime_error(
@@ -2031,24 +2045,43 @@ void propmat_clearskyAddFromLookup(
 			     "order frequency interpolation in the lookup table.  Please use\n"
 			     "abs_f_interp_order>0 or remove wind/frequency Jacobian.");
   
-  // The function we are going to call here is one of the few helper
-  // functions that adjust the size of their output argument
-  // automatically.
-  abs_lookup.Extract(abs_scalar_gas,
-                     select_abs_species,
-                     abs_p_interp_order,
-                     abs_t_interp_order,
-                     abs_nls_interp_order,
-                     abs_f_interp_order,
-                     a_pressure,
-                     a_temperature,
-                     a_vmr_list,
-                     f_grid,
-                     extpolfac);
-  if (do_freq_jac) {
-    Vector dfreq = f_grid;
-    dfreq += df;
-    abs_lookup.Extract(dabs_scalar_gas_df,
+  // The absorption of the state, and of the state perturbed in temperature
+  // for the Jacobian, dimensions [state, species, frequency].  The buffers
+  // are kept between calls, so they are not reallocated for every point.
+  thread_local Tensor3 sga;
+  thread_local GasAbsLookupWeights weights;
+  thread_local Vector p, T;
+  thread_local Matrix vmrs;
+  Matrix dabs_scalar_gas_df;
+
+  const Index n_states = do_temp_jac ? 2 : 1;
+  sga.resize(n_states, a_vmr_list.nelem(), f_grid.nelem());
+
+  if (abs_f_interp_order == 0 and
+      f_grid.nelem() == abs_lookup.GetFgrid().nelem()) {
+    // On the frequency grid of the table, both states are extracted as one
+    // batch, with all interpolation weights computed up front
+    p.resize(n_states);
+    T.resize(n_states);
+    vmrs.resize(n_states, a_vmr_list.nelem());
+    p = a_pressure;
+    T = a_temperature;
+    if (do_temp_jac) T[1] += dt;
+    for (Index is = 0; is < n_states; is++) vmrs(is, joker) = a_vmr_list;
+
+    abs_lookup.ExtractWeights(weights,
+                              abs_p_interp_order,
+                              abs_t_interp_order,
+                              abs_nls_interp_order,
+                              p,
+                              T,
+                              vmrs,
+                              f_grid,
+                              extpolfac);
+    abs_lookup.Extract(sga, select_abs_species, weights, vmrs);
+  } else {
+    Matrix sga_state;
+    abs_lookup.Extract(sga_state,
                        select_abs_species,
                        abs_p_interp_order,
                        abs_t_interp_order,
@@ -2057,24 +2090,48 @@ void propmat_clearskyAddFromLookup(
                        a_pressure,
                        a_temperature,
                        a_vmr_list,
-                       dfreq,
+                       f_grid,
                        extpolfac);
+    sga(0, joker, joker) = sga_state;
+
+    if (do_temp_jac) {
+      const Numeric dtemp = a_temperature + dt;
+      abs_lookup.Extract(sga_state,
+                         select_abs_species,
+                         abs_p_interp_order,
+                         abs_t_interp_order,
+                         abs_nls_interp_order,
+                         abs_f_interp_order,
+                         a_pressure,
+                         dtemp,
+                         a_vmr_list,
+                         f_grid,
+                         extpolfac);
+      sga(1, joker, joker) = sga_state;
+    }
   }
-  if (do_temp_jac) {
-    const Numeric dtemp = a_temperature + dt;
-    abs_lookup.Extract(dabs_scalar_gas_dt,
+
+  // The frequency Jacobian needs frequency interpolation, so it is never
+  // on the grid of the table
+  if (do_freq_jac) {
+    Vector dfreq = f_grid;
+    dfreq += df;
+    abs_lookup.Extract(dabs_scalar_gas_df,
                        select_abs_species,
                        abs_p_interp_order,
                        abs_t_interp_order,
                        abs_nls_interp_order,
                        abs_f_interp_order,
                        a_pressure,
-                       dtemp,
+                       a_temperature,
                        a_vmr_list,
-                       f_grid,
+                       dfreq,
                        extpolfac);
   }
 
+  MatrixView abs_scalar_gas = sga(0, joker, joker);
+  const ConstMatrixView dabs_scalar_gas_dt = sga(n_states - 1, joker, joker);
+
   if (no_negatives){
     //Check for negative values due to interpolation and set them to zero
     for (Index ir = 0; ir < abs_scalar_gas.nrows(); ir++){
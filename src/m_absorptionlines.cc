@@ -17,10 +17,12 @@
 #include "global_data.h"
 #include "lineshapemodel.h"
 #include "m_xml.h"
+#include "parameters.h"
 #include "quantum_numbers.h"
 #include <algorithm>
 #include <atomic>
 #include <exception>
+#include <filesystem>
 #include <iterator>
 
 /////////////////////////////////////////////////////////////////////////////////////
@@ -72,18 +74,17 @@ void abs_lines_per_speciesFlatten(ArrayOfArrayOfAbsorptionLines& abs_lines_per_s
 /** Merge an external line to abs_lines
  * 
  * @param abs_lines As WSV
+ * @param index The band index of abs_lines
  * @param sline A single local line
  * @param global_qid The band id of the local line
  */
 void merge_external_line(ArrayOfAbsorptionLines& abs_lines,
+                         Absorption::BandIndex& index,
                          const Absorption::SingleLineExternal& sline,
                          const QuantumIdentifier& global_qid) {
-  auto band =
-      std::find_if(abs_lines.begin(), abs_lines.end(), [&](const auto& li) {
-        return li.MatchWithExternal(sline, global_qid);
-      });
-  if (band not_eq abs_lines.end()) {
-    band->AppendSingleLine(sline.line);
+  if (auto band = index.find(abs_lines, sline, global_qid);
+      band not_eq abs_lines.size()) {
+    abs_lines[band].AppendSingleLine(sline.line);
   } else {
     abs_lines.emplace_back(sline.selfbroadening,
                            sline.bathbroadening,
@@ -98,31 +99,7 @@ void merge_external_line(ArrayOfAbsorptionLines& abs_lines,
                            global_qid,
                            sline.species,
                            Array<AbsorptionSingleLine>{sline.line});
-  }
-}
-
-constexpr Index merge_local_lines_size = 499;
-
-/** Merge lines to abs_lines
- *
- * @param abs_lines As WSV
- * @param local_lines A local list of lines
- */
-void merge_local_lines(ArrayOfAbsorptionLines& abs_lines,
-                       const ArrayOfAbsorptionLines& local_lines) {
-  for (auto& band : local_lines) {
-    if (auto ptr = std::find_first_of(
-            abs_lines.begin(),
-            abs_lines.end(),
-            &band,
-            &band,
-            [](const auto& abs_band, const auto& local_band) {
-              return abs_band.Match(local_band).first;
-            });
-        ptr == abs_lines.end())
-      abs_lines.push_back(band);
-    else
-      for (auto& line : band.lines) ptr->lines.push_back(line);
+    index.add(abs_lines.back(), abs_lines.size() - 1);
   }
 }
 
@@ -219,7 +196,7 @@ void ReadArrayOfARTSCAT(ArrayOfAbsorptionLines& abs_lines,
   Index num_arrays;
   tag.get_attribute_value("nelem", num_arrays);
 
-  ArrayOfAbsorptionLines local_bands(0);
+  Absorption::BandIndex index(abs_lines);
   for (Index i=0; i<num_arrays; i++) {
     tag.read_from_stream(is_xml);
     tag.check_name("ArrayOfLineRecord");
@@ -282,11 +259,7 @@ void ReadArrayOfARTSCAT(ArrayOfAbsorptionLines& abs_lines,
           }
         }
 
-        merge_external_line(local_bands, sline, global_qid);
-        if (local_bands.nelem() > merge_local_lines_size) {
-          merge_local_lines(abs_lines, local_bands);
-          local_bands.resize(0);
-        }
+        merge_external_line(abs_lines, index, sline, global_qid);
       } else {
         String line;
         getline(is_xml, line);
@@ -297,8 +270,6 @@ void ReadArrayOfARTSCAT(ArrayOfAbsorptionLines& abs_lines,
     tag.check_name("/ArrayOfLineRecord");
   }
 
-  merge_local_lines(abs_lines, local_bands);
-  
   abs_linesNormalization(abs_lines, normalization_option, verbosity);
   abs_linesMirroring(abs_lines, mirroring_option, verbosity);
   abs_linesPopulation(abs_lines, population_option, verbosity);
@@ -376,7 +347,7 @@ void ReadARTSCAT(ArrayOfAbsorptionLines& abs_lines,
   
   bool go_on = true;
   Index n = 0;
-  ArrayOfAbsorptionLines local_bands(0);
+  Absorption::BandIndex index(abs_lines);
   while (n<nelem) {
     n++;
 
@@ -412,19 +383,13 @@ void ReadARTSCAT(ArrayOfAbsorptionLines& abs_lines,
         }
       }
 
-      merge_external_line(local_bands, sline, global_qid);
-      if (local_bands.nelem() > merge_local_lines_size) {
-        merge_local_lines(abs_lines, local_bands);
-        local_bands.resize(0);
-      }
+      merge_external_line(abs_lines, index, sline, global_qid);
     } else {
       String line;
       getline(is_xml, line);
     }
   }
 
-  merge_local_lines(abs_lines, local_bands);
-  
   abs_linesNormalization(abs_lines, normalization_option, verbosity);
   abs_linesMirroring(abs_lines, mirroring_option, verbosity);
   abs_linesPopulation(abs_lines, population_option, verbosity);
@@ -528,6 +493,7 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
                 const String& cutoff_option,
                 const Numeric& cutoff_value,
                 const Numeric& linemixinglimit_value,
+                const String& hitran_reading,
                 const Verbosity& verbosity)
 {
   abs_lines.resize(0);
@@ -541,63 +507,102 @@ void ReadHITRAN(ArrayOfAbsorptionLines& abs_lines,
   
   // HITRAN type
   const Options::HitranType hitran_version = Options::toHitranTypeOrThrow(hitran_type);
-  
-  // Hitran data
-  ifstream is;
-  open_input_file(is, hitran_file);
+  const Options::HitranReading reading = Options::toHitranReadingOrThrow(hitran_reading);
 
-  ArrayOfAbsorptionLines local_bands(0);
-  bool go_on = true;
-  while (go_on) {
+  // Sets Zeeman and the local quantum numbers of a line and returns its band id
+  const auto prepare_line = [&](Absorption::SingleLineExternal& sline) {
+    // Set Zeeman if implemented
+    sline.line.zeeman = Zeeman::GetAdvancedModel(sline.quantumidentity);
 
-    Absorption::SingleLineExternal sline;
+    // Get local quantum numbers into the line
+    for(auto qn: local_nums) {
+      if (sline.quantumidentity.val.has(qn)) {
+        sline.line.localquanta.val.set(sline.quantumidentity.val[qn]);
+      }
+    }
+
+    // Get the global quantum number identifier
+    return global_quantumidentifier(global_nums, sline.quantumidentity);
+  };
+
+  Absorption::BandIndex index(abs_lines);
+  if (reading == Options::HitranReading::Parallel) {
+    Absorption::SingleLineExternal (*read_line)(std::string_view) = nullptr;
     switch (hitran_version) {
       case Options::HitranType::Post2004:
-        sline = Absorption::ReadFromHitran2004Stream(is);
+        read_line = Absorption::ReadFromHitran2004Line;
         break;
       case Options::HitranType::Pre2004:
-        sline = Absorption::ReadFromHitran2001Stream(is);
+        read_line = Absorption::ReadFromHitran2001Line;
         break;
       case Options::HitranType::Online:
-        sline = Absorption::ReadFromHitranOnlineStream(is);
+        read_line = Absorption::ReadFromHitranOnlineLine;
         break;
       default:
         ARTS_ASSERT(false, "The HitranType enum class has to be fully updated!\n");
     }
-    
-    if (sline.bad) {
-      if (is.eof())
-        break;
-      ARTS_USER_ERROR("Cannot read line ", nelem(abs_lines) + nelem(local_bands) + 1);
-    }
-    if (sline.line.F0 < fmin)
-      continue; // Skip this line
-    if (sline.line.F0 > fmax)
-      break;  // We assume sorted so quit here
 
-    // Set Zeeman if implemented
-    sline.line.zeeman = Zeeman::GetAdvancedModel(sline.quantumidentity);
+    // We assume sorted so the reading ends at the first line above fmax
+    std::vector<Absorption::SingleLineExternal> slines =
+        Absorption::ReadFromHitranFile(hitran_file, read_line, fmax);
+    std::erase_if(slines, [fmin](auto& sline) { return sline.line.F0 < fmin; });
 
-    // Get the global quantum number identifier
-    const QuantumIdentifier global_qid = global_quantumidentifier(global_nums, sline.quantumidentity);
-    
-    // Get local quantum numbers into the line
-    for(auto qn: local_nums) {
-      if (sline.quantumidentity.val.has(qn)) {
-        sline.line.localquanta.val.set(sline.quantumidentity.val[qn]);
+    std::vector<QuantumIdentifier> global_qids(slines.size());
+#pragma omp parallel for if (not arts_omp_in_parallel())
+    for (std::size_t i = 0; i < slines.size(); i++)
+      global_qids[i] = prepare_line(slines[i]);
+
+    // Merge in the order of the file so that the bands are as when streaming
+    for (std::size_t i = 0; i < slines.size(); i++)
+      merge_external_line(abs_lines, index, slines[i], global_qids[i]);
+  } else {
+    // Hitran data
+    ifstream is;
+    open_input_file(is, hitran_file);
+
+    Index iline = 0;
+    bool go_on = true;
+    while (go_on) {
+
+      // Each call reads one line of the file
+      iline++;
+      Absorption::SingleLineExternal sline;
+      try {
+        switch (hitran_version) {
+          case Options::HitranType::Post2004:
+            sline = Absorption::ReadFromHitran2004Stream(is);
+            break;
+          case Options::HitranType::Pre2004:
+            sline = Absorption::ReadFromHitran2001Stream(is);
+            break;
+          case Options::HitranType::Online:
+            sline = Absorption::ReadFromHitranOnlineStream(is);
+            break;
+          default:
+            ARTS_ASSERT(false, "The HitranType enum class has to be fully updated!\n");
+        }
+      } catch (const std::exception& e) {
+        ARTS_USER_ERROR(
+            "Cannot read line ", iline, " of ", hitran_file, ":\n", e.what());
       }
-    }
+      
+      if (sline.bad) {
+        if (is.eof())
+          break;
+        ARTS_USER_ERROR("Cannot read line ", iline, " of ", hitran_file, ":\nBad line");
+      }
+      if (sline.line.F0 < fmin)
+        continue; // Skip this line
+      if (sline.line.F0 > fmax)
+        break;  // We assume sorted so quit here
+
+      const QuantumIdentifier global_qid = prepare_line(sline);
 
-    // Either find a line like this in the list of lines or start a new Lines
-    merge_external_line(local_bands, sline, global_qid);
-    if (local_bands.nelem() > merge_local_lines_size) {
-      merge_local_lines(abs_lines, local_bands);
-      local_bands.resize(0);
+      // Either find a line like this in the list of lines or start a new Lines
+      merge_external_line(abs_lines, index, sline, global_qid);
     }
   }
 
-  merge_local_lines(abs_lines, local_bands);
-
   abs_linesNormalization(abs_lines, normalization_option, verbosity);
   abs_linesMirroring(abs_lines, mirroring_option, verbosity);
   abs_linesPopulation(abs_lines, population_option, verbosity);
@@ -742,6 +747,67 @@ void ReadJPL(ArrayOfAbsorptionLines& abs_lines,
 /////////////////////////////////////////////////////////////// IO of AbsorptionLines
 /////////////////////////////////////////////////////////////////////////////////////
 
+//! The file extension of binary line catalogs
+constexpr const char* binary_catalog_extension = ".lines";
+
+/** Finds a binary line catalog in the include and data paths
+ *
+ * @param[in,out] filename The file name, set to the full path if found
+ * @return True if the file is found
+ */
+bool find_binary_catalog(String& filename) {
+  extern const Parameters parameters;
+  ArrayOfString allpaths = parameters.includepath;
+  allpaths.insert(
+      allpaths.end(), parameters.datapath.begin(), parameters.datapath.end());
+
+  ArrayOfString matching_files;
+  find_file(matching_files, filename, allpaths);
+  if (matching_files.nelem()) {
+    filename = matching_files[0];
+    return true;
+  }
+  return false;
+}
+
+/** Reads a species-split catalog file, binary if there is one, else XML
+ *
+ * The XML file is the archive, so a binary file that is older than the XML
+ * file is stale and the XML file is read instead
+ *
+ * @param[out] speclines The bands of the file
+ * @param[in] basename The file name without extension
+ * @param[in] verbosity As WSV
+ * @return True if a file was found
+ */
+bool read_species_split_catalog(ArrayOfAbsorptionLines& speclines,
+                                const String& basename,
+                                const Verbosity& verbosity) {
+  CREATE_OUT2;
+
+  String binary_filename = basename + binary_catalog_extension;
+  String xml_filename = basename + ".xml";
+  const bool has_binary = find_binary_catalog(binary_filename);
+  const bool has_xml = find_xml_file_existence(xml_filename);
+
+  if (has_binary and has_xml and
+      std::filesystem::last_write_time(xml_filename.c_str()) >
+          std::filesystem::last_write_time(binary_filename.c_str())) {
+    out2 << "  Ignoring " << binary_filename << ", it is older than "
+         << xml_filename << "\n";
+  } else if (has_binary) {
+    speclines = Absorption::ReadBinaryCatalog(binary_filename);
+    return true;
+  }
+
+  if (has_xml) {
+    xml_read_from_file(xml_filename, speclines, verbosity);
+    return true;
+  }
+
+  return false;
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void abs_linesWriteSpeciesSplitCatalog(const String& output_format,
                                    const ArrayOfAbsorptionLines& abs_lines,
@@ -781,9 +847,13 @@ void abs_linesWriteSpeciesSplitCatalog(const String& output_format,
     auto& name = specs[i];
     auto& lines = alps[i];
     
-    WriteXML(output_format, lines,
-             true_basename + name + ".xml",
-             0, "", "", "", verbosity);
+    if (output_format == "columnar")
+      Absorption::WriteBinaryCatalog(
+          true_basename + name + String(binary_catalog_extension), lines);
+    else
+      WriteXML(output_format, lines,
+               true_basename + name + ".xml",
+               0, "", "", "", verbosity);
   }
 }
 
@@ -822,10 +892,8 @@ void abs_linesReadSpeciesSplitCatalog(ArrayOfAbsorptionLines& abs_lines,
   // Read catalogs for each identified species and put them all into
   // abs_lines
   for (auto& ir: Species::Isotopologues) {
-    String filename = tmpbasename + ir.FullName() + ".xml";
-    if (find_xml_file_existence(filename)) {
-      ArrayOfAbsorptionLines speclines;
-      xml_read_from_file(filename, speclines, verbosity);
+    ArrayOfAbsorptionLines speclines;
+    if (read_species_split_catalog(speclines, tmpbasename + ir.FullName(), verbosity)) {
       for (auto& band: speclines) {
         abs_lines.push_back(band);
         bands_found++;
@@ -873,10 +941,8 @@ void abs_lines_per_speciesReadSpeciesSplitCatalog(ArrayOfArrayOfAbsorptionLines&
     if (not error.load()) {
       try {
         for (const auto& isot: isots) {
-          String filename = tmpbasename + isot.FullName() + ".xml";
-          if (find_xml_file_existence(filename)) {
-            ArrayOfAbsorptionLines speclines;
-            xml_read_from_file(filename, speclines, verbosity);
+          ArrayOfAbsorptionLines speclines;
+          if (read_species_split_catalog(speclines, tmpbasename + isot.FullName(), verbosity)) {
             for (auto& band: speclines) {
               par_abs_lines[i].push_back(std::move(band));
             }
@@ -17,13 +17,23 @@
   === External declarations
   ===========================================================================*/
 
+#include <unistd.h>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
 #include "gridded_fields.h"
 using namespace std;
 
 #include "arts.h"
 #include "arts_omp.h"
 #include "auto_md.h"
+#include "lineshape.h"
 #include "math_funcs.h"
 #include "physics_funcs.h"
 #include "rte.h"
@@ -72,6 +82,9 @@ void ybatchCalc(Workspace& ws,
                 const Verbosity& verbosity) {
   CREATE_OUTS;
 
+  // Line shape parameters are reused by the jobs of the batch
+  const LineShape::KernelCachePool::Scope line_kernels;
+
   Index first_ybatch_index = 0;
 
   ArrayOfString fail_msg;
@@ -213,6 +226,332 @@ void ybatchCalc(Workspace& ws,
   }
 }
 
+namespace {
+//! Identifies a file of streamed batch results
+constexpr std::array<char, 8> ybatch_stream_magic{
+    'A', 'R', 'T', 'S', 'Y', 'B', 'A', 'T'};
+
+//! Changes whenever the layout of the records changes
+constexpr std::int64_t ybatch_stream_version = 1;
+
+//! Reads back differently on a machine of other endianness
+constexpr std::int64_t ybatch_stream_endian = 0x0102030405060708;
+
+constexpr Index ybatch_stream_header_size =
+    Index(ybatch_stream_magic.size() + 2 * sizeof(std::int64_t));
+
+//! Where the record of a finished job is in the data file
+struct YbatchStreamRecord {
+  Index offset;
+  Index size;
+};
+
+//! The records of the finished jobs, by their ybatch_index
+using YbatchStreamIndex = std::map<Index, YbatchStreamRecord>;
+
+String ybatch_stream_index_filename(const String& filename) {
+  return filename + ".index";
+}
+
+using UniqueFile = std::unique_ptr<std::FILE, decltype(&std::fclose)>;
+
+UniqueFile ybatch_stream_open(const String& filename, const char* mode) {
+  UniqueFile file{std::fopen(filename.c_str(), mode), &std::fclose};
+  ARTS_USER_ERROR_IF(not file, "Cannot open ", filename)
+  return file;
+}
+
+//! Writes all of data and makes sure it is on disk before returning
+void ybatch_stream_write(std::FILE* file,
+                         const char* data,
+                         std::size_t size,
+                         const String& filename) {
+  ARTS_USER_ERROR_IF(std::fwrite(data, 1, size, file) not_eq size or
+                         std::fflush(file) not_eq 0 or
+                         fsync(fileno(file)) not_eq 0,
+                     "Cannot write to ", filename)
+}
+
+void ybatch_stream_check_header(std::FILE* file, const String& filename) {
+  std::array<char, ybatch_stream_magic.size()> magic{};
+  std::int64_t version = 0, endian = 0;
+  const bool ok =
+      std::fread(magic.data(), 1, magic.size(), file) == magic.size() and
+      std::fread(&version, sizeof version, 1, file) == 1 and
+      std::fread(&endian, sizeof endian, 1, file) == 1;
+
+  ARTS_USER_ERROR_IF(not ok or magic not_eq ybatch_stream_magic,
+                     filename,
+                     " is not a file of streamed batch results")
+  ARTS_USER_ERROR_IF(endian not_eq ybatch_stream_endian,
+                     filename,
+                     " was written on a machine of other endianness")
+  ARTS_USER_ERROR_IF(version not_eq ybatch_stream_version,
+                     filename,
+                     " has version ",
+                     version,
+                     " but only version ",
+                     ybatch_stream_version,
+                     " can be read")
+}
+
+/** Reads the index of the jobs found in the data file
+
+    The index is a text file with a line "ybatch_index offset size" for
+    each finished job.  A run that is interrupted can leave the last line
+    without its newline, or a line for a record that never reached the data
+    file.  Reading stops at the first such line, so what is returned are
+    only complete records.
+ */
+YbatchStreamIndex ybatch_stream_read_index(const String& filename) {
+  YbatchStreamIndex index;
+
+  std::error_code ec;
+  const auto data_size = Index(std::filesystem::file_size(filename.c_str(), ec));
+  if (ec) return index;
+
+  std::ifstream is(ybatch_stream_index_filename(filename).c_str());
+  String line;
+  while (std::getline(is, line) and not is.eof()) {
+    istringstream iss(line);
+    Index job, offset, size;
+    if (not(iss >> job >> offset >> size) or
+        offset < ybatch_stream_header_size or size <= 0 or
+        offset + size > data_size)
+      break;
+    index[job] = {offset, size};
+  }
+
+  return index;
+}
+
+//! A finished job as it is stored in the data file
+std::vector<char> ybatch_stream_record(Index ybatch_index,
+                                       const Vector& y,
+                                       const ArrayOfVector& y_aux,
+                                       const Matrix& jacobian) {
+  std::vector<char> record;
+  const auto put = [&record](auto x) {
+    const auto* p = reinterpret_cast<const char*>(&x);
+    record.insert(record.end(), p, p + sizeof x);
+  };
+  const auto put_vector = [&put](const Vector& v) {
+    put(std::int64_t(v.nelem()));
+    for (Numeric x : v) put(double(x));
+  };
+
+  put(std::int64_t(ybatch_index));
+  put_vector(y);
+  put(std::int64_t(y_aux.nelem()));
+  for (auto& v : y_aux) put_vector(v);
+  put(std::int64_t(jacobian.nrows()));
+  put(std::int64_t(jacobian.ncols()));
+  for (Index i = 0; i < jacobian.nrows(); i++)
+    for (Index j = 0; j < jacobian.ncols(); j++) put(double(jacobian(i, j)));
+
+  return record;
+}
+}  // namespace
+
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ybatchCalcStreamed(Workspace& ws,
+                        // WS Input:
+                        const Index& ybatch_start,
+                        const Index& ybatch_n,
+                        const Agenda& ybatch_calc_agenda,
+                        // Control Parameters:
+                        const String& filename,
+                        const Index& robust,
+                        const Index& restart,
+                        const Verbosity& verbosity) {
+  CREATE_OUTS;
+
+  // Line shape parameters are reused by the jobs of the batch
+  const LineShape::KernelCachePool::Scope line_kernels;
+
+  const String index_filename = ybatch_stream_index_filename(filename);
+  if (restart) {
+    std::filesystem::remove(filename.c_str());
+    std::filesystem::remove(index_filename.c_str());
+  }
+
+  // Jobs finished by an earlier run are kept, anything after their records
+  // is the remains of an interrupted write
+  const YbatchStreamIndex finished = ybatch_stream_read_index(filename);
+  Index data_size = ybatch_stream_header_size;
+  if (std::filesystem::exists(filename.c_str())) {
+    ybatch_stream_check_header(ybatch_stream_open(filename, "rb").get(),
+                               filename);
+    for (auto& [job, record] : finished)
+      data_size = std::max(data_size, record.offset + record.size);
+    std::filesystem::resize_file(filename.c_str(), data_size);
+  } else {
+    std::vector<char> header;
+    const auto put = [&header](auto x) {
+      const auto* p = reinterpret_cast<const char*>(&x);
+      header.insert(header.end(), p, p + sizeof x);
+    };
+    for (char c : ybatch_stream_magic) put(c);
+    put(ybatch_stream_version);
+    put(ybatch_stream_endian);
+    ybatch_stream_write(ybatch_stream_open(filename, "wb").get(),
+                        header.data(),
+                        header.size(),
+                        filename);
+  }
+
+  // The index is written anew so that it ends with a complete line
+  {
+    ostringstream os;
+    for (auto& [job, record] : finished)
+      os << job << ' ' << record.offset << ' ' << record.size << '\n';
+    const String tmp_filename = index_filename + ".tmp";
+    const String index = os.str();
+    ybatch_stream_write(ybatch_stream_open(tmp_filename, "w").get(),
+                        index.data(),
+                        index.size(),
+                        tmp_filename);
+    std::filesystem::rename(tmp_filename.c_str(), index_filename.c_str());
+  }
+
+  const UniqueFile data_file = ybatch_stream_open(filename, "ab");
+  const UniqueFile index_file = ybatch_stream_open(index_filename, "a");
+
+  Index nfinished = 0;
+  for (Index i = 0; i < ybatch_n; i++)
+    nfinished += finished.count(ybatch_start + i);
+  out2 << "  " << nfinished << " of " << ybatch_n
+       << " jobs are found in " << filename << "\n";
+
+  ArrayOfString fail_msg;
+  bool do_abort = false;
+  bool write_failed = false;
+  Index job_counter = nfinished;
+
+  if (ybatch_n > nfinished) {
+    WorkspaceOmpParallelCopyGuard wss{ws};
+
+#pragma omp parallel for schedule(dynamic) if (!arts_omp_in_parallel() && \
+                                               ybatch_n > 1) firstprivate(wss)
+    for (Index ybatch_index = 0; ybatch_index < ybatch_n; ybatch_index++) {
+      if (do_abort or finished.count(ybatch_start + ybatch_index)) continue;
+
+      Index l_job_counter;  // Thread-local copy of job counter.
+#pragma omp critical(ybatchCalcStreamed_job_counter)
+      { l_job_counter = ++job_counter; }
+
+      {
+        ostringstream os;
+        os << "  Job " << l_job_counter << " of " << ybatch_n << ", Index "
+           << ybatch_start + ybatch_index << ", Thread-Id "
+           << arts_omp_get_thread_num() << "\n";
+        out2 << os.str();
+      }
+
+      try {
+        Vector y;
+        ArrayOfVector y_aux;
+        Matrix jacobian;
+
+        ybatch_calc_agendaExecute(wss,
+                                  y,
+                                  y_aux,
+                                  jacobian,
+                                  ybatch_start + ybatch_index,
+                                  ybatch_calc_agenda);
+
+        // As for ybatchCalc, a job without y gives no output
+        if (!y.nelem()) {
+          y_aux.resize(0);
+          jacobian.resize(0, 0);
+        }
+
+        if ((jacobian.nrows() != 0 || jacobian.ncols() != 0) &&
+            jacobian.nrows() != y.nelem()) {
+          ostringstream os;
+          os << "First dimension of Jacobian must have same length as the measurement *y*.\n"
+             << "Length of *y*: " << y.nelem() << "\n"
+             << "Dimensions of *jacobian*: (" << jacobian.nrows() << ", "
+             << jacobian.ncols() << ")\n";
+#pragma omp critical(ybatchCalcStreamed_setabort)
+          do_abort = true;
+
+          throw runtime_error(os.str());
+        }
+
+        const std::vector<char> record = ybatch_stream_record(
+            ybatch_start + ybatch_index, y, y_aux, jacobian);
+
+        // The record is on disk before the index refers to it, so the
+        // index never points at a partial record
+        String write_error;
+#pragma omp critical(ybatchCalcStreamed_write)
+        try {
+          ARTS_USER_ERROR_IF(write_failed,
+                             "Not written after an earlier write failed")
+          ybatch_stream_write(
+              data_file.get(), record.data(), record.size(), filename);
+
+          ostringstream os;
+          os << ybatch_start + ybatch_index << ' ' << data_size << ' '
+             << record.size() << '\n';
+          const String line = os.str();
+          data_size += Index(record.size());
+          ybatch_stream_write(
+              index_file.get(), line.data(), line.size(), index_filename);
+        } catch (const std::exception& e) {
+          write_failed = true;
+          write_error = e.what();
+        }
+
+        // Failing to write is fatal also for a robust batch
+        if (write_error.size()) {
+#pragma omp critical(ybatchCalcStreamed_setabort)
+          do_abort = true;
+
+          throw runtime_error(write_error);
+        }
+      } catch (const std::exception& e) {
+        if (robust && !do_abort) {
+          ostringstream os;
+          os << "WARNING! Job at ybatch_index " << ybatch_start + ybatch_index
+             << " failed.\n"
+             << "It is retried when the batch is run again.\n"
+             << "The runtime error produced was:\n"
+             << e.what() << "\n";
+          out0 << os.str();
+        } else {
+#pragma omp critical(ybatchCalcStreamed_setabort)
+          do_abort = true;
+
+          ostringstream os;
+          os << "  Job at ybatch_index " << ybatch_start + ybatch_index
+             << " failed. Aborting...\n";
+          out1 << os.str();
+        }
+        ostringstream os;
+        os << "Run-time error at ybatch_index " << ybatch_start + ybatch_index
+           << ": \n"
+           << e.what();
+#pragma omp critical(ybatchCalcStreamed_push_fail_msg)
+        fail_msg.push_back(os.str());
+      }
+    }
+  }
+
+  if (fail_msg.nelem()) {
+    ostringstream os;
+
+    if (!do_abort) os << "\nError messages from failed batch cases:\n";
+    for (auto& msg : fail_msg) os << msg << '\n';
+
+    if (do_abort)
+      throw runtime_error(os.str());
+    else
+      out0 << os.str();
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void ybatchMetProfiles(Workspace& ws,
                        //Output
@@ -627,6 +966,90 @@ void ybatchMetProfilesClear(Workspace& ws,
   }  // closing the loop over profile basenames
 }
 
+/* Workspace method: Doxygen documentation will be auto-generated */
+void ybatchReadStreamed(ArrayOfVector& ybatch,
+                        ArrayOfArrayOfVector& ybatch_aux,
+                        ArrayOfMatrix& ybatch_jacobians,
+                        const Index& ybatch_start,
+                        const Index& ybatch_n,
+                        const String& filename,
+                        const Verbosity&) {
+  ARTS_USER_ERROR_IF(not std::filesystem::exists(filename.c_str()),
+                     "There are no streamed batch results in ",
+                     filename)
+
+  const UniqueFile data_file = ybatch_stream_open(filename, "rb");
+  ybatch_stream_check_header(data_file.get(), filename);
+  const YbatchStreamIndex finished = ybatch_stream_read_index(filename);
+
+  ybatch.resize(ybatch_n);
+  ybatch_aux.resize(ybatch_n);
+  ybatch_jacobians.resize(ybatch_n);
+
+  std::vector<char> record;
+  for (Index i = 0; i < ybatch_n; i++) {
+    ybatch[i].resize(0);
+    ybatch_aux[i].resize(0);
+    ybatch_jacobians[i].resize(0, 0);
+
+    const auto found = finished.find(ybatch_start + i);
+    if (found == finished.end()) continue;
+
+    const auto [offset, size] = found->second;
+    record.resize(size);
+    ARTS_USER_ERROR_IF(
+        std::fseek(data_file.get(), long(offset), SEEK_SET) not_eq 0 or
+            std::fread(record.data(), 1, record.size(), data_file.get()) not_eq
+                record.size(),
+        "Cannot read the record of ybatch_index ",
+        ybatch_start + i,
+        " from ",
+        filename)
+
+    std::size_t pos = 0;
+    const auto get = [&](auto& x) {
+      ARTS_USER_ERROR_IF(pos + sizeof x > record.size(),
+                         "The record of ybatch_index ",
+                         ybatch_start + i,
+                         " in ",
+                         filename,
+                         " is truncated")
+      std::memcpy(&x, record.data() + pos, sizeof x);
+      pos += sizeof x;
+    };
+    const auto get_index = [&get]() {
+      std::int64_t n = 0;
+      get(n);
+      return Index(n);
+    };
+    const auto get_vector = [&get, &get_index](Vector& v) {
+      v.resize(get_index());
+      for (auto& x : v) {
+        double d;
+        get(d);
+        x = d;
+      }
+    };
+
+    ARTS_USER_ERROR_IF(get_index() not_eq ybatch_start + i,
+                       "The index and the data of ",
+                       filename,
+                       " do not match")
+    get_vector(ybatch[i]);
+    ybatch_aux[i].resize(get_index());
+    for (auto& v : ybatch_aux[i]) get_vector(v);
+    const Index nrows = get_index();
+    const Index ncols = get_index();
+    ybatch_jacobians[i].resize(nrows, ncols);
+    for (Index r = 0; r < nrows; r++)
+      for (Index c = 0; c < ncols; c++) {
+        double d;
+        get(d);
+        ybatch_jacobians[i](r, c) = d;
+      }
+  }
+}
+
 /* Workspace method: Doxygen documentation will be auto-generated */
 void DOBatchCalc(Workspace& ws,
                  ArrayOfTensor7& dobatch_cloudbox_field,
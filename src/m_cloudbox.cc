@@ -1294,10 +1294,16 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
     ArrayOfArrayOfScatteringMetaData& scat_meta,
     // Keywords:
     const ArrayOfString& scat_data_files,
+    const Vector& frequencies,
+    const Index& interp_order,
     const Verbosity& verbosity) {
   CREATE_OUT2;
   CREATE_OUT3;
 
+  ARTS_USER_ERROR_IF(interp_order < 0,
+                     "*interp_order* must be non-negative, but is ",
+                     interp_order)
+
   //--- Reading the data ---------------------------------------------------
   ArrayOfSingleScatteringData arr_ssd;
   ArrayOfScatteringMetaData arr_smd;
@@ -1309,7 +1315,8 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
 
   for (Index i = 0; i < 1 && i < scat_data_files.nelem(); i++) {
     out3 << "  Read single scattering data file " << scat_data_files[i] << "\n";
-    xml_read_from_file(scat_data_files[i], arr_ssd[i], verbosity);
+    SingleScatteringDataFWindow window{arr_ssd[i], frequencies, interp_order};
+    xml_read_from_file(scat_data_files[i], window, verbosity);
 
     // make meta data name from scat data name
     ArrayOfString strarr;
@@ -1373,7 +1380,8 @@ void ScatSpeciesScatAndMetaRead(  //WS Output:
     try {
       out3 << "  Read single scattering data file " << scat_data_files[i]
            << "\n";
-      xml_read_from_file(scat_data_files[i], ssd, verbosity);
+      SingleScatteringDataFWindow window{ssd, frequencies, interp_order};
+      xml_read_from_file(scat_data_files[i], window, verbosity);
 
       scat_data_files[i].split(strarr, ".xml");
       scat_meta_file = strarr[0] + ".meta.xml";
@@ -15,15 +15,19 @@
   === External declarations
   ===========================================================================*/
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <stdexcept>
 #include "agenda_class.h"
 #include "array.h"
 #include "arts.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
+#include "artstime.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "doit.h"
@@ -34,6 +38,7 @@
 #include "math_funcs.h"
 #include "matpack_data.h"
 #include "messages.h"
+#include "optproperties.h"
 #include "physics_funcs.h"
 #include "ppath.h"
 #include "rte.h"
@@ -468,11 +473,17 @@ void cloudbox_field_monoIterate(Workspace& ws,
                                 const Agenda& doit_rte_agenda,
                                 const Agenda& doit_conv_test_agenda,
                                 const Index& accelerated,
+                                const String& solver,
+                                const Index& krylov_restart,
+                                const Numeric& krylov_tolerance,
                                 const Verbosity& verbosity)
 
 {
+  CREATE_OUT1;
   CREATE_OUT2;
 
+  const auto doit_solver = Options::toDoitSolverOrThrow(solver);
+
   //---------------Check input---------------------------------
   chk_not_empty("doit_scat_field_agenda", doit_scat_field_agenda);
   chk_not_empty("doit_rte_agenda", doit_rte_agenda);
@@ -509,6 +520,98 @@ void cloudbox_field_monoIterate(Workspace& ws,
 
   doit_conv_flag_local = 0;
   doit_iteration_counter_local = 0;
+  const Time start{};
+
+  if (doit_solver != Options::DoitSolver::SourceIteration) {
+    ARTS_USER_ERROR_IF(accelerated,
+                       "Ng acceleration is only used with *solver* "
+                       "\"SourceIteration\", not with \"", solver, '"')
+
+    // One DOIT update of the field
+    const auto update = [&](Tensor6& field) {
+      doit_scat_field_agendaExecute(
+          ws, doit_scat_field_local, field, doit_scat_field_agenda);
+      doit_rte_agendaExecute(ws, field, doit_scat_field_local, doit_rte_agenda);
+    };
+
+    const Index n = cloudbox_field_mono.size();
+    Vector residual(n), step(n);
+    Tensor6 cloudbox_field_mono_updated, perturbed;
+    Index napply = 0;
+
+    while (true) {
+      cloudbox_field_mono_old_local = cloudbox_field_mono;
+
+      out2 << "  Execute doit_scat_field_agenda and doit_rte_agenda. \n";
+      update(cloudbox_field_mono);
+      napply++;
+
+      doit_conv_test_agendaExecute(ws,
+                                   doit_conv_flag_local,
+                                   doit_iteration_counter_local,
+                                   cloudbox_field_mono,
+                                   cloudbox_field_mono_old_local,
+                                   doit_conv_test_agenda);
+      if (doit_conv_flag_local) break;
+
+      // The fixed point I = G(I) of the update G solves (1 - M) step = G(I) - I,
+      // for the field I + step, where M is the linear part of G. G is affine
+      // in the field, so M v = (G(I + e v) - G(I)) / e for any e, here chosen
+      // to make e v as large as I
+      cloudbox_field_mono_updated = cloudbox_field_mono;
+      std::transform(cloudbox_field_mono_updated.elem_begin(),
+                     cloudbox_field_mono_updated.elem_end(),
+                     cloudbox_field_mono_old_local.elem_begin(),
+                     residual.elem_begin(),
+                     std::minus<>{});
+      const Numeric field_norm = std::sqrt(
+          std::transform_reduce(cloudbox_field_mono_old_local.elem_begin(),
+                                cloudbox_field_mono_old_local.elem_end(),
+                                cloudbox_field_mono_old_local.elem_begin(),
+                                0.0));
+
+      const auto apply = [&](VectorView out, ConstVectorView v) {
+        const Numeric v_norm = std::sqrt(v * v);
+        const Numeric e =
+            field_norm > 0 and v_norm > 0 ? field_norm / v_norm : 1;
+
+        perturbed = cloudbox_field_mono_old_local;
+        auto it = v.elem_begin();
+        for (auto x = perturbed.elem_begin(); x != perturbed.elem_end();
+             ++x, ++it)
+          *x += e * *it;
+
+        update(perturbed);
+        napply++;
+
+        auto p = perturbed.elem_begin();
+        auto u = cloudbox_field_mono_updated.elem_begin();
+        for (Index i = 0; i < n; i++, ++p, ++u) out[i] = v[i] - (*p - *u) / e;
+      };
+
+      step = 0;
+      doit_krylov_solve(step,
+                        residual,
+                        apply,
+                        doit_solver,
+                        krylov_restart,
+                        krylov_tolerance,
+                        krylov_restart);
+
+      cloudbox_field_mono = cloudbox_field_mono_old_local;
+      auto it = step.elem_begin();
+      for (auto x = cloudbox_field_mono.elem_begin();
+           x != cloudbox_field_mono.elem_end();
+           ++x, ++it)
+        *x += *it;
+    }
+
+    out1 << "  DOIT " << solver << ": " << doit_iteration_counter_local
+         << " convergence tests, " << napply << " updates, "
+         << TimeStep(Time{} - start).count() << " s\n";
+    return;
+  }
+
   // Array to save the last iteration steps
   ArrayOfTensor6 acceleration_input;
   if (accelerated) {
@@ -549,6 +652,9 @@ void cloudbox_field_monoIterate(Workspace& ws,
       }
     }
   }  //end of while loop, convergence is reached.
+
+  out1 << "  DOIT " << solver << ": " << doit_iteration_counter_local
+       << " iterations, " << TimeStep(Time{} - start).count() << " s\n";
 }
 
 /* Workspace method: Doxygen documentation will be auto-generated */
@@ -2150,55 +2256,21 @@ void doit_scat_fieldCalc(Workspace& ws,
   out2 << "  Calculate the scattered field\n";
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      //There is only loop over zenith angle grid ; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < Nza; za_index_local++) {
-        // Calculate the phase matrix of individual scattering elements
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        //angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < Nza; ++za_in) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_mono(p_index, 0, 0, za_in, 0, j);
-              }
-            }
-
-          }  //end aa_in loop
-        }    //end za_in loop
-        //integration of the product of ifield_in and pha
-        //  over zenith angle and azimuth angle grid. It calls
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_grid) /
-                2 / PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field(p_index, 0, 0, za_index_local, 0, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_grid,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-      }  //end za_prop loop
-    }    //end p_index loop
+    // The phase matrix of each point is prepared by
+    // *DoitScatteringDataPrepare*, so the points are independent
+    Matrix weights;
+    doit_scat_field_weights(weights, za_grid, aa_grid);
+
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const int nthreads = arts_omp_get_available_threads();
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1 && np > 1)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      doit_scat_field_1D(
+          doit_scat_field(p_index, 0, 0, joker, 0, joker),
+          pha_mat_doit(p_index, joker, 0, joker, joker, joker, joker),
+          cloudbox_field_mono(p_index, 0, 0, joker, 0, joker),
+          weights);
+    }
   }      //end atmosphere_dim = 1
 
   //atmosphere_dim = 3
@@ -2207,86 +2279,107 @@ void doit_scat_fieldCalc(Workspace& ws,
         when we calculate the pha_mat from pha_mat_spt and pnd_field
         using the method pha_matCalc.  */
 
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            for (Index za_index_local = 0; za_index_local < Nza;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const int nthreads = arts_omp_get_available_threads();
+    const bool parallel = nthreads > 1 && np > 1;
+    WorkspaceOmpParallelCopyGuard wss{ws, parallel};
+    bool failed = false;
+    String fail_msg;
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              for (Index za_in = 0; za_in < Nza; ++za_in) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_mono(p_index,
-                                              lat_index,
-                                              lon_index,
-                                              za_index_local,
-                                              aa_index_local,
-                                              j);
+#pragma omp parallel for num_threads(nthreads) if (parallel) \
+    firstprivate(wss, pha_mat_local, pha_mat_spt_local, product_field)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      if (failed) continue;
+
+      try {
+        for (Index lat_index = 0;
+             lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
+             lat_index++) {
+          for (Index lon_index = 0;
+               lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
+               lon_index++) {
+            Numeric rtp_temperature_local =
+                t_field(p_index + cloudbox_limits[0],
+                        lat_index + cloudbox_limits[2],
+                        lon_index + cloudbox_limits[4]);
+
+            for (Index aa_index_local = 1; aa_index_local < Naa;
+                 aa_index_local++) {
+              for (Index za_index_local = 0; za_index_local < Nza;
+                   za_index_local++) {
+                out3 << "Calculate phase matrix \n";
+                pha_mat_spt_agendaExecute(wss,
+                                          pha_mat_spt_local,
+                                          za_index_local,
+                                          lat_index,
+                                          lon_index,
+                                          p_index,
+                                          aa_index_local,
+                                          rtp_temperature_local,
+                                          pha_mat_spt_agenda);
+
+                pha_matCalc(pha_mat_local,
+                            pha_mat_spt_local,
+                            pnd_field,
+                            atmosphere_dim,
+                            p_index,
+                            lat_index,
+                            lon_index,
+                            verbosity);
+
+                product_field = 0;
+
+                //za_in and aa_in are the incoming directions
+                //for which pha_mat_spt is calculated
+                for (Index za_in = 0; za_in < Nza; ++za_in) {
+                  for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                    // Multiplication of phase matrix
+                    // with incloming intensity field.
+                    for (Index i = 0; i < stokes_dim; i++) {
+                      for (Index j = 0; j < stokes_dim; j++) {
+                        product_field(za_in, aa_in, i) +=
+                            pha_mat_local(za_in, aa_in, i, j) *
+                            cloudbox_field_mono(p_index,
+                                                lat_index,
+                                                lon_index,
+                                                za_index_local,
+                                                aa_index_local,
+                                                j);
+                      }
                     }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
-              //integration of the product of ifield_in and pha
-              //over zenith angle and azimuth angle grid. It
-              //calls here the integration routine
-              //AngIntegrate_trapezoid_opti
-              for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field(p_index,
-                                lat_index,
-                                lon_index,
-                                za_index_local,
-                                aa_index_local,
-                                i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end i loop
-            }    //end aa_prop loop
-          }      //end za_prop loop
-        }        //end lon loop
-      }          // end lat loop
-    }            // end p loop
+                  }  //end aa_in loop
+                }    //end za_in loop
+                //integration of the product of ifield_in and pha
+                //over zenith angle and azimuth angle grid. It
+                //calls here the integration routine
+                //AngIntegrate_trapezoid_opti
+                for (Index i = 0; i < stokes_dim; i++) {
+                  doit_scat_field(p_index,
+                                  lat_index,
+                                  lon_index,
+                                  za_index_local,
+                                  aa_index_local,
+                                  i) =
+                      AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                                  za_grid,
+                                                  aa_grid,
+                                                  grid_stepsize);
+                }  //end i loop
+              }    //end aa_prop loop
+            }      //end za_prop loop
+          }        //end lon loop
+        }          // end lat loop
+      } catch (const std::exception& e) {
+#pragma omp critical(doit_scat_fieldCalc_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }  // end p loop
+
+    ARTS_USER_ERROR_IF(failed, fail_msg)
+
     // aa = 0 is the same as aa = 180:
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
@@ -2449,77 +2542,42 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
   Tensor3 product_field(doit_za_grid_size, Naa, stokes_dim, 0);
 
   if (atmosphere_dim == 1) {
-    // Get pha_mat at the grid positions
-    // Since atmosphere_dim = 1, there is no loop over lat and lon grids
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
+    // The phase matrix of each point is prepared by
+    // *DoitScatteringDataPrepare*, so the points are independent
+    Matrix weights;
+    doit_scat_field_weights(weights, za_g, aa_grid);
+
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const int nthreads = arts_omp_get_available_threads();
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1 && np > 1)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      Matrix field_int(doit_za_grid_size, stokes_dim);
+      Matrix scat_field_org(doit_za_grid_size, stokes_dim);
+
       // Interpolate intensity field:
       for (Index i = 0; i < stokes_dim; i++) {
         if (doit_za_interp == 0) {
-          interp(cloudbox_field_int(joker, i),
+          interp(field_int(joker, i),
                  itw_za_i,
                  cloudbox_field_mono(p_index, 0, 0, joker, 0, i),
                  gp_za_i);
-        } else if (doit_za_interp == 1) {
+        } else {
           // Polynomial
           for (Index za = 0; za < za_g.nelem(); za++) {
-            cloudbox_field_int(za, i) =
+            field_int(za, i) =
                 interp_poly(za_grid,
                             cloudbox_field_mono(p_index, 0, 0, joker, 0, i),
                             za_g[za],
                             gp_za_i[za]);
           }
         }
-        // doit_za_interp must be 0 or 1 (linear or polynomial)!!!
-        else
-          ARTS_ASSERT(false);
       }
 
-      //There is only loop over zenith angle grid; no azimuth angle grid.
-      for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-           za_index_local++) {
-        out3 << "Multiplication of phase matrix with incoming"
-             << " intensities \n";
-
-        product_field = 0;
-
-        // za_in and aa_in are for incoming zenith and azimuth
-        // angle direction for which pha_mat is calculated
-        for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-          for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-            // Multiplication of phase matrix with incoming
-            // intensity field.
-
-            for (Index i = 0; i < stokes_dim; i++) {
-              for (Index j = 0; j < stokes_dim; j++) {
-                product_field(za_in, aa_in, i) +=
-                    pha_mat_doit(
-                        p_index, za_index_local, 0, za_in, aa_in, i, j) *
-                    cloudbox_field_int(za_in, j);
-              }
-            }
-
-          }  //end aa_in loop
-        }    //end za_in loop
-
-        out3 << "Compute integral. \n";
-        if (Naa == 1) {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid(product_field(joker, 0, i), za_g) / 2 /
-                PI;
-          }  //end i loop
-        } else {
-          for (Index i = 0; i < stokes_dim; i++) {
-            doit_scat_field_org(za_index_local, i) =
-                AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                            za_g,
-                                            aa_grid,
-                                            grid_stepsize);
-          }
-        }
-
-      }  //end za_prop loop
+      doit_scat_field_1D(
+          scat_field_org,
+          pha_mat_doit(p_index, joker, 0, joker, joker, joker, joker),
+          field_int,
+          weights);
 
       // Interpolation on za_grid, which is used in
       // radiative transfer part.
@@ -2528,13 +2586,13 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
         {
           interp(doit_scat_field(p_index, 0, 0, joker, 0, i),
                  itw_za,
-                 doit_scat_field_org(joker, i),
+                 scat_field_org(joker, i),
                  gp_za);
         } else  // polynomial interpolation
         {
           for (Index za = 0; za < za_grid.nelem(); za++) {
             doit_scat_field(p_index, 0, 0, za, 0, i) = interp_poly(
-                za_g, doit_scat_field_org(joker, i), za_grid[za], gp_za[za]);
+                za_g, scat_field_org(joker, i), za_grid[za], gp_za[za]);
           }
         }
       }
@@ -2544,99 +2602,120 @@ void doit_scat_fieldCalcLimb(Workspace& ws,
 
   else if (atmosphere_dim == 3) {
     // Loop over all positions
-    for (Index p_index = 0; p_index <= cloudbox_limits[1] - cloudbox_limits[0];
-         p_index++) {
-      for (Index lat_index = 0;
-           lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
-           lat_index++) {
-        for (Index lon_index = 0;
-             lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
-             lon_index++) {
-          Numeric rtp_temperature_local =
-              t_field(p_index + cloudbox_limits[0],
-                      lat_index + cloudbox_limits[2],
-                      lon_index + cloudbox_limits[4]);
-
-          // Loop over scattered directions
-          for (Index aa_index_local = 1; aa_index_local < Naa;
-               aa_index_local++) {
-            // Interpolate intensity field:
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  cloudbox_field_int(joker, i),
-                  itw_za_i,
-                  cloudbox_field_mono(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  gp_za_i);
-            }
+    const Index np = cloudbox_limits[1] - cloudbox_limits[0] + 1;
+    const int nthreads = arts_omp_get_available_threads();
+    const bool parallel = nthreads > 1 && np > 1;
+    WorkspaceOmpParallelCopyGuard wss{ws, parallel};
+    bool failed = false;
+    String fail_msg;
 
-            for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
-                 za_index_local++) {
-              out3 << "Calculate phase matrix \n";
-              pha_mat_spt_agendaExecute(ws,
-                                        pha_mat_spt_local,
-                                        za_index_local,
-                                        lat_index,
-                                        lon_index,
-                                        p_index,
-                                        aa_index_local,
-                                        rtp_temperature_local,
-                                        pha_mat_spt_agenda);
-
-              pha_matCalc(pha_mat_local,
-                          pha_mat_spt_local,
-                          pnd_field,
-                          atmosphere_dim,
-                          p_index,
-                          lat_index,
-                          lon_index,
-                          verbosity);
+#pragma omp parallel for num_threads(nthreads) if (parallel) \
+    firstprivate(wss, pha_mat_local, pha_mat_spt_local, product_field, cloudbox_field_int, doit_scat_field_org)
+    for (Index p_index = 0; p_index < np; p_index++) {
+      if (failed) continue;
 
-              product_field = 0;
-
-              //za_in and aa_in are the incoming directions
-              //for which pha_mat_spt is calculated
-              out3 << "Multiplication of phase matrix with"
-                   << "incoming intensity \n";
-
-              for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
-                for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
-                  // Multiplication of phase matrix
-                  // with incloming intensity field.
-                  for (Index i = 0; i < stokes_dim; i++) {
-                    for (Index j = 0; j < stokes_dim; j++) {
-                      product_field(za_in, aa_in, i) +=
-                          pha_mat_local(za_in, aa_in, i, j) *
-                          cloudbox_field_int(za_in, j);
+      try {
+        for (Index lat_index = 0;
+             lat_index <= cloudbox_limits[3] - cloudbox_limits[2];
+             lat_index++) {
+          for (Index lon_index = 0;
+               lon_index <= cloudbox_limits[5] - cloudbox_limits[4];
+               lon_index++) {
+            Numeric rtp_temperature_local =
+                t_field(p_index + cloudbox_limits[0],
+                        lat_index + cloudbox_limits[2],
+                        lon_index + cloudbox_limits[4]);
+
+            // Loop over scattered directions
+            for (Index aa_index_local = 1; aa_index_local < Naa;
+                 aa_index_local++) {
+              // Interpolate intensity field:
+              for (Index i = 0; i < stokes_dim; i++) {
+                interp(
+                    cloudbox_field_int(joker, i),
+                    itw_za_i,
+                    cloudbox_field_mono(
+                        p_index, lat_index, lon_index, joker, aa_index_local, i),
+                    gp_za_i);
+              }
+
+              for (Index za_index_local = 0; za_index_local < doit_za_grid_size;
+                   za_index_local++) {
+                out3 << "Calculate phase matrix \n";
+                pha_mat_spt_agendaExecute(wss,
+                                          pha_mat_spt_local,
+                                          za_index_local,
+                                          lat_index,
+                                          lon_index,
+                                          p_index,
+                                          aa_index_local,
+                                          rtp_temperature_local,
+                                          pha_mat_spt_agenda);
+
+                pha_matCalc(pha_mat_local,
+                            pha_mat_spt_local,
+                            pnd_field,
+                            atmosphere_dim,
+                            p_index,
+                            lat_index,
+                            lon_index,
+                            verbosity);
+
+                product_field = 0;
+
+                //za_in and aa_in are the incoming directions
+                //for which pha_mat_spt is calculated
+                out3 << "Multiplication of phase matrix with"
+                     << "incoming intensity \n";
+
+                for (Index za_in = 0; za_in < doit_za_grid_size; za_in++) {
+                  for (Index aa_in = 0; aa_in < Naa; ++aa_in) {
+                    // Multiplication of phase matrix
+                    // with incloming intensity field.
+                    for (Index i = 0; i < stokes_dim; i++) {
+                      for (Index j = 0; j < stokes_dim; j++) {
+                        product_field(za_in, aa_in, i) +=
+                            pha_mat_local(za_in, aa_in, i, j) *
+                            cloudbox_field_int(za_in, j);
+                      }
                     }
-                  }
-                }  //end aa_in loop
-              }    //end za_in loop
+                  }  //end aa_in loop
+                }    //end za_in loop
+
+                out3 << "Compute the integral \n";
 
-              out3 << "Compute the integral \n";
+                for (Index i = 0; i < stokes_dim; i++) {
+                  doit_scat_field_org(za_index_local, i) =
+                      AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
+                                                  za_grid,
+                                                  aa_grid,
+                                                  grid_stepsize);
+                }  //end stokes_dim loop
 
+              }  //end za_prop loop
+              //Interpolate on original za_grid.
               for (Index i = 0; i < stokes_dim; i++) {
-                doit_scat_field_org(za_index_local, i) =
-                    AngIntegrate_trapezoid_opti(product_field(joker, joker, i),
-                                                za_grid,
-                                                aa_grid,
-                                                grid_stepsize);
-              }  //end stokes_dim loop
-
-            }  //end za_prop loop
-            //Interpolate on original za_grid.
-            for (Index i = 0; i < stokes_dim; i++) {
-              interp(
-                  doit_scat_field(
-                      p_index, lat_index, lon_index, joker, aa_index_local, i),
-                  itw_za,
-                  doit_scat_field_org(joker, i),
-                  gp_za);
-            }
-          }  // end aa_prop loop
-        }    //end lon loop
-      }      //end lat loop
-    }        // end p loop
+                interp(
+                    doit_scat_field(
+                        p_index, lat_index, lon_index, joker, aa_index_local, i),
+                    itw_za,
+                    doit_scat_field_org(joker, i),
+                    gp_za);
+              }
+            }  // end aa_prop loop
+          }    //end lon loop
+        }      //end lat loop
+      } catch (const std::exception& e) {
+#pragma omp critical(doit_scat_fieldCalcLimb_fail)
+        {
+          failed = true;
+          fail_msg = e.what();
+        }
+      }
+    }  // end p loop
+
+    ARTS_USER_ERROR_IF(failed, fail_msg)
+
     doit_scat_field(joker, joker, joker, joker, 0, joker) =
         doit_scat_field(joker, joker, joker, joker, Naa - 1, joker);
   }  // end atm_dim=3
@@ -2784,6 +2863,9 @@ void DoitCalc(Workspace& ws,
 
   //-------- end of checks ----------------------------------------
 
+  // The scattering data interpolated by the agendas is kept for the run
+  const SsdInterpCachePool::Scope ssd_interp_caches;
+
   // OMP likes simple loop end conditions, so we make a local copy here:
   const Index nf = f_grid.nelem();
 
@@ -2791,15 +2873,20 @@ void DoitCalc(Workspace& ws,
     String fail_msg;
     bool failed = false;
 
-    WorkspaceOmpParallelCopyGuard wss{ws};
+    // Threads the frequency loop can not use are handed to the scattering
+    // integral of each frequency
+    const ArtsOmpNestedLoop f_loop{nf};
+    WorkspaceOmpParallelCopyGuard wss{ws, f_loop.threads() > 1};
 
-#pragma omp parallel for if (!arts_omp_in_parallel() && nf > 1) firstprivate(wss)
+#pragma omp parallel for num_threads(f_loop.threads()) \
+    if (f_loop.threads() > 1) firstprivate(wss)
     for (Index f_index = 0; f_index < nf; f_index++) {
       if (failed) {
         cloudbox_field(f_index, joker, joker, joker, joker, joker, joker) = NAN;
         continue;
       }
 
+      const ArtsOmpInnerThreads inner_threads{f_loop};
       try {
         ostringstream os;
         os << "Frequency: " << f_grid[f_index] / 1e9 << " GHz \n";
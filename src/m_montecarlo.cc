@@ -11,13 +11,16 @@
   === External declarations
   ===========================================================================*/
 
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <fstream>
 #include <stdexcept>
+#include <vector>
 #include "arts.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "lin_alg.h"
@@ -41,6 +44,28 @@ inline constexpr Numeric PI=Constant::pi;
 inline constexpr Numeric BOLTZMAN_CONST=Constant::boltzmann_constant;
 inline constexpr Numeric SPEED_OF_LIGHT=Constant::speed_of_light;
 
+namespace {
+//! The outcome of tracing a single photon by MCGeneral
+struct MCGeneralPhoton {
+  Vector I;
+  Index scattering_order;
+  Index source_domain;  // Index in mc_source_domain, or -1 without a source
+  std::array<Index, 3> point;  // Grid position of the last ppath point
+  bool oksampling;
+  bool failed;
+  bool aborted;  // Threw something else than a runtime_error, see error
+  String error;
+};
+
+//! The range bin contributions of a single photon by MCRadar
+struct MCRadarPhoton {
+  ArrayOfIndex bins;
+  ArrayOfVector I;  // Antenna weighted Stokes vectors
+  bool failed;
+  String error;
+};
+}  // namespace
+
 /*===========================================================================
   === The functions (in alphabetical order)
   ===========================================================================*/
@@ -184,12 +209,8 @@ void MCGeneral(Workspace& ws,
     throw runtime_error(os.str());
   }
 
-  Ppath ppath_step;
-  RandomNumberGenerator<> rng;  //Random Number generator
   time_t start_time = time(NULL);
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   Vector Z11maxvector(
       N_se);  //Vector holding the maximum phase function for each
 
@@ -204,20 +225,8 @@ void MCGeneral(Workspace& ws,
     }
   }
 
-  rng.seed(mc_seed);
-
-  Numeric g, temperature, albedo, g_los_csc_theta;
-  Matrix A(stokes_dim, stokes_dim), Q(stokes_dim, stokes_dim);
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3),
-      R_stokes(stokes_dim, stokes_dim);  // Needed for antenna rotations
-  q = 0.0;
-  newQ = 0.0;
-  Vector vector1(stokes_dim), abs_vec_mono(stokes_dim), I_i(stokes_dim);
+  Matrix R_ant2enu(3, 3);  // Needed for antenna rotations
   Vector Isum(stokes_dim), Isquaredsum(stokes_dim);
-  Index termination_flag = 0;
   const Numeric f_mono = f_grid[f_index];
   const Numeric prop_dir =
       -1.0;  // propagation direction opposite of los angles
@@ -236,15 +245,6 @@ void MCGeneral(Workspace& ws,
   mc_source_domain.resize(4);
   mc_source_domain = 0;
 
-  //local versions of workspace
-  Numeric local_surface_skin_t;
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Index np;
   Isum = 0.0;
   Isquaredsum = 0.0;
   Numeric std_err_i;
@@ -265,23 +265,51 @@ void MCGeneral(Workspace& ws,
   // Calculate rotation matrix for boresight
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
 
-  //Begin Main Loop
-  //
-  bool keepgoing, oksampling;
-  Index nfails = 0;
-  //
-  while (true) {
-    // Complete content of while inside try/catch to handle occasional
+  // Traces a single photon.  Each photon draws from its own random number
+  // stream, so the photon does not depend on the thread tracing it
+  const auto trace_photon = [&](Workspace& photon_ws,
+                                MCGeneralPhoton& photon,
+                                Index iphoton) {
+    RandomNumberStream rng(mc_seed, iphoton);
+
+    Ppath ppath_step;
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Numeric g, temperature, albedo, g_los_csc_theta;
+    Matrix Q(stokes_dim, stokes_dim);
+    Matrix evol_op(stokes_dim, stokes_dim);
+    Matrix ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix q(stokes_dim, stokes_dim), newQ(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);
+    q = 0.0;
+    newQ = 0.0;
+    Vector vector1(stokes_dim), abs_vec_mono(stokes_dim);
+    Vector& I_i = photon.I;
+    Index termination_flag = 0;
+
+    //local versions of workspace
+    Numeric local_surface_skin_t;
+    Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
+    Matrix local_surface_los;
+    Tensor4 local_surface_rmatrix;
+    Vector local_rte_pos(3);  // Fixed this (changed from 2 to 3)
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
+
+    I_i.resize(stokes_dim);
+    photon.scattering_order = 0;
+    photon.source_domain = -1;
+    photon.oksampling = true;  // gets false if g becomes zero
+    photon.failed = false;
+
+    // Complete content inside try/catch to handle occasional
     // failures in the ppath calculations
     try {
       bool inside_cloud;
+      Index& scattering_order = photon.scattering_order;
 
-      mc_iteration_count += 1;
-      Index scattering_order = 0;
-
-      keepgoing = true;   // indicating whether to continue tracing a photon
-      oksampling = true;  // gets false if g becomes zero
-
+      bool keepgoing = true;  // indicating whether to continue tracing a photon
       //Sample a FOV direction
       Matrix R_prop(3, 3);
       mc_antenna.draw_los(
@@ -295,7 +323,7 @@ void MCGeneral(Workspace& ws,
       I_i = 0.0;
 
       while (keepgoing) {
-        mcPathTraceGeneral(ws,
+        mcPathTraceGeneral(photon_ws,
                            evol_op,
                            abs_vec_mono,
                            temperature,
@@ -339,12 +367,9 @@ void MCGeneral(Workspace& ws,
         // scenarios, as this goes wrong regardless of the scenario.
         if (g == 0) {
           keepgoing = false;
-          oksampling = false;
-          mc_iteration_count -= 1;
-          out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
-               << "happens repeatedly, try to decrease *ppath_lmax*)";
+          photon.oksampling = false;
         } else if (termination_flag == 1) {
-          iy_space_agendaExecute(ws,
+          iy_space_agendaExecute(photon_ws,
                                  local_iy,
                                  Vector(1, f_mono),
                                  local_rte_pos,
@@ -354,10 +379,10 @@ void MCGeneral(Workspace& ws,
           mult(I_i, Q, vector1);
           I_i /= g;
           keepgoing = false;  //stop here. New photon.
-          mc_source_domain[0] += 1;
+          photon.source_domain = 0;
         } else if (termination_flag == 2) {
           //Calculate surface properties
-          surface_rtprop_agendaExecute(ws,
+          surface_rtprop_agendaExecute(photon_ws,
                                        local_surface_skin_t,
                                        local_surface_emission,
                                        local_surface_los,
@@ -377,7 +402,7 @@ void MCGeneral(Workspace& ws,
             mult(I_i, Q, vector1);
             I_i /= g;
             keepgoing = false;
-            mc_source_domain[1] += 1;
+            photon.source_domain = 1;
           } else
           //decide between reflection and emission
           {
@@ -394,7 +419,7 @@ void MCGeneral(Workspace& ws,
               mult(I_i, Q, vector1);
               I_i /= g * (1 - R11);
               keepgoing = false;
-              mc_source_domain[1] += 1;
+              photon.source_domain = 1;
             } else {
               //we have reflection
               // determine which reflection los to use
@@ -429,7 +454,7 @@ void MCGeneral(Workspace& ws,
             emissioncontri /= (g * (1 - albedo));  //yuck!
             mult(I_i, Q, emissioncontri);
             keepgoing = false;
-            mc_source_domain[3] += 1;
+            photon.source_domain = 3;
           } else {
             //we have a scattering event
             Sample_los(new_rte_los,
@@ -465,62 +490,118 @@ void MCGeneral(Workspace& ws,
           emissioncontri /= g;
           mult(I_i, Q, emissioncontri);
           keepgoing = false;
-          mc_source_domain[2] += 1;
+          photon.source_domain = 2;
         }
       }  // keepgoing
-
-      if (oksampling) {
+      if (photon.oksampling) {
         // Set spome of the bookkeeping variables
-        np = ppath_step.np;
-        mc_points(ppath_step.gp_p[np - 1].idx,
-                  ppath_step.gp_lat[np - 1].idx,
-                  ppath_step.gp_lon[np - 1].idx) += 1;
-        if (scattering_order < l_mc_scat_order) {
-          mc_scat_order[scattering_order] += 1;
-        }
+        const Index np = ppath_step.np;
+        photon.point = {ppath_step.gp_p[np - 1].idx,
+                        ppath_step.gp_lat[np - 1].idx,
+                        ppath_step.gp_lon[np - 1].idx};
 
         // Rotate into antenna polarization frame
         Vector I_hold(stokes_dim);
         mult(I_hold, R_stokes, I_i);
-        Isum += I_i;
-
-        for (Index j = 0; j < stokes_dim; j++) {
-          ARTS_ASSERT(!std::isnan(I_i[j]));
-          Isquaredsum[j] += I_i[j] * I_i[j];
-        }
-        y = Isum;
-        y /= (Numeric)mc_iteration_count;
-        for (Index j = 0; j < stokes_dim; j++) {
-          mc_error[j] = sqrt(
-              (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
-              (Numeric)mc_iteration_count);
-        }
-        if (std_err > 0 && mc_iteration_count >= min_iter &&
-            mc_error[0] < std_err_i) {
-          break;
-        }
-        if (max_time > 0 && (Index)(time(NULL) - start_time) >= max_time) {
-          break;
-        }
-        if (max_iter > 0 && mc_iteration_count >= max_iter) {
-          break;
-        }
       }
     }  // Try
 
     catch (const std::runtime_error& e) {
+      photon.failed = true;
+      photon.error = e.what();
+    }
+  };
+
+  //Begin Main Loop
+  //
+  // Photons are traced in parallel batches, and are then added to the
+  // statistics in the order they were launched.  The convergence is tested
+  // after each added photon, so the result only depends on mc_seed and not on
+  // the number of threads
+  const Index nthreads = arts_omp_get_available_threads();
+  const WorkspaceOmpParallelCopyGuard wss_orig{ws, nthreads > 1};
+  std::vector<WorkspaceOmpParallelCopyGuard> wss(nthreads, wss_orig);
+  const Index nbatch = 4 * nthreads;
+  std::vector<MCGeneralPhoton> photons(nbatch);
+  Index nfails = 0;
+  bool converged = false;
+  //
+  for (Index first = 0; not converged; first += nbatch) {
+#pragma omp parallel for schedule(dynamic) num_threads(int(nthreads)) \
+    if (nthreads > 1)
+    for (Index i = 0; i < nbatch; i++) {
+      photons[i].aborted = false;
+      try {
+        trace_photon(wss[arts_omp_get_thread_num()], photons[i], first + i);
+      } catch (const std::exception& e) {
+        photons[i].aborted = true;
+        photons[i].error = e.what();
+      }
+    }
+
+    for (auto& photon : photons) {
+      ARTS_USER_ERROR_IF(photon.aborted, photon.error)
+
       mc_iteration_count += 1;
-      nfails += 1;
-      out0 << "WARNING: A MC path sampling failed! Error was:\n";
-      cout << e.what() << endl;
-      if (nfails >= 5) {
-        throw runtime_error(
-            "The MC path sampling has failed five times. A few failures "
-            "should be OK, but this number is suspiciously high and the "
-            "reason to these failures should be tracked down.");
+
+      if (photon.failed) {
+        mc_iteration_count += 1;
+        nfails += 1;
+        out0 << "WARNING: A MC path sampling failed! Error was:\n";
+        cout << photon.error << endl;
+        if (nfails >= 5) {
+          throw runtime_error(
+              "The MC path sampling has failed five times. A few failures "
+              "should be OK, but this number is suspiciously high and the "
+              "reason to these failures should be tracked down.");
+        }
+        continue;
+      }
+
+      if (photon.source_domain >= 0)
+        mc_source_domain[photon.source_domain] += 1;
+
+      // GH 2011-09-08: if the lowest layer has large
+      // extent and a thick cloud, g may be 0 due to
+      // underflow, but then I_i should be 0 as well.
+      if (not photon.oksampling) {
+        mc_iteration_count -= 1;
+        out0 << "WARNING: A rejected path sampling (g=0)!\n(if this"
+             << "happens repeatedly, try to decrease *ppath_lmax*)";
+        continue;
       }
+
+      const Vector& I_i = photon.I;
+      mc_points(photon.point[0], photon.point[1], photon.point[2]) += 1;
+      if (photon.scattering_order < l_mc_scat_order) {
+        mc_scat_order[photon.scattering_order] += 1;
+      }
+
+      Isum += I_i;
+
+      for (Index j = 0; j < stokes_dim; j++) {
+        ARTS_ASSERT(!std::isnan(I_i[j]));
+        Isquaredsum[j] += I_i[j] * I_i[j];
+      }
+      y = Isum;
+      y /= (Numeric)mc_iteration_count;
+      for (Index j = 0; j < stokes_dim; j++) {
+        mc_error[j] = sqrt(
+            (Isquaredsum[j] / (Numeric)mc_iteration_count - y[j] * y[j]) /
+            (Numeric)mc_iteration_count);
+      }
+      if (std_err > 0 && mc_iteration_count >= min_iter &&
+          mc_error[0] < std_err_i) {
+        converged = true;
+      } else if (max_time > 0 &&
+                 (Index)(time(NULL) - start_time) >= max_time) {
+        converged = true;
+      } else if (max_iter > 0 && mc_iteration_count >= max_iter) {
+        converged = true;
+      }
+      if (converged) break;
     }
-  }  // while
+  }  // for
 
   if (convert_to_rjbt) {
     for (Index j = 0; j < stokes_dim; j++) {
@@ -657,43 +738,15 @@ void MCRadar(  // Workspace reference:
         "Gaussian antenna patterns.");
   }
 
-  Ppath ppath_step;
-  RandomNumberGenerator<> rng(mc_seed);                          //Random Number generator
   Index N_se = pnd_field.nbooks();  //Number of scattering elements
-  Vector pnd_vec(
-      N_se);  //Vector of particle number densities used at each point
   bool anyptype_nonTotRan = is_anyptype_nonTotRan(scat_data);
   bool is_dist = max(range_bins) > 1;  // Is it round trip time or distance
-  
-  Numeric ppath_lraytrace_var;
-  //Numeric temperature, albedo;
-  Numeric albedo;
-  Numeric Csca, Cext;
-  Numeric antenna_wgt;
-  Matrix evol_op(stokes_dim, stokes_dim), ext_mat_mono(stokes_dim, stokes_dim);
-  Matrix trans_mat(stokes_dim, stokes_dim);
-  Matrix Z(stokes_dim, stokes_dim);
-  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3), R_stokes(stokes_dim, stokes_dim);
-  Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+
+  Matrix R_ant2enu(3, 3), R_enu2ant(3, 3);
   Vector Isum(nbins * stokes_dim), Isquaredsum(nbins * stokes_dim);
-  Index termination_flag = 0;
   Vector bin_height(nbins);
   Vector range_bin_count(nbins);
   Index mc_iter;
-  Index scat_order;
-
-  // allocating variables needed for pha_mat extraction (don't want to do this
-  // in every loop step again).
-  ArrayOfArrayOfTensor6 pha_mat_Nse;
-  ArrayOfArrayOfIndex ptypes_Nse;
-  Matrix t_ok;
-  ArrayOfTensor6 pha_mat_ssbulk;
-  ArrayOfIndex ptype_ssbulk;
-  Tensor6 pha_mat_bulk;
-  Index ptype_bulk;
-  Matrix pdir_array(1, 2), idir_array(1, 2);
-  Vector t_array(1);
-  Matrix pnds(N_se, 1);
 
   // for pha_mat handling, at the moment we still need scat_data_mono. Hence,
   // extract that here (but in its local container, not into the WSV
@@ -721,19 +774,8 @@ void MCRadar(  // Workspace reference:
   // this will need to be reshaped differently for range gates
   mc_error.resize(stokes_dim * nbins);
 
-  //local versions of workspace
-  Matrix local_iy(1, stokes_dim), local_surface_emission(1, stokes_dim);
-  Matrix local_surface_los;
-  Tensor4 local_surface_rmatrix;
-  Vector local_rte_pos(3);
-  Vector local_rte_los(2);
-  Vector new_rte_los(2);
-  Vector Ipath(stokes_dim), Ihold(stokes_dim), Ipath_norm(stokes_dim);
   Isum = 0.0;
   Isquaredsum = 0.0;
-  Numeric s_tot, s_return;  // photon distance traveled
-  Numeric t_tot, t_return;  // photon time traveled
-  Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip time
 
   Numeric fac;
   if (iy_unit_radar == "1") {
@@ -756,13 +798,58 @@ void MCRadar(  // Workspace reference:
   rotmat_enu(R_ant2enu, sensor_los(0, joker));
   R_enu2ant = transpose(R_ant2enu);
 
-  //Begin Main Loop
-  bool keepgoing, firstpass, integrity;
-  while (mc_iter < mc_max_iter) {
+  // Traces a single photon.  Each photon draws from its own random number
+  // stream, so the photon does not depend on the thread tracing it
+  const auto trace_photon = [&](Workspace& photon_ws,
+                                MCRadarPhoton& photon,
+                                Index iphoton) {
+    RandomNumberStream rng(mc_seed, iphoton);
+
+    Ppath ppath_step;
+    Vector pnd_vec(
+        N_se);  //Vector of particle number densities used at each point
+    Numeric ppath_lraytrace_var;
+    Numeric albedo;
+    Numeric Csca, Cext;
+    Numeric antenna_wgt;
+    Matrix evol_op(stokes_dim, stokes_dim);
+    Matrix ext_mat_mono(stokes_dim, stokes_dim);
+    Matrix trans_mat(stokes_dim, stokes_dim);
+    Matrix Z(stokes_dim, stokes_dim);
+    Matrix R_stokes(stokes_dim, stokes_dim);
+    Vector abs_vec_mono(stokes_dim), I_i(stokes_dim), I_i_rot(stokes_dim);
+    Index termination_flag = 0;
+    Index scat_order;
+
+    // allocating variables needed for pha_mat extraction (don't want to do
+    // this in every loop step again).
+    ArrayOfArrayOfTensor6 pha_mat_Nse;
+    ArrayOfArrayOfIndex ptypes_Nse;
+    Matrix t_ok;
+    ArrayOfTensor6 pha_mat_ssbulk;
+    ArrayOfIndex ptype_ssbulk;
+    Tensor6 pha_mat_bulk;
+    Index ptype_bulk;
+    Matrix pdir_array(1, 2), idir_array(1, 2);
+    Vector t_array(1);
+    Matrix pnds(N_se, 1);
+
+    //local versions of workspace
+    Vector local_rte_pos(3);
+    Vector local_rte_los(2);
+    Vector new_rte_los(2);
+    Vector Ipath(stokes_dim), Ihold(stokes_dim);
+    Numeric s_tot, s_return;  // photon distance traveled
+    Numeric t_tot, t_return;  // photon time traveled
+    Numeric r_trav, r_bin;  // range traveled (1-way distance) or round-trip
+                            // time
+
+    photon.bins.resize(0);
+    photon.I.resize(0);
+    photon.failed = false;
+
+    bool keepgoing, firstpass, integrity;
     bool inside_cloud;
-
-    mc_iter += 1;
-
     integrity = true;  // intensity is not nan or below threshold
     keepgoing = true;  // indicating whether to continue tracing a photon
     firstpass = true;  // ensure backscatter is properly calculated
@@ -782,7 +869,7 @@ void MCRadar(  // Workspace reference:
     while (keepgoing) {
       Numeric s_path, t_path;
 
-      mcPathTraceRadar(ws,
+      mcPathTraceRadar(photon_ws,
                        evol_op,
                        abs_vec_mono,
                        t_array[0],
@@ -885,7 +972,7 @@ void MCRadar(  // Workspace reference:
                                             local_rte_pos,
                                             verbosity);
 
-        ppathFromRtePos2(ws,
+        ppathFromRtePos2(photon_ws,
                          ppath,
                          rte_los_antenna,
                          ppath_lraytrace_var,
@@ -930,7 +1017,7 @@ void MCRadar(  // Workspace reference:
         // Still within max range of radar?
         if (r_trav <= r_max) {
           // Compute path extinction as with radio link
-          get_ppath_transmat(ws,
+          get_ppath_transmat(photon_ws,
                              trans_mat,
                              ppath,
                              propmat_clearsky_agenda,
@@ -1005,13 +1092,11 @@ void MCRadar(  // Workspace reference:
             mult(I_i_rot, R_stokes, I_i);
 
             for (Index istokes = 0; istokes < stokes_dim; istokes++) {
-              Index ibiny = ibin * stokes_dim + istokes;
               ARTS_ASSERT(!std::isnan(I_i_rot[istokes]));
-              Isum[ibiny] += antenna_wgt * I_i_rot[istokes];
-              Isquaredsum[ibiny] += antenna_wgt * antenna_wgt *
-                                    I_i_rot[istokes] * I_i_rot[istokes];
             }
-            range_bin_count[ibin] += 1;
+            I_i_rot *= antenna_wgt;
+            photon.bins.push_back(ibin);
+            photon.I.push_back(I_i_rot);
           }
 
           scat_order++;
@@ -1060,6 +1145,46 @@ void MCRadar(  // Workspace reference:
       if (!integrity) keepgoing = false;
     }  // while (inner: keepgoing)
 
+  };
+
+  //Begin Main Loop
+  //
+  // Photons are traced in parallel batches, and are then added to the range
+  // bins in the order they were launched, so the result only depends on
+  // mc_seed and not on the number of threads
+  const Index nthreads = arts_omp_get_available_threads();
+  const WorkspaceOmpParallelCopyGuard wss_orig{ws, nthreads > 1};
+  std::vector<WorkspaceOmpParallelCopyGuard> wss(nthreads, wss_orig);
+  std::vector<MCRadarPhoton> photons(64 * nthreads);
+  while (mc_iter < mc_max_iter) {
+    const Index nbatch = min(Index(photons.size()), mc_max_iter - mc_iter);
+
+#pragma omp parallel for schedule(dynamic) num_threads(int(nthreads)) \
+    if (nthreads > 1)
+    for (Index i = 0; i < nbatch; i++) {
+      try {
+        trace_photon(wss[arts_omp_get_thread_num()], photons[i], mc_iter + i);
+      } catch (const std::exception& e) {
+        photons[i].failed = true;
+        photons[i].error = e.what();
+      }
+    }
+
+    for (Index i = 0; i < nbatch; i++) {
+      const MCRadarPhoton& photon = photons[i];
+      ARTS_USER_ERROR_IF(photon.failed, photon.error)
+
+      for (Index j = 0; j < photon.bins.nelem(); j++) {
+        const Index ibin = photon.bins[j];
+        for (Index istokes = 0; istokes < stokes_dim; istokes++) {
+          Index ibiny = ibin * stokes_dim + istokes;
+          Isum[ibiny] += photon.I[j][istokes];
+          Isquaredsum[ibiny] += photon.I[j][istokes] * photon.I[j][istokes];
+        }
+        range_bin_count[ibin] += 1;
+      }
+    }
+    mc_iter += nbatch;
   }  // while (outer)
 
   // Normalize range bins and apply sensor response (polarization)
@@ -22,6 +22,7 @@
 #include "arts.h"
 #include "arts_constants.h"
 #include "arts_conversions.h"
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "exceptions.h"
@@ -107,9 +108,8 @@ void pha_mat_sptFromData(  // Output:
 
   const Index N_ss = scat_data.nelem();
 
-  // Phase matrix in laboratory coordinate system. Dimensions:
-  // [frequency, za_inc, aa_inc, stokes_dim, stokes_dim]
-  Tensor5 pha_mat_data_int;
+  // Interpolated data, kept for the DOIT run, if any
+  const SsdInterpCachePool::Lease cache;
 
   Index i_se_flat = 0;
   // Loop over scattering species
@@ -127,105 +127,123 @@ void pha_mat_sptFromData(  // Output:
         // used in the database (depending on the kind of ptype) to the
         // laboratory coordinate system.
 
-        // Frequency and temperature interpolation:
-
-        // Container for data at one frequency and one temperature.
-        pha_mat_data_int.resize(PHA_MAT_DATA.nshelves(),
-                                PHA_MAT_DATA.nbooks(),
-                                PHA_MAT_DATA.npages(),
-                                PHA_MAT_DATA.nrows(),
-                                PHA_MAT_DATA.ncols());
-
-        // Gridpositions:
-        GridPos freq_gp;
-        gridpos(freq_gp, F_DATAGRID, f_grid[f_index]);
-        GridPos t_gp;
-        Vector itw;
-
-        Index ti = -1;
-
-        if (PHA_MAT_DATA.nvitrines() == 1)  // just 1 T_grid element
-        {
-          ti = 0;
-        } else if (rtp_temperature < 0.)  // coding for 'not interpolate, but
-                                          // pick one temperature'
-        {
-          if (rtp_temperature > -10.)  // lowest T-point
-          {
-            ti = 0;
-          } else if (rtp_temperature > -20.)  // highest T-point
-          {
-            ti = T_DATAGRID.nelem() - 1;
-          } else  // median T-point
-          {
-            ti = T_DATAGRID.nelem() / 2;
-          }
-        }
-
-        if (ti < 0)  // temperature interpolation
-        {
-          ostringstream os;
-          os << "In pha_mat_sptFromData.\n"
-             << "The temperature grid of the scattering data does not\n"
-             << "cover the atmospheric temperature at cloud location.\n"
-             << "The data should include the value T = " << rtp_temperature
-             << " K.";
-          chk_interpolation_grids(os.str(), T_DATAGRID, rtp_temperature);
-
-          gridpos(t_gp, T_DATAGRID, rtp_temperature);
+        // Frequency and temperature interpolation, unless cached
+        const Tensor5& pha_mat_data_int =
+            cache->pha_mat(
+                scat_data[i_ss][i_se],
+                f_grid[f_index],
+                rtp_temperature,
+                [&](Tensor5& data_int) {
+                  // Container for data at one frequency and one temperature.
+                  data_int.resize(PHA_MAT_DATA.nshelves(),
+                                  PHA_MAT_DATA.nbooks(),
+                                  PHA_MAT_DATA.npages(),
+                                  PHA_MAT_DATA.nrows(),
+                                  PHA_MAT_DATA.ncols());
+
+                  // Gridpositions:
+                  GridPos freq_gp;
+                  gridpos(freq_gp, F_DATAGRID, f_grid[f_index]);
+                  GridPos t_gp;
+                  Vector itw;
+
+                  Index ti = -1;
+
+                  if (PHA_MAT_DATA.nvitrines() == 1)  // just 1 T_grid element
+                  {
+                    ti = 0;
+                  } else if (rtp_temperature < 0.)  // coding for 'not
+                                                    // interpolate, but pick
+                                                    // one temperature'
+                  {
+                    if (rtp_temperature > -10.)  // lowest T-point
+                    {
+                      ti = 0;
+                    } else if (rtp_temperature > -20.)  // highest T-point
+                    {
+                      ti = T_DATAGRID.nelem() - 1;
+                    } else  // median T-point
+                    {
+                      ti = T_DATAGRID.nelem() / 2;
+                    }
+                  }
 
-          // Interpolation weights:
-          itw.resize(4);
-          interpweights(itw, freq_gp, t_gp);
-
-          for (Index i_za_sca = 0; i_za_sca < PHA_MAT_DATA.nshelves();
-               i_za_sca++)
-            for (Index i_aa_sca = 0; i_aa_sca < PHA_MAT_DATA.nbooks();
-                 i_aa_sca++)
-              for (Index i_za_inc = 0; i_za_inc < PHA_MAT_DATA.npages();
-                   i_za_inc++)
-                for (Index i_aa_inc = 0; i_aa_inc < PHA_MAT_DATA.nrows();
-                     i_aa_inc++)
-                  for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
-                    // Interpolation of phase matrix:
-                    pha_mat_data_int(
-                        i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
-                        interp(itw,
-                               PHA_MAT_DATA(joker,
-                                            joker,
-                                            i_za_sca,
-                                            i_aa_sca,
-                                            i_za_inc,
-                                            i_aa_inc,
-                                            i),
-                               freq_gp,
-                               t_gp);
-        } else {
-          // Interpolation weights:
-          itw.resize(2);
-          interpweights(itw, freq_gp);
-          for (Index i_za_sca = 0; i_za_sca < PHA_MAT_DATA.nshelves();
-               i_za_sca++)
-            for (Index i_aa_sca = 0; i_aa_sca < PHA_MAT_DATA.nbooks();
-                 i_aa_sca++)
-              for (Index i_za_inc = 0; i_za_inc < PHA_MAT_DATA.npages();
-                   i_za_inc++)
-                for (Index i_aa_inc = 0; i_aa_inc < PHA_MAT_DATA.nrows();
-                     i_aa_inc++)
-                  for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
-                    // Interpolation of phase matrix:
-                    pha_mat_data_int(
-                        i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
-                        interp(itw,
-                               PHA_MAT_DATA(joker,
-                                            ti,
-                                            i_za_sca,
-                                            i_aa_sca,
-                                            i_za_inc,
-                                            i_aa_inc,
-                                            i),
-                               freq_gp);
-        }
+                  if (ti < 0)  // temperature interpolation
+                  {
+                    ostringstream os;
+                    os << "In pha_mat_sptFromData.\n"
+                       << "The temperature grid of the scattering data does "
+                          "not\n"
+                       << "cover the atmospheric temperature at cloud "
+                          "location.\n"
+                       << "The data should include the value T = "
+                       << rtp_temperature << " K.";
+                    chk_interpolation_grids(
+                        os.str(), T_DATAGRID, rtp_temperature);
+
+                    gridpos(t_gp, T_DATAGRID, rtp_temperature);
+
+                    // Interpolation weights:
+                    itw.resize(4);
+                    interpweights(itw, freq_gp, t_gp);
+
+                    for (Index i_za_sca = 0;
+                         i_za_sca < PHA_MAT_DATA.nshelves();
+                         i_za_sca++)
+                      for (Index i_aa_sca = 0;
+                           i_aa_sca < PHA_MAT_DATA.nbooks();
+                           i_aa_sca++)
+                        for (Index i_za_inc = 0;
+                             i_za_inc < PHA_MAT_DATA.npages();
+                             i_za_inc++)
+                          for (Index i_aa_inc = 0;
+                               i_aa_inc < PHA_MAT_DATA.nrows();
+                               i_aa_inc++)
+                            for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
+                              // Interpolation of phase matrix:
+                              data_int(
+                                  i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
+                                  interp(itw,
+                                         PHA_MAT_DATA(joker,
+                                                      joker,
+                                                      i_za_sca,
+                                                      i_aa_sca,
+                                                      i_za_inc,
+                                                      i_aa_inc,
+                                                      i),
+                                         freq_gp,
+                                         t_gp);
+                  } else {
+                    // Interpolation weights:
+                    itw.resize(2);
+                    interpweights(itw, freq_gp);
+                    for (Index i_za_sca = 0;
+                         i_za_sca < PHA_MAT_DATA.nshelves();
+                         i_za_sca++)
+                      for (Index i_aa_sca = 0;
+                           i_aa_sca < PHA_MAT_DATA.nbooks();
+                           i_aa_sca++)
+                        for (Index i_za_inc = 0;
+                             i_za_inc < PHA_MAT_DATA.npages();
+                             i_za_inc++)
+                          for (Index i_aa_inc = 0;
+                               i_aa_inc < PHA_MAT_DATA.nrows();
+                               i_aa_inc++)
+                            for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
+                              // Interpolation of phase matrix:
+                              data_int(
+                                  i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
+                                  interp(itw,
+                                         PHA_MAT_DATA(joker,
+                                                      ti,
+                                                      i_za_sca,
+                                                      i_aa_sca,
+                                                      i_za_inc,
+                                                      i_aa_inc,
+                                                      i),
+                                         freq_gp);
+                  }
+                });
 
         // Do the transformation into the laboratory coordinate system.
         for (Index za_inc_idx = 0; za_inc_idx < za_grid.nelem();
@@ -478,15 +496,13 @@ void opt_prop_sptFromData(  // Output and Input:
     throw runtime_error(os.str());
   }
 
-  // Phase matrix in laboratory coordinate system. Dimensions:
-  // [frequency, za_inc, aa_inc, stokes_dim, stokes_dim]
-  Tensor3 ext_mat_data_int;
-  Tensor3 abs_vec_data_int;
-
   // Initialisation
   ext_mat_spt = 0.;
   abs_vec_spt = 0.;
 
+  // Interpolated data, kept for the DOIT run, if any
+  const SsdInterpCachePool::Lease cache;
+
   Index i_se_flat = 0;
   // Loop over the included scattering species
   for (Index i_ss = 0; i_ss < N_ss; i_ss++) {
@@ -504,109 +520,51 @@ void opt_prop_sptFromData(  // Output and Input:
         // used in the database (depending on the kind of ptype) to the
         // laboratory coordinate system.
 
-        // Frequency interpolation:
-
-        // The data is interpolated on one frequency.
-        //
-        // Resize the variables for the interpolated data:
-        //
-        ext_mat_data_int.resize(
-            EXT_MAT_DATA.npages(), EXT_MAT_DATA.nrows(), EXT_MAT_DATA.ncols());
-        //
-        abs_vec_data_int.resize(
-            ABS_VEC_DATA.npages(), ABS_VEC_DATA.nrows(), ABS_VEC_DATA.ncols());
-
-        // Gridpositions:
-        GridPos freq_gp;
-        gridpos(freq_gp, F_DATAGRID, f_grid[f_index]);
-        GridPos t_gp;
-        Vector itw;
-
-        if (T_DATAGRID.nelem() > 1) {
-          ostringstream os;
-          os << "In opt_prop_sptFromData.\n"
-             << "The temperature grid of the scattering data does not\n"
-             << "cover the atmospheric temperature at cloud location.\n"
-             << "The data should include the value T = " << rtp_temperature
-             << " K.";
-          chk_interpolation_grids(os.str(), T_DATAGRID, rtp_temperature);
-
-          gridpos(t_gp, T_DATAGRID, rtp_temperature);
+        // Frequency and temperature interpolation, unless cached
+        const auto interpolate = [&](Tensor3& data_int, const Tensor5& data) {
+          data_int.resize(data.npages(), data.nrows(), data.ncols());
 
-          // Interpolation weights:
-          itw.resize(4);
-          interpweights(itw, freq_gp, t_gp);
+          // Gridpositions:
+          GridPos freq_gp;
+          gridpos(freq_gp, F_DATAGRID, f_grid[f_index]);
+          GridPos t_gp;
+          Vector itw;
 
-          for (Index i_za_sca = 0; i_za_sca < EXT_MAT_DATA.npages();
-               i_za_sca++) {
-            for (Index i_aa_sca = 0; i_aa_sca < EXT_MAT_DATA.nrows();
-                 i_aa_sca++) {
-              //
-              // Interpolation of extinction matrix:
-              //
-              for (Index i = 0; i < EXT_MAT_DATA.ncols(); i++) {
-                ext_mat_data_int(i_za_sca, i_aa_sca, i) =
-                    interp(itw,
-                           EXT_MAT_DATA(joker, joker, i_za_sca, i_aa_sca, i),
-                           freq_gp,
-                           t_gp);
-              }
-            }
-          }
+          if (T_DATAGRID.nelem() > 1) {
+            ostringstream os;
+            os << "In opt_prop_sptFromData.\n"
+               << "The temperature grid of the scattering data does not\n"
+               << "cover the atmospheric temperature at cloud location.\n"
+               << "The data should include the value T = " << rtp_temperature
+               << " K.";
+            chk_interpolation_grids(os.str(), T_DATAGRID, rtp_temperature);
 
-          for (Index i_za_sca = 0; i_za_sca < ABS_VEC_DATA.npages();
-               i_za_sca++) {
-            for (Index i_aa_sca = 0; i_aa_sca < ABS_VEC_DATA.nrows();
-                 i_aa_sca++) {
-              //
-              // Interpolation of absorption vector:
-              //
-              for (Index i = 0; i < ABS_VEC_DATA.ncols(); i++) {
-                abs_vec_data_int(i_za_sca, i_aa_sca, i) =
-                    interp(itw,
-                           ABS_VEC_DATA(joker, joker, i_za_sca, i_aa_sca, i),
-                           freq_gp,
-                           t_gp);
-              }
-            }
-          }
-        } else {
-          // Interpolation weights:
-          itw.resize(2);
-          interpweights(itw, freq_gp);
+            gridpos(t_gp, T_DATAGRID, rtp_temperature);
 
-          for (Index i_za_sca = 0; i_za_sca < EXT_MAT_DATA.npages();
-               i_za_sca++) {
-            for (Index i_aa_sca = 0; i_aa_sca < EXT_MAT_DATA.nrows();
-                 i_aa_sca++) {
-              //
-              // Interpolation of extinction matrix:
-              //
-              for (Index i = 0; i < EXT_MAT_DATA.ncols(); i++) {
-                ext_mat_data_int(i_za_sca, i_aa_sca, i) =
-                    interp(itw,
-                           EXT_MAT_DATA(joker, 0, i_za_sca, i_aa_sca, i),
-                           freq_gp);
-              }
-            }
-          }
+            // Interpolation weights:
+            itw.resize(4);
+            interpweights(itw, freq_gp, t_gp);
 
-          for (Index i_za_sca = 0; i_za_sca < ABS_VEC_DATA.npages();
-               i_za_sca++) {
-            for (Index i_aa_sca = 0; i_aa_sca < ABS_VEC_DATA.nrows();
-                 i_aa_sca++) {
-              //
-              // Interpolation of absorption vector:
-              //
-              for (Index i = 0; i < ABS_VEC_DATA.ncols(); i++) {
-                abs_vec_data_int(i_za_sca, i_aa_sca, i) =
-                    interp(itw,
-                           ABS_VEC_DATA(joker, 0, i_za_sca, i_aa_sca, i),
-                           freq_gp);
-              }
-            }
+            for (Index i_za_sca = 0; i_za_sca < data.npages(); i_za_sca++)
+              for (Index i_aa_sca = 0; i_aa_sca < data.nrows(); i_aa_sca++)
+                for (Index i = 0; i < data.ncols(); i++)
+                  data_int(i_za_sca, i_aa_sca, i) =
+                      interp(itw,
+                             data(joker, joker, i_za_sca, i_aa_sca, i),
+                             freq_gp,
+                             t_gp);
+          } else {
+            // Interpolation weights:
+            itw.resize(2);
+            interpweights(itw, freq_gp);
+
+            for (Index i_za_sca = 0; i_za_sca < data.npages(); i_za_sca++)
+              for (Index i_aa_sca = 0; i_aa_sca < data.nrows(); i_aa_sca++)
+                for (Index i = 0; i < data.ncols(); i++)
+                  data_int(i_za_sca, i_aa_sca, i) = interp(
+                      itw, data(joker, 0, i_za_sca, i_aa_sca, i), freq_gp);
           }
-        }
+        };
 
         //
         // Do the transformation into the laboratory coordinate system.
@@ -614,7 +572,13 @@ void opt_prop_sptFromData(  // Output and Input:
         // Extinction matrix:
         //
         ext_matTransform(ext_mat_spt[i_se_flat],
-                         ext_mat_data_int,
+                         cache->ext_mat(scat_data[i_ss][i_se],
+                                        f_grid[f_index],
+                                        rtp_temperature,
+                                        [&](Tensor3& ext_mat_data_int) {
+                                          interpolate(ext_mat_data_int,
+                                                      EXT_MAT_DATA);
+                                        }),
                          ZA_DATAGRID,
                          AA_DATAGRID,
                          PART_TYPE,
@@ -625,7 +589,13 @@ void opt_prop_sptFromData(  // Output and Input:
         // Absorption vector:
         //
         abs_vecTransform(abs_vec_spt[i_se_flat],
-                         abs_vec_data_int,
+                         cache->abs_vec(scat_data[i_ss][i_se],
+                                        f_grid[f_index],
+                                        rtp_temperature,
+                                        [&](Tensor3& abs_vec_data_int) {
+                                          interpolate(abs_vec_data_int,
+                                                      ABS_VEC_DATA);
+                                        }),
                          ZA_DATAGRID,
                          AA_DATAGRID,
                          PART_TYPE,
@@ -1343,6 +1313,9 @@ void DoitScatteringDataPrepare(
         "The scattering data must be flagged to have "
         "passed a consistency check (scat_data_checked=1).");
 
+  // Checked here, as the phase matrices are transformed in parallel
+  chk_if_in_range("stokes_dim", stokes_dim, 1, 4);
+
   // Number of azimuth angles.
   const Index Naa = aa_grid.nelem();
   Vector grid_stepsize(2);
@@ -1403,7 +1376,11 @@ void DoitScatteringDataPrepare(
       pha_mat_sptDOITOpt[i_se_flat] = 0.;
 
       // Calculate all scattering angles for all combinations of incoming
-      // and scattered directions and interpolation.
+      // and scattered directions and interpolation. Each combination
+      // fills its own part of the kernel.
+      const int nthreads = arts_omp_get_available_threads();
+#pragma omp parallel for collapse(2) num_threads(nthreads) \
+    if (nthreads > 1 && N_T * doit_za_grid_size > 1)
       for (Index t_idx = 0; t_idx < N_T; t_idx++) {
         // These are the scattered directions as called in *scat_field_calc*
         for (Index za_sca_idx = 0; za_sca_idx < doit_za_grid_size;
@@ -2605,11 +2582,8 @@ void pha_mat_sptFromScat_data(  // Output:
 
   const Index N_ss = scat_data.nelem();
 
-  // Phase matrix in laboratory coordinate system. Dimensions:
-  // [frequency, za_inc, aa_inc, stokes_dim, stokes_dim]
-  Tensor5 pha_mat_data_int;
-
-  Index this_f_index;
+  // Interpolated data, kept for the DOIT run, if any
+  const SsdInterpCachePool::Lease cache;
 
   Index i_se_flat = 0;
   // Loop over scattering species
@@ -2628,97 +2602,98 @@ void pha_mat_sptFromScat_data(  // Output:
         // used in the database (depending on the kind of ptype) to the
         // laboratory coordinate system.
 
-        // Resize the variables for the interpolated data (1freq, 1T):
-        pha_mat_data_int.resize(PHA_MAT_DATA.nshelves(),
-                                PHA_MAT_DATA.nbooks(),
-                                PHA_MAT_DATA.npages(),
-                                PHA_MAT_DATA.nrows(),
-                                PHA_MAT_DATA.ncols());
-
-        // Frequency extraction and temperature interpolation
-
-        // Gridpositions and interpolation weights;
-        GridPos t_gp;
-        Vector itw;
-        Index this_T_index = -1;
-        if (PHA_MAT_DATA.nvitrines() == 1) {
-          this_T_index = 0;
-        } else if (rtp_temperature < 0.)  // coding for 'not interpolate, but
-                                          // pick one temperature'
-        {
-          if (rtp_temperature > -10.)  // lowest T-point
-          {
-            this_T_index = 0;
-          } else if (rtp_temperature > -20.)  // highest T-point
-          {
-            this_T_index = PHA_MAT_DATA.nvitrines() - 1;
-          } else  // median T-point
-          {
-            this_T_index = PHA_MAT_DATA.nvitrines() / 2;
-          }
-        } else {
-          ostringstream os;
-          os << "In pha_mat_sptFromScat_data.\n"
-             << "The temperature grid of the scattering data does not\n"
-             << "cover the atmospheric temperature at cloud location.\n"
-             << "The data should include the value T = " << rtp_temperature
-             << " K.";
-          chk_interpolation_grids(os.str(), T_DATAGRID, rtp_temperature);
-
-          gridpos(t_gp, T_DATAGRID, rtp_temperature);
-
-          // Interpolation weights:
-          itw.resize(2);
-          interpweights(itw, t_gp);
-        }
-
-        if (PHA_MAT_DATA.nlibraries() == 1)
-          this_f_index = 0;
-        else
-          this_f_index = f_index;
+        const Index this_f_index = PHA_MAT_DATA.nlibraries() == 1 ? 0 : f_index;
+
+        // Frequency extraction and temperature interpolation, unless cached
+        const Tensor5& pha_mat_data_int =
+            cache->pha_mat(
+                scat_data[i_ss][i_se],
+                F_DATAGRID[this_f_index],
+                rtp_temperature,
+                [&](Tensor5& data_int) {
+                  // Gridpositions and interpolation weights;
+                  GridPos t_gp;
+                  Vector itw;
+                  Index this_T_index = -1;
+                  if (PHA_MAT_DATA.nvitrines() == 1) {
+                    this_T_index = 0;
+                  } else if (rtp_temperature < 0.)  // coding for 'not
+                                                    // interpolate, but pick
+                                                    // one temperature'
+                  {
+                    if (rtp_temperature > -10.)  // lowest T-point
+                    {
+                      this_T_index = 0;
+                    } else if (rtp_temperature > -20.)  // highest T-point
+                    {
+                      this_T_index = PHA_MAT_DATA.nvitrines() - 1;
+                    } else  // median T-point
+                    {
+                      this_T_index = PHA_MAT_DATA.nvitrines() / 2;
+                    }
+                  } else {
+                    ostringstream os;
+                    os << "In pha_mat_sptFromScat_data.\n"
+                       << "The temperature grid of the scattering data does "
+                          "not\n"
+                       << "cover the atmospheric temperature at cloud "
+                          "location.\n"
+                       << "The data should include the value T = "
+                       << rtp_temperature << " K.";
+                    chk_interpolation_grids(
+                        os.str(), T_DATAGRID, rtp_temperature);
+
+                    gridpos(t_gp, T_DATAGRID, rtp_temperature);
+
+                    // Interpolation weights:
+                    itw.resize(2);
+                    interpweights(itw, t_gp);
+                  }
 
-        if (this_T_index < 0) {
-          // Interpolation of scattering matrix:
-          for (Index i_za_sca = 0; i_za_sca < PHA_MAT_DATA.nshelves();
-               i_za_sca++)
-            for (Index i_aa_sca = 0; i_aa_sca < PHA_MAT_DATA.nbooks();
-                 i_aa_sca++)
-              for (Index i_za_inc = 0; i_za_inc < PHA_MAT_DATA.npages();
-                   i_za_inc++)
-                for (Index i_aa_inc = 0; i_aa_inc < PHA_MAT_DATA.nrows();
-                     i_aa_inc++)
-                  for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
-                    pha_mat_data_int(
-                        i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
-                        interp(itw,
-                               PHA_MAT_DATA(this_f_index,
-                                            joker,
-                                            i_za_sca,
-                                            i_aa_sca,
-                                            i_za_inc,
-                                            i_aa_inc,
-                                            i),
-                               t_gp);
-        } else {
-          pha_mat_data_int = PHA_MAT_DATA(
-              this_f_index, this_T_index, joker, joker, joker, joker, joker);
-          /*
-                  for (Index i_za_sca = 0;
-                       i_za_sca < PHA_MAT_DATA.nshelves(); i_za_sca++)
-                    for (Index i_aa_sca = 0;
-                         i_aa_sca < PHA_MAT_DATA.nbooks(); i_aa_sca++)
-                      for (Index i_za_inc = 0;
-                           i_za_inc < PHA_MAT_DATA.npages(); i_za_inc++)
-                        for (Index i_aa_inc = 0;
-                             i_aa_inc < PHA_MAT_DATA.nrows(); i_aa_inc++)
-                          for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
-                            // Interpolation of phase matrix:
-                            pha_mat_data_int(i_za_sca, i_aa_sca,
-                                             i_za_inc, i_aa_inc, i) =
-                                PHA_MAT_DATA(this_f_index, this_T_index,
-                                                 i_za_sca, i_aa_sca,
-                  */
-        }
+                  // Resize the variables for the interpolated data
+                  // (1freq, 1T):
+                  data_int.resize(PHA_MAT_DATA.nshelves(),
+                                          PHA_MAT_DATA.nbooks(),
+                                          PHA_MAT_DATA.npages(),
+                                          PHA_MAT_DATA.nrows(),
+                                          PHA_MAT_DATA.ncols());
+
+                  if (this_T_index < 0) {
+                    // Interpolation of scattering matrix:
+                    for (Index i_za_sca = 0;
+                         i_za_sca < PHA_MAT_DATA.nshelves();
+                         i_za_sca++)
+                      for (Index i_aa_sca = 0;
+                           i_aa_sca < PHA_MAT_DATA.nbooks();
+                           i_aa_sca++)
+                        for (Index i_za_inc = 0;
+                             i_za_inc < PHA_MAT_DATA.npages();
+                             i_za_inc++)
+                          for (Index i_aa_inc = 0;
+                               i_aa_inc < PHA_MAT_DATA.nrows();
+                               i_aa_inc++)
+                            for (Index i = 0; i < PHA_MAT_DATA.ncols(); i++)
+                              data_int(
+                                  i_za_sca, i_aa_sca, i_za_inc, i_aa_inc, i) =
+                                  interp(itw,
+                                         PHA_MAT_DATA(this_f_index,
+                                                      joker,
+                                                      i_za_sca,
+                                                      i_aa_sca,
+                                                      i_za_inc,
+                                                      i_aa_inc,
+                                                      i),
+                                         t_gp);
+                  } else {
+                    data_int = PHA_MAT_DATA(this_f_index,
+                                                    this_T_index,
+                                                    joker,
+                                                    joker,
+                                                    joker,
+                                                    joker,
+                                                    joker);
+                  }
+                });
 
         // Do the transformation into the laboratory coordinate system.
         for (Index za_inc_idx = 0; za_inc_idx < za_grid.nelem();
@@ -18,6 +18,7 @@
 #include "geodetic.h"
 #include "gridded_fields.h"
 #include "jacobian.h"
+#include "lineshape.h"
 #include "logic.h"
 #include "math_funcs.h"
 #include "messages.h"
@@ -391,12 +392,13 @@ This feature will be added in a future version.
     const ArrayOfString scat_species_dummy;
     const ArrayOfArrayOfSingleScatteringData scat_data_dummy;
 
+    const int nthreads = arts_omp_get_available_threads();
     WorkspaceOmpParallelCopyGuard wss{ws};;
     ArrayOfString fail_msg;
     bool do_abort = false;
 
     // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1) \
     firstprivate(wss, a, B, dB_dT, S, da_dx, dS_dx)
     for (Index ip = 0; ip < np; ip++) {
       if (do_abort) continue;
@@ -595,7 +597,7 @@ This feature will be added in a future version.
       }
     }
 
-#pragma omp parallel for if (!arts_omp_in_parallel())
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1)
     for (Index ip = 1; ip < np; ip++) {
       if (do_abort) continue;
       try {
@@ -1536,15 +1538,24 @@ void iyEmissionStandard(
     const bool temperature_jacobian =
         j_analytical_do and do_temperature_jacobian(jacobian_quantities);
 
-    // Size radiative variables always used
-    Vector B(nf);
-    StokesVector a(nf, ns), S(nf, ns);
-    RadiationVector J_add_dummy;
-    ArrayOfRadiationVector dJ_add_dummy;
-
-    // Init variables only used if analytical jacobians done
-    Vector dB_dT(temperature_jacobian ? nf : 0);
-    ArrayOfStokesVector da_dx(nq), dS_dx(nq);
+    // Scratch memory, allocated once per thread.  Only the radiative
+    // variables always used are sized if no analytical jacobians are done
+    struct Arena {
+      Vector B;
+      Vector dB_dT;
+      StokesVector a;
+      StokesVector S;
+      ArrayOfStokesVector da_dx;
+      ArrayOfStokesVector dS_dx;
+      RadiationVector J_add_dummy;
+    };
+    Arena arena_init{Vector(nf),
+                     Vector(temperature_jacobian ? nf : 0),
+                     StokesVector(nf, ns),
+                     StokesVector(nf, ns),
+                     ArrayOfStokesVector(nq),
+                     ArrayOfStokesVector(nq),
+                     RadiationVector{}};
 
     // HSE variables
     Index temperature_derivative_position = -1;
@@ -1556,7 +1567,8 @@ void iyEmissionStandard(
         FOR_ANALYTICAL_JACOBIANS_DO(dK_dx[ip][iq] = PropagationMatrix(nf, ns);)
       }
       FOR_ANALYTICAL_JACOBIANS_DO(
-          da_dx[iq] = StokesVector(nf, ns); dS_dx[iq] = StokesVector(nf, ns);
+          arena_init.da_dx[iq] = StokesVector(nf, ns);
+          arena_init.dS_dx[iq] = StokesVector(nf, ns);
           if (jacobian_quantities[iq] == Jacobian::Atm::Temperature) {
             temperature_derivative_position = iq;
             do_hse = jacobian_quantities[iq].Subtag() == "HSE on";
@@ -1566,24 +1578,32 @@ void iyEmissionStandard(
     ArrayOfString fail_msg;
     bool do_abort = false;
 
-    WorkspaceOmpParallelCopyGuard wss{ws};
+    // One arena and workspace per chunk of the path.  The workspace is only
+    // copied if there is more than one chunk
+    const Index nchunks = ppath_fused_chunks(np);
+    std::vector<Arena> arenas(nchunks, arena_init);
+    const WorkspaceOmpParallelCopyGuard wss_orig{ws, nchunks > 1};
+    std::vector<WorkspaceOmpParallelCopyGuard> wss(nchunks, wss_orig);
 
-    // Loop ppath points and determine radiative properties
-#pragma omp parallel for if (!arts_omp_in_parallel()) \
-    firstprivate(wss, a, B, dB_dT, S, da_dx, dS_dx)
-    for (Index ip = 0; ip < np; ip++) {
-      if (do_abort) continue;
+    // Determine radiative properties at a ppath point
+    const auto point = [&](const Index ip, const Index ic) {
+      if (do_abort) return;
       try {
-        get_stepwise_blackbody_radiation(
-            B, dB_dT, ppvar_f(joker, ip), ppvar_t[ip], temperature_jacobian);
+        Arena& arena = arenas[ic];
+
+        get_stepwise_blackbody_radiation(arena.B,
+                                         arena.dB_dT,
+                                         ppvar_f(joker, ip),
+                                         ppvar_t[ip],
+                                         temperature_jacobian);
 
         Index lte;
-        get_stepwise_clearsky_propmat(wss,
+        get_stepwise_clearsky_propmat(wss[ic],
                                       K[ip],
-                                      S,
+                                      arena.S,
                                       lte,
                                       dK_dx[ip],
-                                      dS_dx,
+                                      arena.dS_dx,
                                       propmat_clearsky_agenda,
                                       jacobian_quantities,
                                       Vector{ppvar_f(joker, ip)},
@@ -1597,7 +1617,7 @@ void iyEmissionStandard(
 
         if (j_analytical_do)
           adapt_stepwise_partial_derivatives(dK_dx[ip],
-                                             dS_dx,
+                                             arena.dS_dx,
                                              jacobian_quantities,
                                              ppvar_f(joker, ip),
                                              ppath.los(ip, joker),
@@ -1606,21 +1626,21 @@ void iyEmissionStandard(
                                              j_analytical_do);
 
         // Here absorption equals extinction
-        a = K[ip];
+        arena.a = K[ip];
         if (j_analytical_do)
-          FOR_ANALYTICAL_JACOBIANS_DO(da_dx[iq] = dK_dx[ip][iq];);
+          FOR_ANALYTICAL_JACOBIANS_DO(arena.da_dx[iq] = dK_dx[ip][iq];);
 
         stepwise_source(src_rad[ip],
                         dsrc_rad[ip],
-                        J_add_dummy,
+                        arena.J_add_dummy,
                         K[ip],
-                        a,
-                        S,
+                        arena.a,
+                        arena.S,
                         dK_dx[ip],
-                        da_dx,
-                        dS_dx,
-                        B,
-                        dB_dT,
+                        arena.da_dx,
+                        arena.dS_dx,
+                        arena.B,
+                        arena.dB_dT,
                         jacobian_quantities,
                         jacobian_do);
       } catch (const std::runtime_error& e) {
@@ -1634,11 +1654,11 @@ void iyEmissionStandard(
           fail_msg.push_back(os.str());
         }
       }
-    }
+    };
 
-#pragma omp parallel for if (!arts_omp_in_parallel())
-    for (Index ip = 1; ip < np; ip++) {
-      if (do_abort) continue;
+    // Determine the transmission of the layer ending at a ppath point
+    const auto layer = [&](const Index ip, const Index) {
+      if (do_abort) return;
       try {
         const Numeric dr_dT_past =
             do_hse ? ppath.lstep[ip - 1] / (2.0 * ppvar_t[ip - 1]) : 0;
@@ -1672,7 +1692,10 @@ void iyEmissionStandard(
           fail_msg.push_back(os.str());
         }
       }
-    }
+    };
+
+    // Loop ppath points and layers in a single pass
+    ppath_fused_pass(np, nchunks, point, layer);
 
     ARTS_USER_ERROR_IF (do_abort,
       "Error messages from failed cases:\n", fail_msg)
@@ -2418,9 +2441,11 @@ void iyMC(Workspace& ws,
   bool failed = false;
 
   if (nf) {
-    WorkspaceOmpParallelCopyGuard wss{ws};
+    const int nthreads = arts_omp_get_available_threads();
+    WorkspaceOmpParallelCopyGuard wss{ws, nthreads > 1 and nf > 1};
 
-#pragma omp parallel for if (!arts_omp_in_parallel() && nf > 1) firstprivate(wss)
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1 && nf > 1) \
+    firstprivate(wss)
     for (Index f_index = 0; f_index < nf; f_index++) {
       if (failed) continue;
 
@@ -2583,6 +2608,9 @@ void yCalc(Workspace& ws,
            const Verbosity& verbosity) {
   CREATE_OUT3;
 
+  // Line shape parameters are reused by the path points of all pencil beams
+  const LineShape::KernelCachePool::Scope line_kernels;
+
   // Basics
   //
   chk_if_in_range("stokes_dim", stokes_dim, 1, 4);
@@ -2659,97 +2687,57 @@ void yCalc(Workspace& ws,
   String fail_msg;
   bool failed = false;
 
-  if (nmblock >= arts_omp_get_max_threads() ||
-      (nf <= nmblock && nmblock >= nlos)) {
-    out3 << "  Parallelizing mblock loop (" << nmblock << " iterations)\n";
-
-    WorkspaceOmpParallelCopyGuard wss{ws};
-
-#pragma omp parallel for firstprivate(wss)
-    for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      yCalc_mblock_loop_body(failed,
-                             fail_msg,
-                             iyb_aux_array,
-                             wss,
-                             y,
-                             y_f,
-                             y_pol,
-                             y_pos,
-                             y_los,
-                             y_geo,
-                             jacobian,
-                             atmosphere_dim,
-                             nlte_field,
-                             cloudbox_on,
-                             stokes_dim,
-                             f_grid,
-                             sensor_pos,
-                             sensor_los,
-                             transmitter_pos,
-                             mblock_dlos,
-                             sensor_response,
-                             sensor_response_f,
-                             sensor_response_pol,
-                             sensor_response_dlos,
-                             iy_unit,
-                             iy_main_agenda,
-                             jacobian_agenda,
-                             jacobian_do,
-                             jacobian_quantities,
-                             jacobian_indices,
-                             iy_aux_vars,
-                             verbosity,
-                             mblock_index,
-                             n1y,
-                             j_analytical_do);
-    }  // End mblock loop
-  } else {
-    out3 << "  Not parallelizing mblock loop (" << nmblock << " iterations)\n";
-
-    for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      yCalc_mblock_loop_body(failed,
-                             fail_msg,
-                             iyb_aux_array,
-                             ws,
-                             y,
-                             y_f,
-                             y_pol,
-                             y_pos,
-                             y_los,
-                             y_geo,
-                             jacobian,
-                             atmosphere_dim,
-                             nlte_field,
-                             cloudbox_on,
-                             stokes_dim,
-                             f_grid,
-                             sensor_pos,
-                             sensor_los,
-                             transmitter_pos,
-                             mblock_dlos,
-                             sensor_response,
-                             sensor_response_f,
-                             sensor_response_pol,
-                             sensor_response_dlos,
-                             iy_unit,
-                             iy_main_agenda,
-                             jacobian_agenda,
-                             jacobian_do,
-                             jacobian_quantities,
-                             jacobian_indices,
-                             iy_aux_vars,
-                             verbosity,
-                             mblock_index,
-                             n1y,
-                             j_analytical_do);
-    }  // End mblock loop
-  }
+  // Threads the mblock loop can not use are handed to the calculations
+  // inside each mblock, e.g. the los loop of iyb_calc
+  const ArtsOmpNestedLoop mblock_loop{nmblock};
+  out3 << "  Parallelizing mblock loop (" << nmblock << " iterations, "
+       << mblock_loop.threads() << " threads)\n";
+
+  WorkspaceOmpParallelCopyGuard wss{ws, mblock_loop.threads() > 1};
+
+#pragma omp parallel for num_threads(mblock_loop.threads()) \
+    if (mblock_loop.threads() > 1) firstprivate(wss)
+  for (Index mblock_index = 0; mblock_index < nmblock; mblock_index++) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
+
+    const ArtsOmpInnerThreads inner_threads{mblock_loop};
+    yCalc_mblock_loop_body(failed,
+                           fail_msg,
+                           iyb_aux_array,
+                           wss,
+                           y,
+                           y_f,
+                           y_pol,
+                           y_pos,
+                           y_los,
+                           y_geo,
+                           jacobian,
+                           atmosphere_dim,
+                           nlte_field,
+                           cloudbox_on,
+                           stokes_dim,
+                           f_grid,
+                           sensor_pos,
+                           sensor_los,
+                           transmitter_pos,
+                           mblock_dlos,
+                           sensor_response,
+                           sensor_response_f,
+                           sensor_response_pol,
+                           sensor_response_dlos,
+                           iy_unit,
+                           iy_main_agenda,
+                           jacobian_agenda,
+                           jacobian_do,
+                           jacobian_quantities,
+                           jacobian_indices,
+                           iy_aux_vars,
+                           verbosity,
+                           mblock_index,
+                           n1y,
+                           j_analytical_do);
+  }  // End mblock loop
 
   // Rethrow exception if a runtime error occurred in the mblock loop
   ARTS_USER_ERROR_IF (failed, fail_msg);
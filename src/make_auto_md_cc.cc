@@ -254,12 +254,13 @@ int main() {
         // Add comma and line break, if not first element:
         align(ofs, is_first_parameter, indent);
 
+        // Inputs only read, so shared values are not copied
         if (is_agenda_group_id(wsv_data[vi[j]].Group())) {
           ofs << "*(static_cast<" << wsv_groups[wsv_data[vi[j]].Group()]
-              << "*>(ws[mr.In()[" << j << "]].get()))";
+              << "*>(ws.read(mr.In()[" << j << "]).get()))";
         } else {
           ofs << "*(static_cast<" << wsv_groups[wsv_data[vi[j]].Group()]
-              << "*>(ws[mr.In()[" << j << "]].get()))";
+              << "*>(ws.read(mr.In()[" << j << "]).get()))";
         }
       }
 
@@ -282,8 +283,8 @@ int main() {
             // Add comma and line break, if not first element:
             align(ofs, is_first_parameter, indent);
 
-            ofs << "*(static_cast<" << wsv_groups[vgi[j]] << "*>(ws[mr.In()["
-                << j + vi.nelem() << "]].get()))";
+            ofs << "*(static_cast<" << wsv_groups[vgi[j]]
+                << "*>(ws.read(mr.In()[" << j + vi.nelem() << "]).get()))";
           }
 
           // Write the Generic input workspace variable names:
@@ -327,8 +328,8 @@ int main() {
         static Index verbosity_wsv_id = global_data::WsvMap.at("verbosity");
         static Index verbosity_group_id = get_wsv_group_id("Verbosity");
         align(ofs, is_first_parameter, indent);
-        ofs << "*(static_cast<" << wsv_groups[verbosity_group_id] << "*>(ws["
-            << verbosity_wsv_id << "].get()))";
+        ofs << "*(static_cast<" << wsv_groups[verbosity_group_id]
+            << "*>(ws.read(" << verbosity_wsv_id << ").get()))";
       }
 
       ofs << ");\n";
@@ -435,8 +436,7 @@ int main() {
               << "  }\n\n"
               << "  const Agenda& input_agenda = input_agenda_array[agenda_array_index];\n\n";
         }
-        ofs << "  using global_data::AgendaMap;\n"
-            << "  using global_data::agenda_data;\n"
+        ofs << "  using global_data::agenda_data;\n"
             << "\n"
             << "  if (!input_agenda.checked())\n"
             << "    throw std::runtime_error(\"" << agr.Name()
@@ -445,7 +445,7 @@ int main() {
             << "be copied to a workspace variable for execution.\");\n"
             << "\n"
             << "  const AgRecord& agr =\n"
-            << "    agenda_data[AgendaMap.find (input_agenda.name ())->second];\n"
+            << "    agenda_data[input_agenda.agenda_data_pos ()];\n"
             << "\n";
       }
       if (ago.nelem()) {
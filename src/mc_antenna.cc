@@ -138,7 +138,7 @@ void MCAntenna::return_los(Numeric& wgt,
 
 void MCAntenna::draw_los(VectorView sampled_rte_los,
                          MatrixView R_los,
-                         RandomNumberGenerator<>& rng,
+                         RandomNumberStream& rng,
                          ConstMatrixView R_ant2enu,
                          ConstVectorView bore_sight_los) const {
   Numeric ant_el, ant_az, ant_r;
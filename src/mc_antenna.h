@@ -126,7 +126,7 @@ struct MCAntenna {
    */
   void draw_los(VectorView sampled_rte_los,
                 MatrixView R_los,
-                RandomNumberGenerator<>& rng,
+                RandomNumberStream& rng,
                 ConstMatrixView R_ant2enu,
                 ConstVectorView bore_sight_los) const;
 
@@ -699,7 +699,11 @@ void define_md_data_raw() {
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_linesReadSpeciesSplitCatalog"),
-      DESCRIPTION("Reads a catalog of absorption lines files in a directory\n"),
+      DESCRIPTION("Reads a catalog of absorption lines files in a directory\n"
+                  "\n"
+                  "A binary catalog file (\".lines\", see *abs_linesWriteSpeciesSplitCatalog*)\n"
+                  "is read in place of the XML file of the same isotopologue, unless\n"
+                  "the binary file is older than the XML file\n"),
       AUTHORS("Richard Larsson"),
       OUT("abs_lines"),
       GOUT(),
@@ -2217,7 +2221,19 @@ For "ByLine", the negative frequency is at F0-cutoff-D0
           "generated.\n"
           "\n"
           "Note, that the absorbing gas can be any gas, but the perturbing gas is\n"
-          "always H2O.\n"),
+          "always H2O.\n"
+          "\n"
+          "The table is computed in double precision and then stored in the\n"
+          "precision given by *storage*, see *abs_lookupSetStorage*.\n"
+          "\n"
+          "The calculations for all species, pressure levels, temperature and\n"
+          "H2O VMR perturbations are distributed dynamically over the threads.\n"
+          "If *checkpoint_file* is set, the partially computed table is written\n"
+          "to that file at intervals of about *checkpoint_interval* seconds.\n"
+          "A later call with the same input and checkpoint file continues from\n"
+          "the checkpoint. The file is removed when the table is complete.\n"
+          "Progress and the computation time per species are reported at\n"
+          "verbosity levels 2 and 3.\n"),
       AUTHORS("Stefan Buehler"),
       OUT("abs_lookup", "abs_lookup_is_adapted"),
       GOUT(),
@@ -2232,10 +2248,13 @@ For "ByLine", the negative frequency is at F0-cutoff-D0
          "abs_t_pert",
          "abs_nls_pert",
          "propmat_clearsky_agenda"),
-      GIN("lowest_vmr"),
-      GIN_TYPE("Numeric"),
-      GIN_DEFAULT("1e-9"),
-      GIN_DESC("Lowest possible VMR to compute absorption at")));
+      GIN("lowest_vmr", "storage", "checkpoint_file", "checkpoint_interval"),
+      GIN_TYPE("Numeric", "String", "String", "Numeric"),
+      GIN_DEFAULT("1e-9", "Double", "", "600"),
+      GIN_DESC("Lowest possible VMR to compute absorption at",
+               "Storage precision of the cross sections",
+               "File to write checkpoints to and resume from, no checkpoints if empty",
+               "Minimum time between checkpoints [s]")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupInit"),
@@ -2255,6 +2274,60 @@ For "ByLine", the negative frequency is at F0-cutoff-D0
       GIN_DEFAULT(),
       GIN_DESC()));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupReadMapped"),
+      DESCRIPTION(
+          "Reads a gas absorption lookup table written by *abs_lookupWriteMapped*.\n"
+          "\n"
+          "Only the grids and reference profiles are read. The cross sections\n"
+          "are memory mapped read-only from the file with the extension \".xsec\"\n"
+          "added to *filename*, so reading takes no time regardless of the size\n"
+          "of the table. The data is only read from disk when it is accessed.\n"
+          "\n"
+          "*abs_lookupAdapt* copies the species and frequencies needed by the\n"
+          "current calculation, so only those are read. If the table already\n"
+          "has exactly the species and frequencies of the calculation, the\n"
+          "table stays mapped, and all processes on a machine that map the same\n"
+          "file share one copy of the cross sections in memory.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN(),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the XML file of the table")));
+
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupSetStorage"),
+      DESCRIPTION(
+          "Changes the precision the cross sections of a lookup table are stored in.\n"
+          "\n"
+          "Valid storages are:\n"
+          "    Double:\n"
+          "        Double precision, as computed.\n"
+          "    Float:\n"
+          "        Single precision.  Halves the memory of the table and the memory\n"
+          "        traffic of the extraction, which converts back to double precision\n"
+          "        on the fly.  The relative rounding error is about 6e-8, and cross\n"
+          "        sections below about 1e-38 m^2 lose relative precision.\n"
+          "\n"
+          "The storage is kept by *abs_lookupAdapt* and when the table is written\n"
+          "to and read from XML files.  Memory mapped tables, see\n"
+          "*abs_lookupWriteMapped*, are always in double precision.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("abs_lookup"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("storage"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Storage precision of the cross sections")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_lookupSetup"),
       DESCRIPTION(
@@ -2452,6 +2525,29 @@ For "ByLine", the negative frequency is at F0-cutoff-D0
                "Humidity grid minimum [fractional].",
                "Humidity grid maximum [fractional].")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("abs_lookupWriteMapped"),
+      DESCRIPTION(
+          "Writes a gas absorption lookup table that can be memory mapped.\n"
+          "\n"
+          "The grids and reference profiles are written to *filename* as an\n"
+          "XML file. The cross sections are written to a binary file with the\n"
+          "extension \".xsec\" added to *filename*. The binary file starts with\n"
+          "a versioned header and holds the cross sections as native doubles,\n"
+          "so it must be read on a machine with the same byte order.\n"
+          "\n"
+          "Use *abs_lookupReadMapped* to read the table.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("abs_lookup"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the XML file of the table")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("abs_nlteFromRaw"),
       DESCRIPTION("Sets NLTE values manually\n"
@@ -4771,6 +4867,18 @@ Available models:
           "    *doit_rte_agenda*.\n"
           " 3. Convergence test using *doit_conv_test_agenda*.\n"
           "\n"
+          "With *solver* \"SourceIteration\" these steps are repeated until\n"
+          "the convergence test passes. In optically thick clouds with a\n"
+          "high single scattering albedo that can take many iterations.\n"
+          "The solvers \"GMRES\" and \"BiCGSTAB\" instead solve for the\n"
+          "fixed point of steps 1 and 2 with a Krylov method, which applies\n"
+          "the two agendas as a linear operator. Each Krylov solve applies\n"
+          "them at most *krylov_restart* times, or until the residual has\n"
+          "been reduced by *krylov_tolerance*, and is followed by step 3.\n"
+          "Ng acceleration is only done for \"SourceIteration\".\n"
+          "\n"
+          "The number of iterations and the time taken are reported.\n"
+          "\n"
           "Note: The atmospheric dimensionality *atmosphere_dim* can be\n"
           "      either 1 or 3. To these dimensions the method adapts\n"
           "      automatically. 2D scattering calculations are not\n"
@@ -4784,11 +4892,16 @@ Available models:
          "doit_scat_field_agenda",
          "doit_rte_agenda",
          "doit_conv_test_agenda"),
-      GIN("accelerated"),
-      GIN_TYPE("Index"),
-      GIN_DEFAULT("0"),
+      GIN("accelerated", "solver", "krylov_restart", "krylov_tolerance"),
+      GIN_TYPE("Index", "String", "Index", "Numeric"),
+      GIN_DEFAULT("0", "SourceIteration", "20", "1e-3"),
       GIN_DESC(
-          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)")));
+          "Index wether to accelerate only the intensity (1) or the whole Stokes Vector (4)",
+          "Solver of the iteration: \"SourceIteration\", \"GMRES\" or "
+          "\"BiCGSTAB\".",
+          "Maximum number of applications of the agendas by each Krylov "
+          "solve.",
+          "Reduction of the residual that ends a Krylov solve.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("cloudbox_fieldCrop"),
@@ -11957,7 +12070,13 @@ Available models:
           "\n"
           "Only \"1\" and \"RJBT\" are allowed for *iy_unit*. The value of\n"
           "*mc_error* follows the selection for *iy_unit* (both for in- and\n"
-          "output.\n"),
+          "output.\n"
+          "\n"
+          "Photons are traced in parallel. Each photon has its own random\n"
+          "number stream, and the photons are added to the statistics in\n"
+          "the order they were launched. The result is thus given by\n"
+          "*mc_seed* and does not depend on the number of threads, except\n"
+          "when *mc_max_time* stops the calculation.\n"),
       AUTHORS("Cory Davis"),
       OUT("y",
           "mc_iteration_count",
@@ -12041,6 +12160,10 @@ Available models:
           "If negative values are given for these parameters then it is\n"
           "ignored.\n"
           "\n"
+          "Photons are traced in parallel, each with its own random number\n"
+          "stream, so the result is given by *mc_seed* and does not depend\n"
+          "on the number of threads.\n"
+          "\n"
           "Here \"1\" and \"Ze\" are the allowed options for *iy_unit_radar*.\n"
           "The value of *mc_error* follows the selection for *iy_unit_radar*\n"
           "(both for in- and output. See *yRadar* for details of the units.\n"),
@@ -14420,6 +14543,42 @@ Please use *sparse_f_gridFromFrequencyGrid* to see the sparse frequency grid
 
 By default we discourage negative values, which are common when using one of the line mixing
 approximations.   Change the value of no_negatives to 0 to allow these negative absorptions.
+
+If *lines_parallel_option* is not "Bands", then the threads share the work differently.
+Valid parallelization schemes are:
+    Bands:
+        Each thread computes whole bands on all of *f_grid* into its own copy of the
+        computational data.  The copies are summed up after all bands are done.
+    FrequencyBlocks:
+        Each thread computes all bands on its own block of *f_grid* and adds the result
+        directly to the output.  This needs no per-thread copies and no summation, so it
+        scales better for large *f_grid* and many *jacobian_quantities*.  It cannot be
+        combined with a *lines_speedup_option* other than "None".
+
+The Voigt, speed-dependent Voigt and Hartmann-Tran line shapes need the Faddeeva function.
+Valid *lines_faddeeva_option* are:
+    Reference:
+        The Faddeeva package.  Accurate to machine precision.
+    Weideman:
+        The 32-term rational series of Weideman (1994), and in the line wings the
+        continued fraction of the Faddeeva package with a fixed number of terms.  The
+        relative error is below 1e-12 compared to the Faddeeva package.  It is
+        evaluated for all frequencies of a line at once, in loops that the compiler
+        vectorizes, which is about twice as fast for plain Voigt bands.
+
+Bands of Voigt lines in LTE without mirroring or normalization are computed from an
+array copy of their line data, one line at a time over all its frequencies, when there
+are no derivatives and *lines_speedup_option* is "None".  This is about twice as fast.
+
+If *lines_cache_resolution* is not negative, the line shape parameters of each band are
+kept between calls, and the parameters of previously seen atmospheric states are reused,
+which helps when many path points or batch cases share the same temperatures and
+pressures.  The parameters are kept until the outermost *yCalc*, *ybatchCalc*, or
+*ybatchCalcStreamed* returns, and up to a size of 64 MB per thread.  Outside of these
+methods they are forgotten after each call.  With a resolution of 0 the temperature,
+pressure, and VMRs must match exactly.  A positive resolution is relative: states are
+binned on a logarithmic grid with this spacing and every state in a bin reuses the
+parameters of the first state seen in that bin.
 )--"
       ),
       AUTHORS("Richard Larsson"),
@@ -14443,14 +14602,17 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
          "rtp_vmr",
          "nlte_do",
          "lbl_checked"),
-      GIN("lines_sparse_df", "lines_sparse_lim", "lines_speedup_option", "no_negatives"),
-      GIN_TYPE("Numeric", "Numeric", "String", "Index"),
-      GIN_DEFAULT("0", "0", "None", "1"),
+      GIN("lines_sparse_df", "lines_sparse_lim", "lines_speedup_option", "no_negatives", "lines_parallel_option", "lines_faddeeva_option", "lines_cache_resolution"),
+      GIN_TYPE("Numeric", "Numeric", "String", "Index", "String", "String", "Numeric"),
+      GIN_DEFAULT("0", "0", "None", "1", "Bands", "Reference", "-1"),
       GIN_DESC(
         "The grid sparse separation",
         "The dense-to-sparse limit",
         "Speedup logic",
-        "Boolean.  If it is true, line mixed bands each allocate their own compute data to ensure that they cannot produce negative absorption"
+        "Boolean.  If it is true, line mixed bands each allocate their own compute data to ensure that they cannot produce negative absorption",
+        "Parallelization scheme",
+        "Faddeeva function algorithm",
+        "Relative resolution of the line shape parameter cache (negative disables)"
       )));
 
   md_data_raw.push_back(create_mdrecord(
@@ -16113,6 +16275,10 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
                   "\t\"Post2004\" \t-\t for new format\n"
                   "\t\"Online\"   \t-\t for the online format with quantum numbers (recommended)\n"
                   "\n"
+                  "The HITRAN reading switch can be:\n"
+                  "\t\"Stream\"   \t-\t reads the file line by line\n"
+                  "\t\"Parallel\" \t-\t parses the memory mapped file in parallel, same result\n"
+                  "\n"
                   "Be careful setting the options!\n"
                   "\n"
                   "Note that the isoptopologues in Hitran changes between its versions.\n"
@@ -16146,11 +16312,11 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
       GIN("filename", "fmin", "fmax", "globalquantumnumbers", "localquantumnumbers",
           "hitran_type", "normalization_option", "mirroring_option",
           "population_option", "lineshapetype_option", "cutoff_option",
-          "cutoff_value", "linemixinglimit_value"),
+          "cutoff_value", "linemixinglimit_value", "hitran_reading"),
       GIN_TYPE("String", "Numeric", "Numeric", "String", "String", "String", "String",
-               "String", "String", "String", "String", "Numeric", "Numeric"),
+               "String", "String", "String", "String", "Numeric", "Numeric", "String"),
       GIN_DEFAULT(NODEF, "-1e99", "1e99", "DEFAULT_GLOBAL", "DEFAULT_LOCAL", "Online", "None", "None", "LTE", "VP",
-                 "None", "750e9", "-1"),
+                 "None", "750e9", "-1", "Stream"),
       GIN_DESC("Name of the HITRAN file",
                "Minimum frequency of read lines",
                "Maximum frequency of read lines",
@@ -16163,7 +16329,8 @@ approximations.   Change the value of no_negatives to 0 to allow these negative
                "Lineshape option, see *abs_linesLineShapeType*",
                "Cutoff option, see *abs_linesCutoff*",
                "Cutoff value, see *abs_linesCutoff*",
-               "Line mixing limit, see *abs_linesLinemixingLimit*")));
+               "Line mixing limit, see *abs_linesLinemixingLimit*",
+               "Way of reading the file, \"Stream\" or \"Parallel\"")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("ReadLBLRTM"),
@@ -16238,6 +16405,13 @@ There will be one unique file generated per AbsorptionLines in abs_lines.
 The names of these files will be:
 	basename + "." + AbsorptionLines.SpeciesName() + "." + to_string(N) + ".xml"
 where N>=0 and the species name is something line "H2O".
+
+If *output_file_format* is "columnar", the files are instead binary catalogs
+ending with ".lines".  These store the line data of each band column by column
+and are read by *abs_linesReadSpeciesSplitCatalog* with a few bulk copies.
+They are native endian and tied to the version of the format, so keep the XML
+catalog as the archive and regenerate the binary files from it.  A binary
+file that is older than the XML file of the same band is not read.
 )--"),
       AUTHORS("Richard Larsson"),
       OUT(),
@@ -18062,17 +18236,28 @@ where N>=0 and the species name is something line "H2O".
           "\n"
           "Important note:\n"
           "The order of the filenames for the single scattering data files has to\n"
-          "exactly correspond to the order of the scattering meta data files.\n"),
+          "exactly correspond to the order of the scattering meta data files.\n"
+          "\n"
+          "If *frequencies* is given, only the frequencies of the data needed to\n"
+          "interpolate it to these frequencies, with *interp_order*, are kept.\n"
+          "Typically, *f_grid* is given, and the same *interp_order* as to\n"
+          "*scat_dataCalc*. The other frequencies are skipped in binary files,\n"
+          "and parsed but dropped in ascii files. Memory is then proportional\n"
+          "to the frequencies in use, and a large database can be processed in\n"
+          "frequency windows, reading the data again for each window.\n"),
       AUTHORS("Daniel Kreyling, Oliver Lemke, Jana Mendrok"),
       OUT("scat_data_raw", "scat_meta"),
       GOUT(),
       GOUT_TYPE(),
       GOUT_DESC(),
       IN("scat_data_raw", "scat_meta"),
-      GIN("scat_data_files"),
-      GIN_TYPE("ArrayOfString"),
-      GIN_DEFAULT(NODEF),
-      GIN_DESC("Array of single scattering data file names.")));
+      GIN("scat_data_files", "frequencies", "interp_order"),
+      GIN_TYPE("ArrayOfString", "Vector", "Index"),
+      GIN_DEFAULT(NODEF, "[]", "1"),
+      GIN_DESC("Array of single scattering data file names.",
+               "Frequencies the data will be interpolated to. All frequencies "
+               "of the data are read if empty.",
+               "Interpolation order in frequency.")));
 
   md_data_raw.push_back(create_mdrecord(
       NAME("scat_data_singleTmatrix"),
@@ -23175,6 +23360,40 @@ where N>=0 and the species name is something line "H2O".
                "Hot load temperature",
                "Flag for calibration scheme, false means system temperature is computed")));
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ybatchCalcStreamed"),
+      DESCRIPTION(
+          "As *ybatchCalc*, but the results are written to file as the jobs\n"
+          "finish, instead of being kept in memory.\n"
+          "\n"
+          "Each finished job is appended to the binary file *filename*, and\n"
+          "is then listed in the text file *filename*.index. Both are flushed\n"
+          "to disk for every job, so the memory use does not grow with\n"
+          "*ybatch_n* and an interrupted batch loses at most the jobs that\n"
+          "were running.\n"
+          "\n"
+          "If the files already exist, the batch is resumed: jobs listed in\n"
+          "the index are not run again, and anything written after the last\n"
+          "listed job is discarded. Jobs that failed with *robust* set are\n"
+          "not listed, and are thus retried by the next call. Set *restart*\n"
+          "to discard the files and run all jobs.\n"
+          "\n"
+          "Use *ybatchReadStreamed* to get the results.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT(),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ybatch_start", "ybatch_n", "ybatch_calc_agenda"),
+      GIN("filename", "robust", "restart"),
+      GIN_TYPE("String", "Index", "Index"),
+      GIN_DEFAULT(NODEF, "0", "0"),
+      GIN_DESC("Name of the file of results.",
+               "A flag with value 1 or 0. If set to one, the batch\n"
+               "calculation will continue, even if individual jobs fail.",
+               "A flag with value 1 or 0. If set to one, existing\n"
+               "results in *filename* are removed instead of resumed.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ybatchMetProfiles"),
       DESCRIPTION(
@@ -23261,6 +23480,25 @@ where N>=0 and the species name is something line "H2O".
       GIN_DESC("FIXME DOC", "FIXME DOC")));
 
 
+  md_data_raw.push_back(create_mdrecord(
+      NAME("ybatchReadStreamed"),
+      DESCRIPTION(
+          "Reads the results stored by *ybatchCalcStreamed*.\n"
+          "\n"
+          "The output is as from *ybatchCalc* for *ybatch_n* jobs starting at\n"
+          "*ybatch_start*. Jobs that are not in the file, because they failed\n"
+          "or have not been run yet, are left empty.\n"),
+      AUTHORS("ARTS Developers"),
+      OUT("ybatch", "ybatch_aux", "ybatch_jacobians"),
+      GOUT(),
+      GOUT_TYPE(),
+      GOUT_DESC(),
+      IN("ybatch_start", "ybatch_n"),
+      GIN("filename"),
+      GIN_TYPE("String"),
+      GIN_DEFAULT(NODEF),
+      GIN_DESC("Name of the file given to *ybatchCalcStreamed*.")));
+
   md_data_raw.push_back(create_mdrecord(
       NAME("ybatchTimeAveraging"),
       DESCRIPTION(
@@ -23330,6 +23568,13 @@ where N>=0 and the species name is something line "H2O".
           "of a series of spectra), all depending on the settings. Spectra\n"
           "and jacobians are calculated in parallel.\n"
           "\n"
+          "The measurement blocks get one thread each, as far as there are\n"
+          "threads. The remaining threads are shared out to the calculations\n"
+          "inside the blocks, i.e. the pencil beams of a block, the points of\n"
+          "the propagation paths and the absorption line bands, so that also\n"
+          "a few blocks with many frequencies or pencil beams keep all threads\n"
+          "busy.\n"
+          "\n"
           "The frequency, polarisation etc. for each measurement value is\n"
           "given by *y_f*, *y_pol*, *y_pos* and *y_los*.\n"
           "\n"
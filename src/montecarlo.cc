@@ -855,7 +855,7 @@ void mcPathTraceGeneral(Workspace& ws,
                         Vector& abs_vec_mono,
                         Numeric& temperature,
                         MatrixView ext_mat_mono,
-                        RandomNumberGenerator<>& rng,
+                        RandomNumberStream& rng,
                         Vector& rte_pos,
                         Vector& rte_los,
                         Vector& pnd_vec,
@@ -1196,7 +1196,7 @@ void mcPathTraceRadar(Workspace& ws,
                       Vector& abs_vec_mono,
                       Numeric& temperature,
                       MatrixView ext_mat_mono,
-                      RandomNumberGenerator<>& rng,
+                      RandomNumberStream& rng,
                       Vector& rte_pos,
                       Vector& rte_los,
                       Vector& pnd_vec,
@@ -1529,7 +1529,7 @@ void mcPathTraceRadar(Workspace& ws,
 void Sample_los(VectorView new_rte_los,
                 Numeric& g_los_csc_theta,
                 MatrixView Z,
-                RandomNumberGenerator<>& rng,
+                RandomNumberStream& rng,
                 ConstVectorView rte_los,
                 const ArrayOfArrayOfSingleScatteringData& scat_data,
                 const Index f_index,
@@ -1606,7 +1606,7 @@ void Sample_los(VectorView new_rte_los,
   g_los_csc_theta = Z(0, 0) / Csca;
 }
 
-void Sample_los_uniform(VectorView new_rte_los, RandomNumberGenerator<>& rng) {
+void Sample_los_uniform(VectorView new_rte_los, RandomNumberStream& rng) {
   new_rte_los[1] = rng.get<>(-180., 180.)();
   new_rte_los[0] = Conversion::acosd(rng.get<>(-1., 1.)());
 }
@@ -208,12 +208,12 @@ using ArrayOfArrayOfString = Array<Array<String>>;
  function to safe some typing.
 
  \retval x    What was extracted from the beginning of the line.
- \retval line What was extracted is also cut away from line.
+ \retval line What was extracted is also cut away from the view of the line.
  \param n     The width of the stuff to extract.
 
  \author Stefan Buehler */
 template <class T>
-void extract(T& x, String& line, std::size_t n) {
+void extract(T& x, std::string_view& line, std::size_t n) {
   // Initialize output to zero! This is important, because otherwise
   // the output variable could `remember' old values.
   x = T(0);
@@ -232,14 +232,22 @@ void extract(T& x, String& line, std::size_t n) {
     // This will contain the short subString with the item to extract.
     // Make it a String stream, for easy parsing,
     // extracting subString of width n from line:
-    std::istringstream item(line.substr(i, n));
+    std::istringstream item(std::string(line.substr(i, n)));
 
     // Convert with the aid of String stream item:
     item >> x;
   }
 
   // Shorten line by n:
-  line.erase(0, N);
+  line.remove_prefix(std::min(N, line.size()));
+}
+
+/** As extract from a view of a line, but cuts away from the line itself */
+template <class T>
+void extract(T& x, String& line, std::size_t n) {
+  std::string_view view{line};
+  extract(x, view, n);
+  line.erase(0, n);
 }
 
 //Specialize std::hash for String (this is allowed by the standard)
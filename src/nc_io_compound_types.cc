@@ -44,6 +44,10 @@ void nca_read_from_file(const int ncid, GasAbsLookup& gal, const Verbosity&) {
   nca_get_data(ncid, "t_pert", gal.t_pert, true);
   nca_get_data(ncid, "nls_pert", gal.nls_pert, true);
   nca_get_data(ncid, "xsec", gal.xsec, true);
+  gal.xsec_map.reset();
+  gal.storage = Options::LookupStorage::Double;
+  gal.xsec_float = std::vector<float>{};
+  gal.xsec_float_shape = {0, 0, 0, 0};
 }
 
 //! Writes a GasAbsLookup table to a NetCDF file
@@ -111,7 +115,13 @@ void nca_write_to_file(const int ncid,
   int t_ref_varid = nca_def_Vector(ncid, "t_ref", gal.t_ref);
   int t_pert_varid = nca_def_Vector(ncid, "t_pert", gal.t_pert);
   int nls_pert_varid = nca_def_Vector(ncid, "nls_pert", gal.nls_pert);
-  int xsec_varid = nca_def_Tensor4(ncid, "xsec", gal.xsec);
+  // A memory mapped or single precision table is copied, only a Tensor4 can
+  // be written
+  const bool copy =
+      gal.xsec_map or gal.storage not_eq Options::LookupStorage::Double;
+  const Tensor4 copied_xsec = copy ? gal.XsecCopy() : Tensor4{};
+  const Tensor4& xsec = copy ? copied_xsec : gal.xsec;
+  int xsec_varid = nca_def_Tensor4(ncid, "xsec", xsec);
 
   if ((retval = nc_enddef(ncid))) nca_error(retval, "nc_enddef");
 
@@ -133,7 +143,7 @@ void nca_write_to_file(const int ncid,
   nca_put_var(ncid, t_ref_varid, gal.t_ref);
   nca_put_var(ncid, t_pert_varid, gal.t_pert);
   nca_put_var(ncid, nls_pert_varid, gal.nls_pert);
-  nca_put_var(ncid, xsec_varid, gal.xsec);
+  nca_put_var(ncid, xsec_varid, xsec);
 }
 
 ////////////////////////////////////////////////////////////////////////////
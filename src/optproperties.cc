@@ -2318,6 +2318,37 @@ void ConvertAzimuthallyRandomSingleScatteringData(SingleScatteringData& ssd) {
           tmpT7(joker, joker, j, joker, i, joker, joker);
 }
 
+//! The frequencies of single scattering data needed for a frequency grid
+/*!
+ The window covers the data frequencies around the frequencies of f_grid,
+ widened by interp_order on each side for the interpolation of
+ scat_dataCalc. All data frequencies are needed if f_grid is empty or if
+ the data has less than two frequencies.
+
+ \param[in]  ssd_f_grid    Frequency grid of the data
+ \param[in]  f_grid        Frequencies the data is interpolated to
+ \param[in]  interp_order  Interpolation order in frequency
+ \return     The first data frequency and the number of data frequencies
+ */
+std::pair<Index, Index> ssd_f_window(const Vector& ssd_f_grid,
+                                     const Vector& f_grid,
+                                     Index interp_order) {
+  const Index n = ssd_f_grid.nelem();
+  if (n < 2 or f_grid.nelem() == 0) return {0, n};
+
+  // The last data frequency not above min(f_grid) and the first not below
+  // max(f_grid)
+  const Numeric f_min = min(f_grid);
+  const Numeric f_max = max(f_grid);
+  Index first = 0, last = n - 1;
+  while (first + 1 < n and ssd_f_grid[first + 1] <= f_min) first++;
+  while (last > 0 and ssd_f_grid[last - 1] >= f_max) last--;
+
+  first = std::max<Index>(first - interp_order, 0);
+  last = std::min<Index>(last + interp_order, n - 1);
+  return {first, last - first + 1};
+}
+
 //! Convert particle ssd method name to enum value
 /*!
  Returns the ParticleSSDMethod enum value for the given String.
@@ -2502,3 +2533,76 @@ void ext_abs_pfun_from_tro(MatrixView ext_data,
     }
   }
 }
+
+std::size_t SsdInterpCache::KeyHash::operator()(const Key& key) const {
+  std::size_t h = std::hash<const Numeric*>{}(key.data);
+  for (Numeric x : {key.f, key.T})
+    h ^= std::hash<Numeric>{}(x) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  return h;
+}
+
+template <typename Interpolated, typename Data>
+const Interpolated& SsdInterpCache::find_or_interpolate(
+    std::unordered_map<Key, Interpolated, KeyHash>& entries,
+    const Data& data,
+    Index nT,
+    Numeric f,
+    Numeric T,
+    const std::function<void(Interpolated&)>& interpolate) {
+  const Key key{data.unsafe_data_handle(), f, nT == 1 ? 0 : T};
+  if (auto pos = entries.find(key); pos not_eq entries.end())
+    return pos->second;
+
+  Interpolated data_int;
+  interpolate(data_int);
+
+  const Index entry_bytes = Index(sizeof(Numeric)) * data_int.size();
+  if (bytes + entry_bytes > max_bytes) clear();
+  bytes += entry_bytes;
+  return entries.emplace(key, std::move(data_int)).first->second;
+}
+
+const Tensor5& SsdInterpCache::pha_mat(
+    const SingleScatteringData& ssd,
+    Numeric f,
+    Numeric T,
+    const std::function<void(Tensor5&)>& interpolate) {
+  return find_or_interpolate(pha_mat_entries,
+                             ssd.pha_mat_data,
+                             ssd.pha_mat_data.nvitrines(),
+                             f,
+                             T,
+                             interpolate);
+}
+
+const Tensor3& SsdInterpCache::ext_mat(
+    const SingleScatteringData& ssd,
+    Numeric f,
+    Numeric T,
+    const std::function<void(Tensor3&)>& interpolate) {
+  return find_or_interpolate(vec_entries,
+                             ssd.ext_mat_data,
+                             ssd.T_grid.nelem(),
+                             f,
+                             T,
+                             interpolate);
+}
+
+const Tensor3& SsdInterpCache::abs_vec(
+    const SingleScatteringData& ssd,
+    Numeric f,
+    Numeric T,
+    const std::function<void(Tensor3&)>& interpolate) {
+  return find_or_interpolate(vec_entries,
+                             ssd.abs_vec_data,
+                             ssd.T_grid.nelem(),
+                             f,
+                             T,
+                             interpolate);
+}
+
+void SsdInterpCache::clear() {
+  pha_mat_entries.clear();
+  vec_entries.clear();
+  bytes = 0;
+}
@@ -16,6 +16,10 @@
 #ifndef optproperties_h
 #define optproperties_h
 
+#include <functional>
+#include <unordered_map>
+
+#include "cache_pool.h"
 #include "gridded_fields.h"
 #include "matpack_data.h"
 #include "messages.h"
@@ -76,6 +80,17 @@ struct SingleScatteringData {
 typedef Array<SingleScatteringData> ArrayOfSingleScatteringData;
 typedef Array<Array<SingleScatteringData> > ArrayOfArrayOfSingleScatteringData;
 
+/*!
+   SingleScatteringData to be read only at the frequencies needed to
+   interpolate it to f_grid, see ssd_f_window. Reading it with
+   xml_read_from_file keeps memory proportional to the frequencies in use.
+*/
+struct SingleScatteringDataFWindow {
+  SingleScatteringData& ssd;
+  const Vector& f_grid;
+  Index interp_order;
+};
+
 /*===========================================================================
   === The ScatteringMetaData structure
   ===========================================================================*/
@@ -102,6 +117,93 @@ struct ScatteringMetaData {
 typedef Array<ScatteringMetaData> ArrayOfScatteringMetaData;
 typedef Array<Array<ScatteringMetaData> > ArrayOfArrayOfScatteringMetaData;
 
+/*===========================================================================
+  === The SsdInterpCache class
+  ===========================================================================*/
+/*!
+   Single scattering data of scattering elements, interpolated to one
+   frequency and one temperature.
+
+   pha_mat_sptFromData, pha_mat_sptFromScat_data and opt_prop_sptFromData
+   are called for every point and direction of DOIT, but only see a few
+   temperatures at each frequency. They keep the data they interpolate here,
+   borrowed from SsdInterpCachePool, and only do the transformation to
+   the laboratory frame on each call.
+
+   An entry is found by the address of the data of the element, the
+   frequency and the temperature. The temperature is not part of the key
+   for data with one temperature. The address identifies the data only
+   while the scattering data is unchanged, so the caches are kept for a
+   single DOIT run, see DoitCalc. The cache is emptied when it would grow
+   beyond max_bytes.
+*/
+class SsdInterpCache {
+ public:
+  //! Size at which the cache is emptied
+  static constexpr Index max_bytes = 128 * 1024 * 1024;
+
+  /** The phase matrix data of ssd at f and T
+
+      The reference is valid until the next call on this cache.
+
+      \param ssd The scattering element
+      \param f The frequency, or the index of a frequency of ssd.f_grid
+      \param T The temperature, or code, as for pha_mat_sptFromData
+      \param interpolate Sets its argument to the data, if it is not cached
+  */
+  const Tensor5& pha_mat(const SingleScatteringData& ssd,
+                         Numeric f,
+                         Numeric T,
+                         const std::function<void(Tensor5&)>& interpolate);
+
+  //! As pha_mat, for the extinction matrix data
+  const Tensor3& ext_mat(const SingleScatteringData& ssd,
+                         Numeric f,
+                         Numeric T,
+                         const std::function<void(Tensor3&)>& interpolate);
+
+  //! As pha_mat, for the absorption vector data
+  const Tensor3& abs_vec(const SingleScatteringData& ssd,
+                         Numeric f,
+                         Numeric T,
+                         const std::function<void(Tensor3&)>& interpolate);
+
+  //! Removes all entries
+  void clear();
+
+  //! Size of the cached data
+  [[nodiscard]] Index nbytes() const { return bytes; }
+
+ private:
+  struct Key {
+    const Numeric* data;
+    Numeric f;
+    Numeric T;
+
+    friend bool operator==(const Key&, const Key&) = default;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  template <typename Interpolated, typename Data>
+  const Interpolated& find_or_interpolate(
+      std::unordered_map<Key, Interpolated, KeyHash>& entries,
+      const Data& data,
+      Index nT,
+      Numeric f,
+      Numeric T,
+      const std::function<void(Interpolated&)>& interpolate);
+
+  std::unordered_map<Key, Tensor5, KeyHash> pha_mat_entries;
+  std::unordered_map<Key, Tensor3, KeyHash> vec_entries;
+  Index bytes{0};
+};
+
+//! The caches of interpolated single scattering data of a DOIT run
+using SsdInterpCachePool = CachePool<SsdInterpCache>;
+
 // General functions:
 // =============================================================
 
@@ -289,6 +391,10 @@ String PTypeToString(const PType& ptype);
 
 void ConvertAzimuthallyRandomSingleScatteringData(SingleScatteringData& ssd);
 
+std::pair<Index, Index> ssd_f_window(const Vector& ssd_f_grid,
+                                     const Vector& f_grid,
+                                     Index interp_order);
+
 ParticleSSDMethod ParticleSSDMethodFromString(
     const String& particle_ssdmethod_string);
 
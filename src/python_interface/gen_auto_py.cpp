@@ -820,8 +820,10 @@ void workspace_method_nongenerics(size_t n, const NameMaps& arts) {
     }
     os << '\n';
 
-    // Arguments from Arts side
+    // Arguments from Arts side, called without the GIL so that other Python
+    // threads may run methods on other workspaces meanwhile
     has_any = false;
+    os << "  py::gil_scoped_release gil_release_;\n";
     os << "  " << method.name << '(';
     if (pass_workspace) {
       os << "w_";
@@ -1227,7 +1229,8 @@ void workspace_method_generics(size_t n, const NameMaps& arts) {
       // Arguments from Arts side
       has_any = false;
       std::ostringstream method_os;
-      method_os << method.name << '(';
+      method_os << "{py::gil_scoped_release gil_release_; " << method.name
+                << '(';
       if (pass_workspace or
           (std::any_of(extra_workspace_for_agenda.begin(),
                        extra_workspace_for_agenda.end(),
@@ -1262,7 +1265,7 @@ void workspace_method_generics(size_t n, const NameMaps& arts) {
       }
 
       if (pass_verbosity) method_os << ", arg" << counter << "_";
-      method_os << ");";
+      method_os << ");}";
 
       const String method_call = method_os.str();
 
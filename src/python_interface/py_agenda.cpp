@@ -613,10 +613,16 @@ Both agendas must be defined on the same workspace)--"),
           "execute",
           [](Agenda& a, Workspace& ws) {
             a.set_main_agenda();
+            py::gil_scoped_release gil_release;
             a.execute(ws);
           },
           py::keep_alive<1, 2>(),
-          "Executes the agenda as if it was the main agenda")
+          py::doc(R"--(
+Executes the agenda as if it was the main agenda
+
+The GIL is released while the agenda runs, so other Python threads may
+execute agendas or methods on other workspaces meanwhile.  A single
+workspace must not be used by several threads at the same time)--"))
       .def(
           "check",
           [](Agenda& a, Workspace& w) {
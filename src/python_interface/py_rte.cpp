@@ -26,24 +26,17 @@ void py_rte(py::module_& m) {
       .PythonInterfaceFileIO(TransmissionMatrix)
       .PythonInterfaceBasicRepresentation(TransmissionMatrix)
       .def_buffer([](TransmissionMatrix& t) -> py::buffer_info {
-        Numeric* ptr = t.stokes_dim == 1
-                           ? t.T1.data()->data()
-                           : (t.stokes_dim == 2
-                                  ? t.T2.data()->data()
-                                  : (t.stokes_dim == 3 ? t.T3.data()->data()
-                                                       : t.T4.data()->data()));
         return py::buffer_info(
-            ptr,
+            t.entries.data(),
             sizeof(Numeric),
             py::format_descriptor<Numeric>::format(),
             3,
             {static_cast<ssize_t>(t.Frequencies()),
              static_cast<ssize_t>(t.stokes_dim),
              static_cast<ssize_t>(t.stokes_dim)},
-            {sizeof(Numeric) *
-                 static_cast<ssize_t>(t.stokes_dim * t.stokes_dim),
-             sizeof(Numeric) * static_cast<ssize_t>(t.stokes_dim),
-             sizeof(Numeric)});
+            {sizeof(Numeric),
+             sizeof(Numeric) * static_cast<ssize_t>(t.stokes_dim * t.nf),
+             sizeof(Numeric) * static_cast<ssize_t>(t.nf)});
       })
       .def_property("value",
                     py::cpp_function(
@@ -56,18 +49,15 @@ void py_rte(py::module_& m) {
       .PythonInterfaceValueOperators.PythonInterfaceNumpyValueProperties
       .def(py::pickle(
           [](const TransmissionMatrix& self) {
-            return py::make_tuple(
-                self.stokes_dim, self.T1, self.T2, self.T3, self.T4);
+            return py::make_tuple(self.stokes_dim, self.nf, self.entries);
           },
           [](const py::tuple& t) {
-            ARTS_USER_ERROR_IF(t.size() != 5, "Invalid state!")
+            ARTS_USER_ERROR_IF(t.size() != 3, "Invalid state!")
 
             auto out = std::make_unique<TransmissionMatrix>();
             out->stokes_dim = t[0].cast<Index>();
-            out->T1 = t[1].cast<decltype(out->T1)>();
-            out->T2 = t[2].cast<decltype(out->T2)>();
-            out->T3 = t[3].cast<decltype(out->T3)>();
-            out->T4 = t[4].cast<decltype(out->T4)>();
+            out->nf = t[1].cast<Index>();
+            out->entries = t[2].cast<decltype(out->entries)>();
             return out;
           }))
       .PythonInterfaceWorkspaceDocumentation(TransmissionMatrix);
@@ -296,6 +286,16 @@ void py_rte(py::module_& m) {
       .PythonInterfaceBasicReferenceProperty(
           GasAbsLookup, nls_pert, NLSPert, NLSPert)
       .PythonInterfaceBasicReferenceProperty(GasAbsLookup, xsec, Xsec, Xsec)
+      .def_property(
+          "storage",
+          [](const GasAbsLookup& self) {
+            return std::string(Options::toString(self.Storage()));
+          },
+          [](GasAbsLookup& self, const std::string& storage) {
+            self.SetStorage(Options::toLookupStorageOrThrow(storage));
+          },
+          "The precision the cross sections are stored in, Double or Float; "
+          "only a table in Double gives access to xsec")
       .def(py::pickle(
           [](GasAbsLookup& self) {
             return py::make_tuple(self.Species(),
@@ -308,10 +308,12 @@ void py_rte(py::module_& m) {
                                   self.Tref(),
                                   self.Tpert(),
                                   self.NLSPert(),
-                                  self.Xsec());
+                                  self.XsecCopy(),
+                                  std::string(Options::toString(self.Storage())));
           },
           [](const py::tuple& t) {
-            ARTS_USER_ERROR_IF(t.size() != 11, "Invalid state!")
+            ARTS_USER_ERROR_IF(t.size() != 11 and t.size() != 12,
+                               "Invalid state!")
 
             auto out = std::make_unique<GasAbsLookup>();
 
@@ -326,6 +328,9 @@ void py_rte(py::module_& m) {
             out->Tpert() = t[8].cast<Vector>();
             out->NLSPert() = t[9].cast<Vector>();
             out->Xsec() = t[10].cast<Tensor4>();
+            if (t.size() == 12)
+              out->SetStorage(
+                  Options::toLookupStorageOrThrow(t[11].cast<std::string>()));
 
             return out;
           }))
@@ -232,6 +232,9 @@ void py_workspace(py::module_& m,
              std::unique_ptr<Agenda> a{parse_agenda(w, 
                  correct_include_path(path).c_str(),
                  *static_cast<Verbosity*>(w.get<Verbosity>("verbosity")))};
+
+             // Parsing touches the global include paths, running does not
+             py::gil_scoped_release gil_release;
              a->execute(w);
            })
       .def_property_readonly("size", &Workspace::nelem)
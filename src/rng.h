@@ -5,6 +5,8 @@
 #include "matpack_concepts.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <mutex>
 #include <ostream>
@@ -190,6 +192,128 @@ public:
   }
 };
 
+/** A counter-based random bit generator, Philox4x32-10
+ *
+ * See Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11.
+ *
+ * The output is a pure function of a key, a stream number, and the number of
+ * draws.  Generators with the same key but different stream numbers are
+ * independent, so that many parallel streams can be created without any
+ * shared state, and so that the numbers of a stream do not depend on which
+ * thread draws them
+ */
+class Philox4x32 {
+ public:
+  using result_type = std::uint64_t;
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  using block = std::array<std::uint32_t, 4>;
+
+  /** Construct a new generator
+   *
+   * @param key The key of all the streams
+   * @param stream The stream number of this key
+   */
+  explicit Philox4x32(result_type key = 0, result_type stream = 0) {
+    seed(key, stream);
+  }
+
+  /** Restart at the first draw of a stream
+   *
+   * @param key The key of all the streams
+   * @param stream The stream number of this key
+   */
+  void seed(result_type key, result_type stream = 0) {
+    k = {std::uint32_t(key), std::uint32_t(key >> 32)};
+    s = stream;
+    n = 0;
+    i = 2;
+  }
+
+  /** The next 64 random bits of the stream */
+  result_type operator()() {
+    if (i == 2) {
+      const block x = generate({std::uint32_t(n),
+                                std::uint32_t(n >> 32),
+                                std::uint32_t(s),
+                                std::uint32_t(s >> 32)},
+                               k);
+      out = {x[0] | (result_type(x[1]) << 32),
+             x[2] | (result_type(x[3]) << 32)};
+      n++;
+      i = 0;
+    }
+    return out[i++];
+  }
+
+  /** The raw Philox4x32-10 bijection of a counter under a key */
+  static constexpr block generate(block c, std::array<std::uint32_t, 2> key) {
+    for (int r = 0; r < 10; r++) {
+      if (r) {
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+      }
+      const std::uint64_t p0 = std::uint64_t(0xD2511F53) * c[0];
+      const std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * c[2];
+      c = {std::uint32_t(p1 >> 32) ^ c[1] ^ key[0],
+           std::uint32_t(p1),
+           std::uint32_t(p0 >> 32) ^ c[3] ^ key[1],
+           std::uint32_t(p0)};
+    }
+    return c;
+  }
+
+ private:
+  std::array<std::uint32_t, 2> k;
+  result_type s;
+  result_type n;
+  std::array<result_type, 2> out;
+  int i;
+};
+
+/** A cheap, unsynchronized random number stream
+ *
+ * Unlike RandomNumberGenerator, the callables of get<>() share the state of
+ * the stream so no new generator is seeded per call, and the stream must
+ * outlive them.  A stream is meant to be owned by a single thread, e.g., one
+ * stream per Monte Carlo photon so that the result is reproducible for any
+ * number of threads
+ */
+class RandomNumberStream {
+  Philox4x32 v;
+
+ public:
+  /** Construct a new Random Number Stream object
+   *
+   * @param seed The seed of all streams
+   * @param stream The stream number of this seed
+   */
+  RandomNumberStream(std::uint64_t seed, std::uint64_t stream = 0)
+      : v(seed, stream) {}
+
+  /** Returns a random number generator of some random distribution
+   *
+   * See RandomNumberGenerator::get for the options
+   *
+   * @tparam random_distribution A random number distribution
+   * @param x The parameters to construct the random_distribution
+   * @return auto A callable generator of random numbers
+   */
+  template <template <typename>
+            class random_distribution = std::uniform_real_distribution,
+            typename... Ts>
+  auto get(Ts &&...x) {
+    return [&v = v,
+            draw = random_distribution(std::forward<Ts>(x)...)]() mutable {
+      return draw(v);
+    };
+  }
+};
+
 /** Wraps the generation of a random number generator for a matpack type
  *
  * @tparam random_distribution As for RandomNumberGenerator::get
@@ -20,6 +20,7 @@
 #include <complex>
 #include <stdexcept>
 
+#include "arts_omp.h"
 #include "auto_md.h"
 #include "check_input.h"
 #include "disort.h"
@@ -440,46 +441,172 @@ void run_rt4(Workspace& ws,
   }
 
   Index nummu_new = 0;
+
+  // Without auto_inc_nstreams the frequencies are independent of each other
+  // and are calculated in parallel. RT4 keeps scratch data in COMMON blocks
+  // and static arrays, so radtrano_ is still run by one thread at a time.
+  const Index nf = f_grid.nelem();
+  const ArtsOmpNestedLoop f_loop{auto_inc_nstreams ? 1 : nf};
+  WorkspaceOmpParallelCopyGuard wss{ws, f_loop.threads() > 1};
+  bool failed = false;
+  String fail_msg;
+
   // Loop over frequencies
-  for (Index f_index = 0; f_index < f_grid.nelem(); f_index++) {
-    // Wavelength [um]
-    Numeric wavelength;
-    wavelength = 1e6 * SPEED_OF_LIGHT / f_grid[f_index];
-
-    Matrix groundreflec{ground_reflec(f_index, joker, joker)};
-    Tensor4 surfreflmat{surf_refl_mat(f_index, joker, joker, joker, joker)};
-    Matrix surfemisvec{surf_emis_vec(f_index, joker, joker)};
-    //Vector muvalues=mu_values;
-
-    // only update gas_extinct if there is any gas absorption at all (since
-    // vmr_field is not freq-dependent, gas_extinct will remain as above
-    // initialized (with 0) for all freqs, ie we can rely on that it wasn't
-    // changed).
-    if (!vmr.empty()) {
-      gas_optpropCalc(ws,
-                      gas_extinct,
-                      propmat_clearsky_agenda,
-                      t[Range(0, num_layers + 1)],
-                      vmr(joker, Range(0, num_layers + 1)),
-                      p[Range(0, num_layers + 1)],
-                      f_grid[Range(f_index, 1)]);
-    }
+#pragma omp parallel for num_threads(f_loop.threads())              \
+    if (f_loop.threads() > 1) schedule(dynamic)                     \
+    firstprivate(wss, gas_extinct, scatter_matrix, extinct_matrix, \
+                 emis_vector, up_rad, down_rad)
+  for (Index f_index = 0; f_index < nf; f_index++) {
+    if (failed) continue;
+
+    const ArtsOmpInnerThreads inner_threads{f_loop};
+    try {
+      // Wavelength [um]
+      Numeric wavelength;
+      wavelength = 1e6 * SPEED_OF_LIGHT / f_grid[f_index];
+
+      Matrix groundreflec{ground_reflec(f_index, joker, joker)};
+      Tensor4 surfreflmat{surf_refl_mat(f_index, joker, joker, joker, joker)};
+      Matrix surfemisvec{surf_emis_vec(f_index, joker, joker)};
+      //Vector muvalues=mu_values;
+
+      // only update gas_extinct if there is any gas absorption at all (since
+      // vmr_field is not freq-dependent, gas_extinct will remain as above
+      // initialized (with 0) for all freqs, ie we can rely on that it wasn't
+      // changed).
+      if (!vmr.empty()) {
+        gas_optpropCalc(wss,
+                        gas_extinct,
+                        propmat_clearsky_agenda,
+                        t[Range(0, num_layers + 1)],
+                        vmr(joker, Range(0, num_layers + 1)),
+                        p[Range(0, num_layers + 1)],
+                        f_grid[Range(f_index, 1)]);
+      }
 
-    Index pfct_failed = 0;
-    if (pndtot != 0) {
-      if (nummu_new < nummu) {
-        if (!auto_inc_nstreams)  // all freq calculated before. just copy
-                                 // here. but only if needed.
-        {
-          if (emis_vector_allf.nshelves() != 1) {
-            emis_vector =
-                emis_vector_allf(Range(f_index, 1), joker, joker, joker, joker);
-            extinct_matrix = extinct_matrix_allf(
-                Range(f_index, 1), joker, joker, joker, joker, joker);
+      Index pfct_failed = 0;
+      if (pndtot != 0) {
+        if (nummu_new < nummu) {
+          if (!auto_inc_nstreams)  // all freq calculated before. just copy
+                                   // here. but only if needed.
+          {
+            if (emis_vector_allf.nshelves() != 1) {
+              emis_vector =
+                  emis_vector_allf(Range(f_index, 1), joker, joker, joker, joker);
+              extinct_matrix = extinct_matrix_allf(
+                  Range(f_index, 1), joker, joker, joker, joker, joker);
+            }
+          } else {
+            par_optpropCalc(emis_vector,
+                            extinct_matrix,
+                            //scatlayers,
+                            scat_data,
+                            za_grid,
+                            f_index,
+                            pnd,
+                            t[Range(0, num_layers + 1)],
+                            cboxlims,
+                            stokes_dim);
           }
+          sca_optpropCalc(scatter_matrix,
+                          pfct_failed,
+                          emis_vector(0, joker, joker, joker, joker),
+                          extinct_matrix(0, joker, joker, joker, joker, joker),
+                          f_index,
+                          scat_data,
+                          pnd,
+                          stokes_dim,
+                          za_grid,
+                          quad_weights,
+                          pfct_method,
+                          pfct_aa_grid_size,
+                          pfct_threshold,
+                          auto_inc_nstreams,
+                          verbosity);
         } else {
-          par_optpropCalc(emis_vector,
-                          extinct_matrix,
+          pfct_failed = 1;
+        }
+      }
+
+      if (!pfct_failed) {
+  #pragma omp critical(fortran_rt4)
+        {
+          // Call RT4
+          radtrano_(stokes_dim,
+                    nummu,
+                    nhza,
+                    max_delta_tau,
+                    quad_type.c_str(),
+                    surface_skin_t,
+                    ground_type.c_str(),
+                    ground_albedo[f_index],
+                    ground_index[f_index],
+                    groundreflec.unsafe_data_handle(),
+                    surfreflmat.unsafe_data_handle(),
+                    surfemisvec.unsafe_data_handle(),
+                    sky_temp,
+                    wavelength,
+                    num_layers,
+                    height.unsafe_data_handle(),
+                    temperatures.unsafe_data_handle(),
+                    gas_extinct.unsafe_data_handle(),
+                    num_scatlayers,
+                    scatlayers.unsafe_data_handle(),
+                    extinct_matrix.unsafe_data_handle(),
+                    emis_vector.unsafe_data_handle(),
+                    scatter_matrix.unsafe_data_handle(),
+                    //noutlevels,
+                    //outlevels.unsafe_data_handle(),
+                    mu_values.unsafe_data_handle(),
+                    up_rad.unsafe_data_handle(),
+                    down_rad.unsafe_data_handle());
+        }
+
+      } else {  // if (auto_inc_nstreams)
+
+        if (nummu_new < nummu) nummu_new = nummu + 1;
+
+        Index nhstreams_new;
+        Vector mu_values_new, quad_weights_new, aa_grid_new;
+        Tensor6 scatter_matrix_new;
+        Tensor6 extinct_matrix_new;
+        Tensor5 emis_vector_new;
+        Tensor4 surfreflmat_new;
+        Matrix surfemisvec_new;
+
+        while (pfct_failed && (2 * nummu_new) <= auto_inc_nstreams) {
+          // resize and recalc nstream-affected/determined variables:
+          //   - mu_values, quad_weights (resize & recalc)
+          nhstreams_new = nummu_new - nhza;
+          mu_values_new.resize(nummu_new);
+          mu_values_new = 0.;
+          quad_weights_new.resize(nummu_new);
+          quad_weights_new = 0.;
+          get_quad_angles(mu_values_new,
+                          quad_weights_new,
+                          za_grid,
+                          aa_grid_new,
+                          quad_type,
+                          nhstreams_new,
+                          nhza,
+                          nummu_new);
+
+          //   - resize & recalculate emis_vector, extinct_matrix (as input to scatter_matrix calc)
+          extinct_matrix_new.resize(
+              1, num_scatlayers, 2, nummu_new, stokes_dim, stokes_dim);
+          extinct_matrix_new = 0.;
+          emis_vector_new.resize(1, num_scatlayers, 2, nummu_new, stokes_dim);
+          emis_vector_new = 0.;
+          // FIXME: So far, outside-of-freq-loop calculated optprops will fall
+          // back to in-loop-calculated ones in case of auto-increasing stream
+          // numbers. There might be better options, but I (JM) couldn't come up
+          // with or decide for one so far (we could recalc over all freqs. but
+          // that would unnecessarily recalc lower-freq optprops, too, which are
+          // not needed anymore. which could likely take more time than we
+          // potentially safe through all-at-once temperature and direction
+          // interpolations.
+          par_optpropCalc(emis_vector_new,
+                          extinct_matrix_new,
                           //scatlayers,
                           scat_data,
                           za_grid,
@@ -488,303 +615,208 @@ void run_rt4(Workspace& ws,
                           t[Range(0, num_layers + 1)],
                           cboxlims,
                           stokes_dim);
+
+          //   - resize & recalc scatter_matrix
+          scatter_matrix_new.resize(
+              num_scatlayers, 4, nummu_new, stokes_dim, nummu_new, stokes_dim);
+          scatter_matrix_new = 0.;
+          pfct_failed = 0;
+          sca_optpropCalc(
+              scatter_matrix_new,
+              pfct_failed,
+              emis_vector_new(0, joker, joker, joker, joker),
+              extinct_matrix_new(0, joker, joker, joker, joker, joker),
+              f_index,
+              scat_data,
+              pnd,
+              stokes_dim,
+              za_grid,
+              quad_weights_new,
+              pfct_method,
+              pfct_aa_grid_size,
+              pfct_threshold,
+              auto_inc_nstreams,
+              verbosity);
+
+          if (pfct_failed) nummu_new = nummu_new + 1;
         }
-        sca_optpropCalc(scatter_matrix,
-                        pfct_failed,
-                        emis_vector(0, joker, joker, joker, joker),
-                        extinct_matrix(0, joker, joker, joker, joker, joker),
-                        f_index,
-                        scat_data,
-                        pnd,
-                        stokes_dim,
-                        za_grid,
-                        quad_weights,
-                        pfct_method,
-                        pfct_aa_grid_size,
-                        pfct_threshold,
-                        auto_inc_nstreams,
-                        verbosity);
-      } else {
-        pfct_failed = 1;
-      }
-    }
 
-    if (!pfct_failed) {
-#pragma omp critical(fortran_rt4)
-      {
-        // Call RT4
-        radtrano_(stokes_dim,
-                  nummu,
-                  nhza,
-                  max_delta_tau,
-                  quad_type.c_str(),
-                  surface_skin_t,
-                  ground_type.c_str(),
-                  ground_albedo[f_index],
-                  ground_index[f_index],
-                  groundreflec.unsafe_data_handle(),
-                  surfreflmat.unsafe_data_handle(),
-                  surfemisvec.unsafe_data_handle(),
-                  sky_temp,
-                  wavelength,
-                  num_layers,
-                  height.unsafe_data_handle(),
-                  temperatures.unsafe_data_handle(),
-                  gas_extinct.unsafe_data_handle(),
-                  num_scatlayers,
-                  scatlayers.unsafe_data_handle(),
-                  extinct_matrix.unsafe_data_handle(),
-                  emis_vector.unsafe_data_handle(),
-                  scatter_matrix.unsafe_data_handle(),
-                  //noutlevels,
-                  //outlevels.unsafe_data_handle(),
-                  mu_values.unsafe_data_handle(),
-                  up_rad.unsafe_data_handle(),
-                  down_rad.unsafe_data_handle());
-      }
+        if (pfct_failed) {
+          nummu_new = nummu_new - 1;
+          std::ostringstream os;
+          os << "Could not increase nstreams sufficiently (current: "
+             << 2 * nummu_new << ")\n"
+             << "to satisfy scattering matrix norm at f[" << f_index
+             << "]=" << f_grid[f_index] * 1e-9 << " GHz.\n";
+          ARTS_USER_ERROR_IF (!robust,
+            // couldn't find a nstreams within the limits of auto_inc_nstremas
+            // (aka max. nstreams) that satisfies the scattering matrix norm.
+            // Hence fail completely.
+            "Try higher maximum number of allowed streams (ie. higher"
+            " auto_inc_nstreams than ", auto_inc_nstreams, ").");
+        
+          CREATE_OUT1;
+          os << "Continuing with nstreams=" << 2 * nummu_new
+              << ". Output for this frequency might be erroneous.";
+          out1 << os.str();
+          pfct_failed = -1;
+          sca_optpropCalc(
+              scatter_matrix_new,
+              pfct_failed,
+              emis_vector_new(0, joker, joker, joker, joker),
+              extinct_matrix_new(0, joker, joker, joker, joker, joker),
+              f_index,
+              scat_data,
+              pnd,
+              stokes_dim,
+              za_grid,
+              quad_weights_new,
+              pfct_method,
+              pfct_aa_grid_size,
+              pfct_threshold,
+              0,
+              verbosity);
+        }
 
-    } else {  // if (auto_inc_nstreams)
-
-      if (nummu_new < nummu) nummu_new = nummu + 1;
-
-      Index nhstreams_new;
-      Vector mu_values_new, quad_weights_new, aa_grid_new;
-      Tensor6 scatter_matrix_new;
-      Tensor6 extinct_matrix_new;
-      Tensor5 emis_vector_new;
-      Tensor4 surfreflmat_new;
-      Matrix surfemisvec_new;
-
-      while (pfct_failed && (2 * nummu_new) <= auto_inc_nstreams) {
-        // resize and recalc nstream-affected/determined variables:
-        //   - mu_values, quad_weights (resize & recalc)
-        nhstreams_new = nummu_new - nhza;
-        mu_values_new.resize(nummu_new);
-        mu_values_new = 0.;
-        quad_weights_new.resize(nummu_new);
-        quad_weights_new = 0.;
-        get_quad_angles(mu_values_new,
-                        quad_weights_new,
-                        za_grid,
-                        aa_grid_new,
-                        quad_type,
-                        nhstreams_new,
-                        nhza,
-                        nummu_new);
-
-        //   - resize & recalculate emis_vector, extinct_matrix (as input to scatter_matrix calc)
-        extinct_matrix_new.resize(
-            1, num_scatlayers, 2, nummu_new, stokes_dim, stokes_dim);
-        extinct_matrix_new = 0.;
-        emis_vector_new.resize(1, num_scatlayers, 2, nummu_new, stokes_dim);
-        emis_vector_new = 0.;
-        // FIXME: So far, outside-of-freq-loop calculated optprops will fall
-        // back to in-loop-calculated ones in case of auto-increasing stream
-        // numbers. There might be better options, but I (JM) couldn't come up
-        // with or decide for one so far (we could recalc over all freqs. but
-        // that would unnecessarily recalc lower-freq optprops, too, which are
-        // not needed anymore. which could likely take more time than we
-        // potentially safe through all-at-once temperature and direction
-        // interpolations.
-        par_optpropCalc(emis_vector_new,
-                        extinct_matrix_new,
-                        //scatlayers,
-                        scat_data,
-                        za_grid,
-                        f_index,
-                        pnd,
-                        t[Range(0, num_layers + 1)],
-                        cboxlims,
-                        stokes_dim);
-
-        //   - resize & recalc scatter_matrix
-        scatter_matrix_new.resize(
-            num_scatlayers, 4, nummu_new, stokes_dim, nummu_new, stokes_dim);
-        scatter_matrix_new = 0.;
-        pfct_failed = 0;
-        sca_optpropCalc(
-            scatter_matrix_new,
-            pfct_failed,
-            emis_vector_new(0, joker, joker, joker, joker),
-            extinct_matrix_new(0, joker, joker, joker, joker, joker),
-            f_index,
-            scat_data,
-            pnd,
-            stokes_dim,
-            za_grid,
-            quad_weights_new,
-            pfct_method,
-            pfct_aa_grid_size,
-            pfct_threshold,
-            auto_inc_nstreams,
-            verbosity);
-
-        if (pfct_failed) nummu_new = nummu_new + 1;
-      }
+        // resize and calc remaining nstream-affected variables:
+        //   - in case of surface_rtprop_agenda driven surface: surfreflmat, surfemisvec
+        if (ground_type == "A")  // surface_rtprop_agenda driven surface
+        {
+          Tensor5 srm_new(1, nummu_new, stokes_dim, nummu_new, stokes_dim, 0.);
+          Tensor3 sev_new(1, nummu_new, stokes_dim, 0.);
+          surf_optpropCalc(wss,
+                           srm_new,
+                           sev_new,
+                           surface_rtprop_agenda,
+                           f_grid[Range(f_index, 1)],
+                           za_grid,
+                           mu_values_new,
+                           quad_weights_new,
+                           stokes_dim,
+                           surf_altitude);
+          surfreflmat_new = srm_new(0, joker, joker, joker, joker);
+          surfemisvec_new = sev_new(0, joker, joker);
+        }
+        //   - up/down_rad (resize only)
+        Tensor3 up_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
+        Tensor3 down_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
+        //
+        // run radtrano_
+  #pragma omp critical(fortran_rt4)
+        {
+          // Call RT4
+          radtrano_(stokes_dim,
+                    nummu_new,
+                    nhza,
+                    max_delta_tau,
+                    quad_type.c_str(),
+                    surface_skin_t,
+                    ground_type.c_str(),
+                    ground_albedo[f_index],
+                    ground_index[f_index],
+                    groundreflec.unsafe_data_handle(),
+                    surfreflmat_new.unsafe_data_handle(),
+                    surfemisvec_new.unsafe_data_handle(),
+                    sky_temp,
+                    wavelength,
+                    num_layers,
+                    height.unsafe_data_handle(),
+                    temperatures.unsafe_data_handle(),
+                    gas_extinct.unsafe_data_handle(),
+                    num_scatlayers,
+                    scatlayers.unsafe_data_handle(),
+                    extinct_matrix_new(0, joker, joker, joker, joker, joker)
+                        .unsafe_data_handle(),
+                    emis_vector_new(0, joker, joker, joker, joker).unsafe_data_handle(),
+                    scatter_matrix_new.unsafe_data_handle(),
+                    //noutlevels,
+                    //outlevels.unsafe_data_handle(),
+                    mu_values_new.unsafe_data_handle(),
+                    up_rad_new.unsafe_data_handle(),
+                    down_rad_new.unsafe_data_handle());
+        }
+        // back-interpolate nstream_new fields to nstreams
+        //   (possible to use iyCloudboxInterp agenda? nja, not really a good
+        //   idea. too much overhead there (checking, 3D+2ang interpol). rather
+        //   use interp_order as additional user parameter.
+        //   extrapol issues shouldn't occur as we go from finer to coarser
+        //   angular grid)
+        //   - loop over nummu:
+        //     - determine weights per ummu ang (should be valid for both up and
+        //       down)
+        //     - loop over num_layers and stokes_dim:
+        //       - apply weights
+        for (Index j = 0; j < nummu; j++) {
+          const LagrangeInterpolation lag_za(0,
+                                             cos_za_interp ? mu_values[j] : za_grid_orig[j], 
+                                             cos_za_interp ? VectorView{mu_values_new} : za_grid[Range(0, nummu_new)],
+                                             za_interp_order);
+          const auto itw = interpweights(lag_za);
+
+          for (Index k = 0; k < num_layers + 1; k++)
+            for (Index ist = 0; ist < stokes_dim; ist++) {
+              up_rad(k, j, ist) = interp(up_rad_new(k, joker, ist), itw, lag_za);
+              down_rad(k, j, ist) = interp(down_rad_new(k, joker, ist), itw, lag_za);
+            }
+        }
 
-      if (pfct_failed) {
-        nummu_new = nummu_new - 1;
-        std::ostringstream os;
-        os << "Could not increase nstreams sufficiently (current: "
-           << 2 * nummu_new << ")\n"
-           << "to satisfy scattering matrix norm at f[" << f_index
-           << "]=" << f_grid[f_index] * 1e-9 << " GHz.\n";
-        ARTS_USER_ERROR_IF (!robust,
-          // couldn't find a nstreams within the limits of auto_inc_nstremas
-          // (aka max. nstreams) that satisfies the scattering matrix norm.
-          // Hence fail completely.
-          "Try higher maximum number of allowed streams (ie. higher"
-          " auto_inc_nstreams than ", auto_inc_nstreams, ").");
-        
-        CREATE_OUT1;
-        os << "Continuing with nstreams=" << 2 * nummu_new
-            << ". Output for this frequency might be erroneous.";
-        out1 << os.str();
-        pfct_failed = -1;
-        sca_optpropCalc(
-            scatter_matrix_new,
-            pfct_failed,
-            emis_vector_new(0, joker, joker, joker, joker),
-            extinct_matrix_new(0, joker, joker, joker, joker, joker),
-            f_index,
-            scat_data,
-            pnd,
-            stokes_dim,
-            za_grid,
-            quad_weights_new,
-            pfct_method,
-            pfct_aa_grid_size,
-            pfct_threshold,
-            0,
-            verbosity);
+        // reconstruct za_grid
+        za_grid = za_grid_orig;
       }
 
-      // resize and calc remaining nstream-affected variables:
-      //   - in case of surface_rtprop_agenda driven surface: surfreflmat, surfemisvec
-      if (ground_type == "A")  // surface_rtprop_agenda driven surface
-      {
-        Tensor5 srm_new(1, nummu_new, stokes_dim, nummu_new, stokes_dim, 0.);
-        Tensor3 sev_new(1, nummu_new, stokes_dim, 0.);
-        surf_optpropCalc(ws,
-                         srm_new,
-                         sev_new,
-                         surface_rtprop_agenda,
-                         f_grid[Range(f_index, 1)],
-                         za_grid,
-                         mu_values_new,
-                         quad_weights_new,
-                         stokes_dim,
-                         surf_altitude);
-        surfreflmat_new = srm_new(0, joker, joker, joker, joker);
-        surfemisvec_new = sev_new(0, joker, joker);
-      }
-      //   - up/down_rad (resize only)
-      Tensor3 up_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
-      Tensor3 down_rad_new(num_layers + 1, nummu_new, stokes_dim, 0.);
+      // RT4 rad output is in wavelength units, nominally in W/(m2 sr um), where
+      // wavelength input is required in um.
+      // FIXME: When using wavelength input in m, output should be in W/(m2 sr
+      // m). However, check this. So, at first we use wavelength in um. Then
+      // change and compare.
       //
-      // run radtrano_
-#pragma omp critical(fortran_rt4)
-      {
-        // Call RT4
-        radtrano_(stokes_dim,
-                  nummu_new,
-                  nhza,
-                  max_delta_tau,
-                  quad_type.c_str(),
-                  surface_skin_t,
-                  ground_type.c_str(),
-                  ground_albedo[f_index],
-                  ground_index[f_index],
-                  groundreflec.unsafe_data_handle(),
-                  surfreflmat_new.unsafe_data_handle(),
-                  surfemisvec_new.unsafe_data_handle(),
-                  sky_temp,
-                  wavelength,
-                  num_layers,
-                  height.unsafe_data_handle(),
-                  temperatures.unsafe_data_handle(),
-                  gas_extinct.unsafe_data_handle(),
-                  num_scatlayers,
-                  scatlayers.unsafe_data_handle(),
-                  extinct_matrix_new(0, joker, joker, joker, joker, joker)
-                      .unsafe_data_handle(),
-                  emis_vector_new(0, joker, joker, joker, joker).unsafe_data_handle(),
-                  scatter_matrix_new.unsafe_data_handle(),
-                  //noutlevels,
-                  //outlevels.unsafe_data_handle(),
-                  mu_values_new.unsafe_data_handle(),
-                  up_rad_new.unsafe_data_handle(),
-                  down_rad_new.unsafe_data_handle());
-      }
-      // back-interpolate nstream_new fields to nstreams
-      //   (possible to use iyCloudboxInterp agenda? nja, not really a good
-      //   idea. too much overhead there (checking, 3D+2ang interpol). rather
-      //   use interp_order as additional user parameter.
-      //   extrapol issues shouldn't occur as we go from finer to coarser
-      //   angular grid)
-      //   - loop over nummu:
-      //     - determine weights per ummu ang (should be valid for both up and
-      //       down)
-      //     - loop over num_layers and stokes_dim:
-      //       - apply weights
+      // FIXME: if ever we allow the cloudbox to be not directly at the surface
+      // (at atm level #0, respectively), the assigning from up/down_rad to
+      // cloudbox_field needs to checked. there seems some offsetting going on
+      // (test example: TestDOIT.arts. if kept like below, cloudbox_field at
+      // top-of-cloudbox seems to actually be from somewhere within the
+      // cloud(box) indicated by downwelling being to high and downwelling
+      // exhibiting a non-zero polarisation signature (which it wouldn't with
+      // only scalar gas abs above).
+      //
+      Numeric rad_l2f = wavelength / f_grid[f_index];
+      // down/up_rad contain the radiances in order from slant (90deg) to steep
+      // (0 and 180deg, respectively) streams,then the possible extra angle(s).
+      // We need to resort them properly into cloudbox_field, such that order is
+      // from 0 to 180deg.
       for (Index j = 0; j < nummu; j++) {
-        const LagrangeInterpolation lag_za(0,
-                                           cos_za_interp ? mu_values[j] : za_grid_orig[j], 
-                                           cos_za_interp ? VectorView{mu_values_new} : za_grid[Range(0, nummu_new)],
-                                           za_interp_order);
-        const auto itw = interpweights(lag_za);
-
-        for (Index k = 0; k < num_layers + 1; k++)
-          for (Index ist = 0; ist < stokes_dim; ist++) {
-            up_rad(k, j, ist) = interp(up_rad_new(k, joker, ist), itw, lag_za);
-            down_rad(k, j, ist) = interp(down_rad_new(k, joker, ist), itw, lag_za);
+        for (Index ist = 0; ist < stokes_dim; ist++) {
+          for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
+            cloudbox_field(f_index, k + ncboxremoved, 0, 0, nummu + j, 0, ist) =
+                up_rad(num_layers - k, j, ist) * rad_l2f;
+            cloudbox_field(
+                f_index, k + ncboxremoved, 0, 0, nummu - 1 - j, 0, ist) =
+                down_rad(num_layers - k, j, ist) * rad_l2f;
+          }
+          // To avoid potential numerical problems at interpolation of the field,
+          // we copy the surface field to underground altitudes
+          for (Index k = ncboxremoved - 1; k >= 0; k--) {
+            cloudbox_field(f_index, k, 0, 0, nummu + j, 0, ist) =
+                cloudbox_field(f_index, k + 1, 0, 0, nummu + j, 0, ist);
+            cloudbox_field(f_index, k, 0, 0, nummu - 1 + j, 0, ist) =
+                cloudbox_field(f_index, k + 1, 0, 0, nummu - 1 + j, 0, ist);
           }
-      }
-
-      // reconstruct za_grid
-      za_grid = za_grid_orig;
-    }
-
-    // RT4 rad output is in wavelength units, nominally in W/(m2 sr um), where
-    // wavelength input is required in um.
-    // FIXME: When using wavelength input in m, output should be in W/(m2 sr
-    // m). However, check this. So, at first we use wavelength in um. Then
-    // change and compare.
-    //
-    // FIXME: if ever we allow the cloudbox to be not directly at the surface
-    // (at atm level #0, respectively), the assigning from up/down_rad to
-    // cloudbox_field needs to checked. there seems some offsetting going on
-    // (test example: TestDOIT.arts. if kept like below, cloudbox_field at
-    // top-of-cloudbox seems to actually be from somewhere within the
-    // cloud(box) indicated by downwelling being to high and downwelling
-    // exhibiting a non-zero polarisation signature (which it wouldn't with
-    // only scalar gas abs above).
-    //
-    Numeric rad_l2f = wavelength / f_grid[f_index];
-    // down/up_rad contain the radiances in order from slant (90deg) to steep
-    // (0 and 180deg, respectively) streams,then the possible extra angle(s).
-    // We need to resort them properly into cloudbox_field, such that order is
-    // from 0 to 180deg.
-    for (Index j = 0; j < nummu; j++) {
-      for (Index ist = 0; ist < stokes_dim; ist++) {
-        for (Index k = cboxlims[1] - cboxlims[0]; k >= 0; k--) {
-          cloudbox_field(f_index, k + ncboxremoved, 0, 0, nummu + j, 0, ist) =
-              up_rad(num_layers - k, j, ist) * rad_l2f;
-          cloudbox_field(
-              f_index, k + ncboxremoved, 0, 0, nummu - 1 - j, 0, ist) =
-              down_rad(num_layers - k, j, ist) * rad_l2f;
-        }
-        // To avoid potential numerical problems at interpolation of the field,
-        // we copy the surface field to underground altitudes
-        for (Index k = ncboxremoved - 1; k >= 0; k--) {
-          cloudbox_field(f_index, k, 0, 0, nummu + j, 0, ist) =
-              cloudbox_field(f_index, k + 1, 0, 0, nummu + j, 0, ist);
-          cloudbox_field(f_index, k, 0, 0, nummu - 1 + j, 0, ist) =
-              cloudbox_field(f_index, k + 1, 0, 0, nummu - 1 + j, 0, ist);
         }
       }
+    } catch (const std::exception& e) {
+      std::ostringstream os;
+      os << "Error for f_index = " << f_index << " (" << f_grid[f_index]
+         << " Hz)\n"
+         << e.what();
+#pragma omp critical(run_rt4_fail)
+      {
+        failed = true;
+        fail_msg = os.str();
+      }
     }
   }
+
+  ARTS_USER_ERROR_IF(failed, fail_msg)
 }
 
 void za_grid_adjust(  // Output
@@ -25,6 +25,7 @@
 #include "ppath.h"
 #include "refraction.h"
 #include "special_interp.h"
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -1637,94 +1638,53 @@ void iyb_calc(Workspace& ws,
 
   String fail_msg;
   bool failed = false;
-  if (nlos >= arts_omp_get_max_threads() || nlos * 10 >= nf) {
-    out3 << "  Parallelizing los loop (" << nlos << " iterations, " << nf
-         << " frequencies)\n";
-
-    WorkspaceOmpParallelCopyGuard wss{ws};
-
-    // Start of actual calculations
-#pragma omp parallel for if (!arts_omp_in_parallel()) firstprivate(wss)
-    for (Index ilos = 0; ilos < nlos; ilos++) {
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      Ppath ppath;
-      Vector geo_pos;
-      iyb_calc_body(failed,
-                    fail_msg,
-                    iy_aux_array,
-                    wss,
-                    ppath,
-                    iyb,
-                    diyb_dx,
-                    geo_pos,
-                    mblock_index,
-                    atmosphere_dim,
-                    nlte_field,
-                    cloudbox_on,
-                    stokes_dim,
-                    sensor_pos,
-                    sensor_los,
-                    transmitter_pos,
-                    mblock_dlos,
-                    iy_unit,
-                    iy_main_agenda,
-                    j_analytical_do,
-                    jacobian_quantities,
-                    jacobian_indices,
-                    f_grid,
-                    iy_aux_vars,
-                    ilos,
-                    nf);
-
-      if (geo_pos.nelem()) geo_pos_matrix(ilos, joker) = geo_pos;
-
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-    }
-  } else {
-    out3 << "  Not parallelizing los loop (" << nlos << " iterations, " << nf
-         << " frequencies)\n";
-
-    for (Index ilos = 0; ilos < nlos; ilos++) {
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-
-      Ppath ppath;
-      Vector geo_pos;
-      iyb_calc_body(failed,
-                    fail_msg,
-                    iy_aux_array,
-                    ws,
-                    ppath,
-                    iyb,
-                    diyb_dx,
-                    geo_pos,
-                    mblock_index,
-                    atmosphere_dim,
-                    nlte_field,
-                    cloudbox_on,
-                    stokes_dim,
-                    sensor_pos,
-                    sensor_los,
-                    transmitter_pos,
-                    mblock_dlos,
-                    iy_unit,
-                    iy_main_agenda,
-                    j_analytical_do,
-                    jacobian_quantities,
-                    jacobian_indices,
-                    f_grid,
-                    iy_aux_vars,
-                    ilos,
-                    nf);
-
-      if (geo_pos.nelem()) geo_pos_matrix(ilos, joker) = geo_pos;
-
-      // Skip remaining iterations if an error occurred
-      if (failed) continue;
-    }
+  // Threads the los loop can not use are handed to iy_main_agenda
+  const ArtsOmpNestedLoop los_loop{nlos};
+  out3 << "  Parallelizing los loop (" << nlos << " iterations, " << nf
+       << " frequencies, " << los_loop.threads() << " threads)\n";
+
+  WorkspaceOmpParallelCopyGuard wss{ws, los_loop.threads() > 1};
+
+#pragma omp parallel for num_threads(los_loop.threads()) \
+    if (los_loop.threads() > 1) firstprivate(wss)
+  for (Index ilos = 0; ilos < nlos; ilos++) {
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
+
+    const ArtsOmpInnerThreads inner_threads{los_loop};
+    Ppath ppath;
+    Vector geo_pos;
+    iyb_calc_body(failed,
+                  fail_msg,
+                  iy_aux_array,
+                  wss,
+                  ppath,
+                  iyb,
+                  diyb_dx,
+                  geo_pos,
+                  mblock_index,
+                  atmosphere_dim,
+                  nlte_field,
+                  cloudbox_on,
+                  stokes_dim,
+                  sensor_pos,
+                  sensor_los,
+                  transmitter_pos,
+                  mblock_dlos,
+                  iy_unit,
+                  iy_main_agenda,
+                  j_analytical_do,
+                  jacobian_quantities,
+                  jacobian_indices,
+                  f_grid,
+                  iy_aux_vars,
+                  ilos,
+                  nf);
+
+    if (geo_pos.nelem()) geo_pos_matrix(ilos, joker) = geo_pos;
+
+    // Skip remaining iterations if an error occurred
+    if (failed) continue;
   }
 
   ARTS_USER_ERROR_IF (failed,
@@ -2300,3 +2260,8 @@ void ze_cfac(Vector& fac,
     fac[iv] = a * la * la * la * la / K2;
   }
 }
+
+Index ppath_fused_chunks(const Index np) {
+  return std::clamp<Index>(
+      arts_omp_get_available_threads(), 1, std::max<Index>(np, 1));
+}
@@ -19,6 +19,7 @@
 
 #include "agenda_class.h"
 #include "arts.h"
+#include "arts_omp.h"
 #include "jacobian.h"
 #include "matpack_data.h"
 #include "matpack_complex.h"
@@ -943,4 +944,54 @@ void ze_cfac(Vector& fac,
              const Numeric& ze_tref,
              const Numeric& k2);
 
+/** Computes point and layer properties along a propagation path in one pass
+
+   The points are split into one contiguous chunk per thread.  Each thread
+   computes its points in order, and the layer ending at a point as soon as
+   the point is done, while the properties of the previous point are still
+   in cache.  The few layers crossing the chunk boundaries are computed
+   after the parallel pass.
+
+   The chunk index is passed on to the functions, so that they can keep
+   scratch memory and workspace copies per chunk.  Only a single chunk is
+   used if no threads are available, see arts_omp_get_available_threads.
+
+   Errors have to be handled by the functions themselves.
+
+   @param[in]   np       Number of propagation path points.
+   @param[in]   nchunks  Number of chunks, as given by ppath_fused_chunks.
+   @param[in]   point    Called as point(ip, ichunk) for 0 <= ip < np.
+   @param[in]   layer    Called as layer(ip, ichunk) for 0 < ip < np, after
+                         point(ip - 1, ...) and point(ip, ...).
+
+   @date   2026-10-18
+*/
+template <typename PointFunc, typename LayerFunc>
+void ppath_fused_pass(const Index np,
+                      const Index nchunks,
+                      PointFunc&& point,
+                      LayerFunc&& layer) {
+#pragma omp parallel for num_threads(int(nchunks)) if (nchunks > 1) \
+    schedule(static, 1)
+  for (Index ic = 0; ic < nchunks; ic++) {
+    const Index first = np * ic / nchunks;
+    const Index last = np * (ic + 1) / nchunks;
+    for (Index ip = first; ip < last; ip++) {
+      point(ip, ic);
+      if (ip > first) layer(ip, ic);
+    }
+  }
+
+  for (Index ic = 1; ic < nchunks; ic++) layer(np * ic / nchunks, 0);
+}
+
+/** The number of chunks to use for ppath_fused_pass
+
+   @param[in]   np  Number of propagation path points.
+   @return  One chunk per available thread, but at most np.
+
+   @date   2026-10-18
+*/
+Index ppath_fused_chunks(const Index np);
+
 #endif  // rte_h
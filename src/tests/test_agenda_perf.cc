@@ -0,0 +1,106 @@
+#include "agenda_record.h"
+#include "agenda_set.h"
+#include "artstime.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "methods.h"
+#include "workspace.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+//! Calls of the agendas, much fewer for a smoke run
+Index N = 100'000;
+
+//! Time per execution of a propmat_clearsky_agenda at a single frequency
+TimeStep time_per_call(Workspace& ws, const Agenda& agenda) {
+  const ArrayOfRetrievalQuantity jacobian_quantities;
+  const ArrayOfSpeciesTag select_abs_species;
+  const Vector f_grid(1, 100e9);
+  const Vector rtp_mag(3, 0);
+  const Vector rtp_los(2, 0);
+  const EnergyLevelMap rtp_nlte;
+  const Vector rtp_vmr{0.21, 0.01};
+
+  PropagationMatrix propmat_clearsky;
+  StokesVector nlte_source;
+  ArrayOfPropagationMatrix dpropmat_clearsky_dx;
+  ArrayOfStokesVector dnlte_source_dx;
+
+  const Time start{};
+  for (Index i = 0; i < N; i++)
+    propmat_clearsky_agendaExecute(ws,
+                                   propmat_clearsky,
+                                   nlte_source,
+                                   dpropmat_clearsky_dx,
+                                   dnlte_source_dx,
+                                   jacobian_quantities,
+                                   select_abs_species,
+                                   f_grid,
+                                   rtp_mag,
+                                   rtp_los,
+                                   1e4,
+                                   250,
+                                   rtp_nlte,
+                                   rtp_vmr,
+                                   agenda);
+  const Time end{};
+  return TimeStep(end - start) / Numeric(N);
+}
+}  // namespace
+
+//! Usage: test_agenda_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) N = 100;
+
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+
+  auto ws_ptr = Workspace::create();
+  Workspace& ws = *ws_ptr;
+
+  // Workspace variables used by the methods of the agendas
+  ArrayOfArrayOfSpeciesTag abs_species{ArrayOfSpeciesTag("O2-PWR98"),
+                                       ArrayOfSpeciesTag("H2O-PWR98")};
+  Index stokes_dim = 1;
+  Index propmat_clearsky_agenda_checked = 1;
+  PredefinedModelData predefined_model_data;
+  Verbosity verbosity;
+  auto b0 = ws.borrow(ws.WsvMap_ptr->at("abs_species"), abs_species);
+  auto b1 = ws.borrow(ws.WsvMap_ptr->at("stokes_dim"), stokes_dim);
+  auto b2 = ws.borrow(ws.WsvMap_ptr->at("propmat_clearsky_agenda_checked"),
+                      propmat_clearsky_agenda_checked);
+  auto b3 = ws.borrow(ws.WsvMap_ptr->at("predefined_model_data"),
+                      predefined_model_data);
+  auto b4 = ws.borrow(ws.WsvMap_ptr->at("verbosity"), verbosity);
+
+  // Only Ignore and Touch of the agenda input and output
+  AgendaManip::AgendaCreator empty(ws, "propmat_clearsky_agenda");
+  const Agenda empty_agenda = empty.finalize();
+
+  AgendaManip::AgendaCreator clearsky(ws, "propmat_clearsky_agenda");
+  clearsky.add("propmat_clearskyInit");
+  clearsky.add("propmat_clearskyAddPredefined");
+  const Agenda clearsky_agenda = clearsky.finalize();
+
+  std::cout << "Per call of an agenda with " << empty_agenda.nelem()
+            << " methods: " << time_per_call(ws, empty_agenda) << '\n'
+            << "Per call of an agenda with " << clearsky_agenda.nelem()
+            << " methods: " << time_per_call(ws, clearsky_agenda) << '\n';
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
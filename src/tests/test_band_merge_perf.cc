@@ -0,0 +1,169 @@
+#include "absorptionlines.h"
+#include "artstime.h"
+#include "auto_md.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+//! Sizes of the test, much smaller for a smoke run
+Index NV = 12;
+Index NL = 40;
+
+//! Lines of NV^3 vibrational bands, interleaved as in a frequency-sorted catalog
+std::vector<Absorption::SingleLineExternal> test_lines() {
+  LineShape::Model model(2);
+  model[0].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 20e3, 0.8);
+  model[1].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 15e3, 0.7);
+
+  std::vector<QuantumIdentifier> qids;
+  for (Index v1 = 0; v1 < NV; v1++)
+    for (Index v2 = 0; v2 < NV; v2++)
+      for (Index v3 = 0; v3 < NV; v3++)
+        qids.emplace_back(var_string("H2O-161 v1 ", v1, " 0 v2 ", v2,
+                                     " 0 v3 ", v3, " 0"));
+
+  std::vector<Absorption::SingleLineExternal> lines;
+  const Index nb = Index(qids.size());
+  for (Index i = 0; i < nb * NL; i++) {
+    Absorption::SingleLineExternal sle;
+    sle.bad = false;
+    sle.selfbroadening = true;
+    sle.bathbroadening = true;
+    sle.lineshapetype = LineShape::Type::VP;
+    sle.T0 = 296;
+    sle.quantumidentity = qids[i % nb];
+    sle.species = {Species::Species::Water, Species::Species::Bath};
+    sle.line = Absorption::SingleLine(
+        1e9 + 1e6 * Numeric(i), 1e-20, 1e-20, 1., 3., 1e-14, {}, model, "J 3 2");
+    lines.push_back(sle);
+  }
+  return lines;
+}
+
+//! The search through all bands that the readers did before
+void merge_linear(ArrayOfAbsorptionLines& abs_lines,
+                  const Absorption::SingleLineExternal& sle) {
+  auto band = std::find_if(
+      abs_lines.begin(), abs_lines.end(), [&](const AbsorptionLines& li) {
+        return li.MatchWithExternal(sle, sle.quantumidentity);
+      });
+  if (band not_eq abs_lines.end()) {
+    band->AppendSingleLine(sle.line);
+  } else {
+    abs_lines.emplace_back(sle.selfbroadening,
+                           sle.bathbroadening,
+                           sle.cutoff,
+                           sle.mirroring,
+                           sle.population,
+                           sle.normalization,
+                           sle.lineshapetype,
+                           sle.T0,
+                           sle.cutofffreq,
+                           sle.linemixinglimit,
+                           sle.quantumidentity,
+                           sle.species,
+                           Array<AbsorptionSingleLine>{sle.line});
+  }
+}
+
+void merge_indexed(ArrayOfAbsorptionLines& abs_lines,
+                   Absorption::BandIndex& index,
+                   const Absorption::SingleLineExternal& sle) {
+  if (auto band = index.find(abs_lines, sle, sle.quantumidentity);
+      band not_eq abs_lines.size()) {
+    abs_lines[band].AppendSingleLine(sle.line);
+  } else {
+    abs_lines.emplace_back(sle.selfbroadening,
+                           sle.bathbroadening,
+                           sle.cutoff,
+                           sle.mirroring,
+                           sle.population,
+                           sle.normalization,
+                           sle.lineshapetype,
+                           sle.T0,
+                           sle.cutofffreq,
+                           sle.linemixinglimit,
+                           sle.quantumidentity,
+                           sle.species,
+                           Array<AbsorptionSingleLine>{sle.line});
+    index.add(abs_lines.back(), abs_lines.size() - 1);
+  }
+}
+}  // namespace
+
+//! Usage: test_band_merge_perf [smoke | HITRAN file]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) {
+    NV = 3;
+    NL = 5;
+  }
+
+  const Verbosity verbosity;
+  const std::vector<Absorption::SingleLineExternal> lines = test_lines();
+
+  ArrayOfAbsorptionLines linear;
+  Time start_linear{};
+  for (auto& sle : lines) merge_linear(linear, sle);
+  Time end_linear{};
+
+  ArrayOfAbsorptionLines indexed;
+  Absorption::BandIndex index;
+  Time start_indexed{};
+  for (auto& sle : lines) merge_indexed(indexed, index, sle);
+  Time end_indexed{};
+
+  std::cout << "nlines: " << lines.size() << "; nbands: " << indexed.nelem()
+            << '\n'
+            << "linear search: " << end_linear - start_linear << '\n'
+            << "band index:    " << end_indexed - start_indexed << '\n';
+
+  bool same = linear.nelem() == indexed.nelem();
+  for (Index i = 0; same and i < linear.nelem(); i++)
+    same = linear[i].quantumidentity == indexed[i].quantumidentity and
+           linear[i].NumLines() == indexed[i].NumLines() and
+           std::equal(linear[i].lines.begin(),
+                      linear[i].lines.end(),
+                      indexed[i].lines.begin(),
+                      [](auto& a, auto& b) { return a.F0 == b.F0; });
+  if (not same) {
+    std::cerr << "Indexed merging gives other bands than the linear search\n";
+    return EXIT_FAILURE;
+  }
+
+  // Optionally time reading a HITRAN catalog, e.g., a full H2O or CO2 .par
+  if (argc > 1 and not smoke) {
+    ArrayOfAbsorptionLines abs_lines;
+    Time start_read{};
+    ReadHITRAN(abs_lines,
+               argv[1],
+               -1e99,
+               1e99,
+               "DEFAULT_GLOBAL",
+               "DEFAULT_LOCAL",
+               "Online",
+               "None",
+               "None",
+               "LTE",
+               "VP",
+               "None",
+               750e9,
+               -1,
+               "Parallel",
+               verbosity);
+    Time end_read{};
+    std::cout << argv[1] << ": " << nelem(abs_lines) << " lines in "
+              << abs_lines.nelem() << " bands; ReadHITRAN: "
+              << end_read - start_read << '\n';
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
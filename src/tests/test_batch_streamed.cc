@@ -0,0 +1,112 @@
+#include "agenda_set.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "workspace.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+using AgendaManip::SetWsv;
+
+const String filename = "test_batch_streamed.ybatch";
+
+//! Copy(out, ybatch_index), as the creator cannot add generic methods
+MRecord copy_ybatch_index(Workspace& ws, const char* out) {
+  return MRecord(global_data::MdMap.at("Copy_sg_Index"),
+                 {ws.WsvMap_ptr->at(out)},
+                 {ws.WsvMap_ptr->at("ybatch_index")},
+                 {},
+                 Agenda{ws});
+}
+
+//! The results of a streamed batch of n jobs, as read from file
+ArrayOfVector read_streamed(Index n, ArrayOfMatrix& ybatch_jacobians) {
+  const Verbosity verbosity;
+  ArrayOfVector ybatch;
+  ArrayOfArrayOfVector ybatch_aux;
+  ybatchReadStreamed(
+      ybatch, ybatch_aux, ybatch_jacobians, 0, n, filename, verbosity);
+  return ybatch;
+}
+}  // namespace
+
+int main() try {
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+
+  auto ws_ptr = Workspace::create();
+  Workspace& ws = *ws_ptr;
+
+  // Job i gives i measurements, so job 0 gives no output, and y_aux is
+  // touched by finalize()
+  AgendaManip::AgendaCreator creator(ws, "ybatch_calc_agenda");
+  creator.agenda.push_back(copy_ybatch_index(ws, "nelem"));
+  creator.add("VectorSetConstant",
+              SetWsv("out", "y"),
+              SetWsv("value", Numeric{2.5}));
+  creator.agenda.push_back(copy_ybatch_index(ws, "nrows"));
+  creator.add("IndexSet", SetWsv("out", "ncols"), SetWsv("value", Index{2}));
+  creator.add("MatrixSetConstant",
+              SetWsv("out", "jacobian"),
+              SetWsv("value", Numeric{0.5}));
+  const Agenda ybatch_calc_agenda = creator.finalize();
+
+  // Borrowed after the agenda has added the variables of its values
+  Verbosity verbosity;
+  auto borrowed_verbosity =
+      ws.borrow(ws.WsvMap_ptr->at("verbosity"), verbosity);
+
+  constexpr Index N = 10;
+  ArrayOfVector ybatch_ref;
+  ArrayOfArrayOfVector ybatch_aux_ref;
+  ArrayOfMatrix ybatch_jacobians_ref;
+  ybatchCalc(ws,
+             ybatch_ref,
+             ybatch_aux_ref,
+             ybatch_jacobians_ref,
+             0,
+             N,
+             ybatch_calc_agenda,
+             0,
+             verbosity);
+
+  // An interrupted batch, with the record of job 3 only partly written
+  ybatchCalcStreamed(ws, 0, 3, ybatch_calc_agenda, filename, 0, 1, verbosity);
+  ybatchCalcStreamed(ws, 3, 1, ybatch_calc_agenda, filename, 0, 0, verbosity);
+  std::filesystem::resize_file(filename.c_str(),
+                               std::filesystem::file_size(filename.c_str()) - 8);
+
+  ArrayOfMatrix ybatch_jacobians;
+  if (read_streamed(4, ybatch_jacobians)[3].nelem()) {
+    std::cerr << "The partly written job is read\n";
+    return EXIT_FAILURE;
+  }
+
+  // The resumed batch must run the partly written job again
+  ybatchCalcStreamed(ws, 0, N, ybatch_calc_agenda, filename, 0, 0, verbosity);
+  const ArrayOfVector ybatch = read_streamed(N, ybatch_jacobians);
+  for (Index i = 0; i < N; i++) {
+    if (not(ybatch[i] == ybatch_ref[i]) or
+        not(ybatch_jacobians[i] == ybatch_jacobians_ref[i])) {
+      std::cerr << "Job " << i << " differs from ybatchCalc\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::filesystem::remove(filename.c_str());
+  std::filesystem::remove((filename + ".index").c_str());
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,195 @@
+#include "absorptionlines.h"
+#include "artstime.h"
+#include "auto_md.h"
+#include "xml_io.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+constexpr Index NB = 200;
+constexpr Index NL = 200;
+
+//! J for even bands and N for odd bands, optionally with quantum numbers of
+//! string values, of which some are longer than 8 chars
+Quantum::Number::LocalState local_quanta(Index ib, Index il, bool strings) {
+  const String N = var_string(ib % 2 ? "N " : "J ", il % 20 + 1, ' ', il % 20);
+  if (not strings) return Quantum::Number::LocalState(N);
+  return Quantum::Number::LocalState(
+      N,
+      var_string("parity ", il % 2 ? "+ -" : "- +"),
+      var_string("config 1s2.2s2.2p", il % 6, " 1s2.2s2.2p", il % 5));
+}
+
+ArrayOfAbsorptionLines test_bands(bool strings) {
+  ArrayOfAbsorptionLines bands;
+  for (Index ib = 0; ib < NB; ib++) {
+    Array<Absorption::SingleLine> lines;
+    for (Index il = 0; il < NL; il++) {
+      const Numeric x = std::sin(Numeric(ib * NL + il));
+      LineShape::Model model(2);
+      model[0].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, 20e3 * (1 + 0.1 * x), 0.8);
+      model[0].D0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T5, -1e2 * x, 0.7);
+      model[1].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, 15e3 * (1 - 0.1 * x), 0.7);
+      model[1].D0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T5, 2e2 * x, 0.6);
+      lines.emplace_back(1e9 * Numeric(ib + 1) + 1e6 * Numeric(il),
+                         1e-20 * (2 + x),
+                         1e-20 * (2 - x),
+                         2. * Numeric(il % 5) + 1,
+                         2. * Numeric(il % 7) + 1,
+                         1e-14 * (2 + x),
+                         Zeeman::Model(0.5 * x, 2 * x),
+                         model,
+                         local_quanta(ib, il, strings));
+    }
+
+    bands.emplace_back(true,
+                       true,
+                       Absorption::CutoffType::ByLine,
+                       Absorption::MirroringType::None,
+                       Absorption::PopulationType::LTE,
+                       Absorption::NormalizationType::SFS,
+                       LineShape::Type::VP,
+                       296,
+                       750e9,
+                       -1,
+                       QuantumIdentifier(var_string("H2O-161 v1 ", ib % 4,
+                                                    " 0 v2 ", ib / 4, " 0")),
+                       ArrayOfSpecies{Species::Species::Water,
+                                      Species::Species::Bath},
+                       lines);
+  }
+  return bands;
+}
+
+//! Equal, or both not a number
+bool same(Numeric a, Numeric b) {
+  return a == b or (std::isnan(a) and std::isnan(b));
+}
+
+bool same(const AbsorptionLines& a, const AbsorptionLines& b) {
+  if (not a.Match(b).first or a.quantumidentity not_eq b.quantumidentity or
+      a.NumLines() not_eq b.NumLines() or a.cutofffreq not_eq b.cutofffreq or
+      a.normalization not_eq b.normalization)
+    return false;
+
+  for (Index i = 0; i < a.NumLines(); i++) {
+    auto& x = a.lines[i];
+    auto& y = b.lines[i];
+    if (not(x.F0 == y.F0 and x.I0 == y.I0 and x.E0 == y.E0 and
+            x.glow == y.glow and x.gupp == y.gupp and x.A == y.A and
+            same(x.zeeman.gu(), y.zeeman.gu()) and
+            same(x.zeeman.gl(), y.zeeman.gl()) and
+            x.localquanta == y.localquanta))
+      return false;
+
+    for (Index j = 0; j < a.NumBroadeners(); j++) {
+      for (Index v = 0; v < LineShape::nVars; v++) {
+        auto p = x.lineshape[j].Get(LineShape::Variable(v));
+        auto q = y.lineshape[j].Get(LineShape::Variable(v));
+        if (not(p.type == q.type and same(p.X0, q.X0) and
+                same(p.X1, q.X1) and same(p.X2, q.X2) and same(p.X3, q.X3)))
+          return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace
+
+int main() try {
+  const Verbosity verbosity;
+  const ArrayOfAbsorptionLines bands = test_bands(false);
+
+  const String xml_ascii = "test_binary_catalog.ascii.xml";
+  const String xml_binary = "test_binary_catalog.binary.xml";
+  const String columnar = "test_binary_catalog.lines";
+  xml_write_to_file(xml_ascii, bands, FILE_TYPE_ASCII, 0, verbosity);
+  xml_write_to_file(xml_binary, bands, FILE_TYPE_BINARY, 0, verbosity);
+  Absorption::WriteBinaryCatalog(columnar, bands);
+
+  ArrayOfAbsorptionLines from_ascii, from_binary;
+  Time start_ascii{};
+  xml_read_from_file(xml_ascii, from_ascii, verbosity);
+  Time end_ascii{};
+  xml_read_from_file(xml_binary, from_binary, verbosity);
+  Time end_binary{};
+  const ArrayOfAbsorptionLines from_columnar =
+      Absorption::ReadBinaryCatalog(columnar);
+  Time end_columnar{};
+
+  std::remove(xml_ascii.c_str());
+  std::remove(xml_binary.c_str());
+  std::remove((xml_binary + ".bin").c_str());
+  std::remove(columnar.c_str());
+
+  std::cout << "nbands: " << NB << "; nlines: " << NB * NL << '\n'
+            << "XML ascii:      " << end_ascii - start_ascii << '\n'
+            << "XML binary:     " << end_binary - end_ascii << '\n'
+            << "binary catalog: " << end_columnar - end_binary << '\n';
+
+  bool ok = from_columnar.nelem() == bands.nelem() and
+            from_ascii.nelem() == bands.nelem();
+  for (Index i = 0; ok and i < bands.nelem(); i++)
+    ok = same(bands[i], from_columnar[i]) and
+         same(from_binary[i], from_columnar[i]);
+  if (not ok) {
+    std::cerr << "The binary catalog differs from the written bands\n";
+    return EXIT_FAILURE;
+  }
+
+  // Quantum numbers of string values, which the XML catalogs do not take
+  const ArrayOfAbsorptionLines string_bands = test_bands(true);
+  Absorption::WriteBinaryCatalog(columnar, string_bands);
+  const ArrayOfAbsorptionLines from_strings =
+      Absorption::ReadBinaryCatalog(columnar);
+  std::remove(columnar.c_str());
+
+  ok = from_strings.nelem() == string_bands.nelem();
+  for (Index i = 0; ok and i < string_bands.nelem(); i++)
+    ok = same(string_bands[i], from_strings[i]);
+  if (not ok) {
+    std::cerr << "The binary catalog changes quantum numbers of strings\n";
+    return EXIT_FAILURE;
+  }
+
+  // The binary file of a split catalog is read only if it is not older than
+  // the XML file of the same species
+  const String split = "test_binary_catalog";
+  const String split_binary = split + ".H2O-161.lines";
+  const String split_xml = split + ".H2O-161.xml";
+  const ArrayOfAbsorptionLines xml_bands{bands[0], bands[1]};
+  const ArrayOfAbsorptionLines binary_bands{bands[2], bands[3], bands[4]};
+  abs_linesWriteSpeciesSplitCatalog("ascii", xml_bands, split, verbosity);
+  abs_linesWriteSpeciesSplitCatalog("columnar", binary_bands, split, verbosity);
+
+  const auto xml_time = std::filesystem::last_write_time(split_xml.c_str());
+  ArrayOfAbsorptionLines from_stale, from_fresh;
+  std::filesystem::last_write_time(split_binary.c_str(),
+                                   xml_time - std::chrono::hours(1));
+  abs_linesReadSpeciesSplitCatalog(from_stale, split, 0, verbosity);
+  std::filesystem::last_write_time(split_binary.c_str(),
+                                   xml_time + std::chrono::hours(1));
+  abs_linesReadSpeciesSplitCatalog(from_fresh, split, 0, verbosity);
+  std::remove(split_binary.c_str());
+  std::remove(split_xml.c_str());
+
+  if (from_stale.nelem() not_eq xml_bands.nelem() or
+      from_fresh.nelem() not_eq binary_bands.nelem()) {
+    std::cerr << "The wrong file of the split catalog is read\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if not ARTS_LGPL
+extern "C" {
+#include "cdisort.h"
+}
+
+namespace {
+constexpr int NCASE = 48;
+constexpr int NTHREAD = 8;
+
+/** Intensities of a scattering and emitting atmosphere, for case icase
+
+    The layers get thicker and scatter more forward with icase.
+ */
+std::vector<double> intensities(int icase) {
+  disort_state ds;
+  disort_output out;
+
+  ds.accur = 0.;
+  for (auto& prnt : ds.flag.prnt) prnt = FALSE;
+  ds.flag.ibcnd = GENERAL_BC;
+  ds.flag.usrtau = FALSE;
+  ds.flag.usrang = TRUE;
+  ds.flag.lamber = TRUE;
+  ds.flag.planck = TRUE;
+  ds.flag.onlyfl = FALSE;
+  ds.flag.quiet = TRUE;
+  ds.flag.spher = FALSE;
+  ds.flag.general_source = FALSE;
+  ds.flag.output_uum = FALSE;
+  ds.flag.intensity_correction = FALSE;
+  ds.flag.old_intensity_correction = FALSE;
+  ds.flag.brdf_type = BRDF_NONE;
+
+  ds.nlyr = 6;
+  ds.nstr = 16;
+  ds.nphase = ds.nstr;
+  ds.nmom = ds.nstr;
+  ds.numu = 4;
+  ds.nphi = 2;
+
+  c_disort_state_alloc(&ds);
+  c_disort_out_alloc(&ds, &out);
+
+  const double umu[] = {-0.9, -0.3, 0.3, 0.9};
+  for (int i = 0; i < ds.numu; i++) ds.umu[i] = umu[i];
+  ds.phi[0] = 0;
+  ds.phi[1] = 90;
+
+  for (int lc = 0; lc < ds.nlyr; lc++) {
+    ds.dtauc[lc] = 0.05 * (1 + lc) * (1 + icase % 7);
+    ds.ssalb[lc] = 0.5 + 0.4 * std::sin(lc + icase) * std::sin(lc + icase);
+    c_getmom(HENYEY_GREENSTEIN,
+             0.1 + 0.8 * icase / NCASE,
+             ds.nmom,
+             ds.pmom + lc * (ds.nmom_nstr + 1));
+  }
+  for (int lev = 0; lev <= ds.nlyr; lev++) ds.temper[lev] = 210 + 10 * lev;
+
+  ds.wvnmlo = 5 + icase;
+  ds.wvnmhi = 6 + icase;
+  ds.bc.umu0 = 0.6;
+  ds.bc.phi0 = 0;
+  ds.bc.fbeam = 1;
+  ds.bc.fisot = 0;
+  ds.bc.fluor = 0;
+  ds.bc.albedo = 0.1;
+  ds.bc.btemp = 280;
+  ds.bc.ttemp = 2.7;
+  ds.bc.temis = 1;
+
+  c_disort(&ds, &out);
+
+  std::vector<double> uu(out.uu, out.uu + ds.numu * ds.ntau * ds.nphi);
+
+  c_disort_out_free(&ds, &out);
+  c_disort_state_free(&ds);
+  return uu;
+}
+}  // namespace
+
+int main() try {
+  // All threads start at the same time, so that the lazily initialized
+  // state of cdisort is set up by all of them at once
+  std::vector<std::vector<std::vector<double>>> threaded(
+      NTHREAD, std::vector<std::vector<double>>(NCASE));
+  std::vector<std::thread> threads;
+  for (int ithread = 0; ithread < NTHREAD; ithread++)
+    threads.emplace_back([&threaded, ithread]() {
+      for (int i = 0; i < NCASE; i++) {
+        const int icase = (i + ithread * NCASE / NTHREAD) % NCASE;
+        threaded[ithread][icase] = intensities(icase);
+      }
+    });
+  for (auto& thread : threads) thread.join();
+
+  for (int icase = 0; icase < NCASE; icase++) {
+    const std::vector<double> serial = intensities(icase);
+    for (int ithread = 0; ithread < NTHREAD; ithread++) {
+      if (threaded[ithread][icase] != serial) {
+        std::cerr << "Thread " << ithread << " differs from the serial "
+                  << "result for case " << icase << '\n';
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::cout << NTHREAD << " threads reproduce " << NCASE
+            << " serial DISORT calculations\n";
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
+#else
+int main() { return EXIT_SUCCESS; }
+#endif
@@ -0,0 +1,124 @@
+#include "artstime.h"
+#include "doit.h"
+#include "matpack_math.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+constexpr Index N = 300;
+constexpr Index NFIXED = 10;
+
+/** A model of the DOIT update, x -> M x + c
+
+    M scatters with the single scattering albedo into all other points,
+    with more weight on the neighbours. As at the cloudbox boundary, the
+    last NFIXED values are not changed by the update.
+ */
+struct Update {
+  Matrix M;
+  Vector c;
+
+  explicit Update(Numeric albedo) : M(N, N, 0), c(N) {
+    for (Index i = 0; i < N - NFIXED; i++) {
+      Numeric sum = 0;
+      for (Index j = 0; j < N; j++) {
+        M(i, j) = 1 / (1 + std::abs(Numeric(i - j))) + 0.1 * std::sin(i + j);
+        M(i, j) = std::abs(M(i, j));
+        sum += M(i, j);
+      }
+      for (Index j = 0; j < N; j++) M(i, j) *= albedo / sum;
+      c[i] = 1 + std::cos(Numeric(i));
+    }
+    for (Index i = N - NFIXED; i < N; i++) M(i, i) = 1, c[i] = 0;
+  }
+
+  Vector operator()(ConstVectorView x) const {
+    Vector y(N);
+    mult(y, M, x);
+    y += c;
+    return y;
+  }
+};
+
+Numeric max_abs_diff(ConstVectorView a, ConstVectorView b) {
+  Numeric diff = 0;
+  for (Index i = 0; i < a.nelem(); i++)
+    diff = std::max(diff, std::abs(a[i] - b[i]));
+  return diff;
+}
+}  // namespace
+
+int main() {
+  constexpr Numeric EPSILON = 1e-8;
+
+  for (Numeric albedo : {0.5, 0.9, 0.99, 0.999}) {
+    const Update update(albedo);
+
+    Vector start(N, 0);
+    for (Index i = N - NFIXED; i < N; i++) start[i] = Numeric(2 + i % 3);
+
+    // Source iteration, until the update changes nothing
+    Vector x = start;
+    Index niterations = 0;
+    const Time start_source{};
+    for (;;) {
+      const Vector y = update(x);
+      niterations++;
+      const Numeric change = max_abs_diff(x, y);
+      x = y;
+      if (change < EPSILON) break;
+    }
+    const Time end_source{};
+    std::cout << "albedo: " << albedo << "; source iteration: " << niterations
+              << " updates, " << end_source - start_source;
+
+    for (auto solver : {Options::DoitSolver::GMRES,
+                        Options::DoitSolver::BiCGSTAB}) {
+      // As cloudbox_field_monoIterate, solve for the step to the fixed point
+      const Vector updated = update(start);
+      Vector residual = updated;
+      residual -= start;
+      const auto apply = [&](VectorView out, ConstVectorView v) {
+        Vector perturbed = start;
+        perturbed += v;
+        const Vector y = update(perturbed);
+        for (Index i = 0; i < N; i++) out[i] = v[i] - (y[i] - updated[i]);
+      };
+
+      Vector step(N, 0);
+      const Time start_solver{};
+      const Index napply = doit_krylov_solve(
+          step, residual, apply, solver, 100, 1e-12, 1000);
+      Vector solution = start;
+      solution += step;
+      const Time end_solver{};
+
+      std::cout << "; " << solver << ": " << napply + 1 << " updates, "
+                << end_solver - start_solver;
+
+      const Numeric diff = max_abs_diff(solution, x);
+      if (diff > 10 * EPSILON / (1 - albedo)) {
+        std::cerr << '\n'
+                  << solver << " differs by " << diff
+                  << " from source iteration\n";
+        return EXIT_FAILURE;
+      }
+      if (max_abs_diff(solution[Range(N - NFIXED, NFIXED)],
+                       start[Range(N - NFIXED, NFIXED)]) not_eq 0) {
+        std::cerr << '\n' << solver << " changes the fixed values\n";
+        return EXIT_FAILURE;
+      }
+      if (albedo > 0.95 and napply + 1 >= niterations) {
+        std::cerr << '\n'
+                  << solver << " needs " << napply + 1
+                  << " updates, source iteration " << niterations << '\n';
+        return EXIT_FAILURE;
+      }
+    }
+    std::cout << '\n';
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+#include "doit.h"
+#include "math_funcs.h"
+#include "matpack_math.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+/** The scattering integral as the point loop of doit_scat_fieldCalc did it,
+    by integrating the product of phase matrix and field for each direction
+ */
+Matrix product_integral(ConstTensor5View pha_mat,
+                        ConstMatrixView field,
+                        const Vector& za_grid,
+                        const Vector& aa_grid) {
+  const Index nza = za_grid.nelem();
+  const Index naa = aa_grid.nelem();
+  const Index stokes_dim = field.ncols();
+
+  Matrix scat_field(pha_mat.nshelves(), stokes_dim);
+  Tensor3 product_field(nza, naa, stokes_dim);
+  for (Index za_out = 0; za_out < pha_mat.nshelves(); za_out++) {
+    product_field = 0;
+    for (Index za_in = 0; za_in < nza; za_in++)
+      for (Index aa_in = 0; aa_in < naa; aa_in++)
+        for (Index i = 0; i < stokes_dim; i++)
+          for (Index j = 0; j < stokes_dim; j++)
+            product_field(za_in, aa_in, i) +=
+                pha_mat(za_out, za_in, aa_in, i, j) * field(za_in, j);
+
+    for (Index i = 0; i < stokes_dim; i++)
+      scat_field(za_out, i) =
+          naa == 1 ? AngIntegrate_trapezoid(product_field(joker, 0, i),
+                                            za_grid) /
+                         (2 * Constant::pi)
+                   : AngIntegrate_trapezoid(
+                         product_field(joker, joker, i), za_grid, aa_grid);
+  }
+  return scat_field;
+}
+
+//! Largest difference relative to the largest value
+Numeric max_rel_diff(const Matrix& a, const Matrix& b) {
+  Numeric diff = 0, scale = 0;
+  for (Index i = 0; i < a.nrows(); i++) {
+    for (Index j = 0; j < a.ncols(); j++) {
+      diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+      scale = std::max(scale, std::abs(b(i, j)));
+    }
+  }
+  return diff / scale;
+}
+}  // namespace
+
+int main() {
+  constexpr Index NZA = 19;
+  constexpr Index STOKES_DIM = 4;
+
+  const Vector za_grid = uniform_grid(0, NZA, 10);
+  // Not equidistant, to test the weights of each step
+  const Vector za_grid_uneven{0,  5,  15, 30, 45, 60,  75,  85,  89,  91,
+                              95, 105, 120, 135, 150, 165, 170, 175, 180};
+
+  for (auto& grid : {za_grid, za_grid_uneven}) {
+    for (Index naa : {1, 7}) {
+      const Vector aa_grid =
+          naa == 1 ? Vector(1, 0) : uniform_grid(0, naa, 60);
+
+      Tensor5 pha_mat(NZA, NZA, naa, STOKES_DIM, STOKES_DIM);
+      Matrix field(NZA, STOKES_DIM);
+      Index n = 0;
+      for (auto x = pha_mat.elem_begin(); x != pha_mat.elem_end(); ++x)
+        *x = std::sin(Numeric(++n));
+      for (auto x = field.elem_begin(); x != field.elem_end(); ++x)
+        *x = 1 + std::cos(Numeric(++n));
+
+      Matrix weights;
+      doit_scat_field_weights(weights, grid, aa_grid);
+      Matrix scat_field(NZA, STOKES_DIM);
+      doit_scat_field_1D(scat_field, pha_mat, field, weights);
+
+      const Numeric rel_diff = max_rel_diff(
+          scat_field, product_integral(pha_mat, field, grid, aa_grid));
+      std::cout << "naa: " << naa << "; relative difference: " << rel_diff
+                << '\n';
+      if (rel_diff > 1e-12) {
+        std::cerr << "The weighted sum differs from the integral\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
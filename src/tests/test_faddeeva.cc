@@ -0,0 +1,70 @@
+#include "artstime.h"
+#include "faddeeva_weideman.h"
+#include "matpack_data.h"
+#include "matpack_math.h"
+
+#include <Faddeeva/Faddeeva.hh>
+
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+//! The stated relative accuracy of Weideman::w
+constexpr Numeric relacc = 1e-12;
+
+ComplexVector test_points() {
+  const Vector xs = uniform_grid(-50, 2001, 0.05);
+  const Vector ys{0, 1e-12, 1e-6, 1e-3, 1e-2, 0.1, 0.5, 1, 2, 5, 10, 50, 1e3};
+
+  // Line wings, where the continued fraction is used
+  const Vector wings{-1e6, -1e4, -300, -60, 49.9, 50.1, 100, 1e3, 1e5, 1e7};
+
+  ComplexVector z(2 * (xs.nelem() + wings.nelem()) * ys.nelem());
+  Index i = 0;
+  for (auto y : ys) {
+    for (auto x : xs) {
+      z[i++] = Complex(x, y);
+      z[i++] = Complex(x, -y / 100);  // Lower half-plane close to the axis
+    }
+    for (auto x : wings) {
+      z[i++] = Complex(x, y);
+      z[i++] = Complex(x, -y / 100);
+    }
+  }
+  return z;
+}
+}  // namespace
+
+int main() {
+  const ComplexVector z = test_points();
+  const Index n = z.nelem();
+
+  ComplexVector ref(n), scalar(n), block(n);
+
+  Time start{};
+  for (Index i = 0; i < n; i++) ref[i] = Faddeeva::w(z[i]);
+  Time mid{};
+  for (Index i = 0; i < n; i++) scalar[i] = Weideman::w(z[i]);
+  Time end{};
+  Weideman::w(block, z);
+  Time final{};
+
+  Numeric max_err = 0;
+  for (Index i = 0; i < n; i++) {
+    const Numeric a = std::abs(ref[i]);
+    max_err = std::max(max_err, std::abs(scalar[i] - ref[i]) / a);
+    max_err = std::max(max_err, std::abs(block[i] - ref[i]) / a);
+  }
+
+  std::cout << "Points: " << n << '\n'
+            << "Faddeeva::w:             " << mid - start << '\n'
+            << "Weideman::w (scalar):    " << end - mid << '\n'
+            << "Weideman::w (block):     " << final - end << '\n'
+            << "Max relative difference: " << max_err << '\n';
+
+  if (max_err > relacc) {
+    std::cerr << "Relative difference larger than " << relacc << '\n';
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+#include "gas_abs_lookup.h"
+#include "matpack_data.h"
+#include "xml_io.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+GasAbsLookup test_table() {
+  GasAbsLookup gal;
+
+  gal.Species() = {ArrayOfSpeciesTag("H2O"),
+                   ArrayOfSpeciesTag("O2"),
+                   ArrayOfSpeciesTag("N2")};
+  gal.NonLinearSpecies() = ArrayOfIndex{0};
+  gal.Fgrid() = uniform_grid(100e9, 50, 1e9);
+  gal.Pgrid() = {1e5, 5e4, 1e4, 1e3, 1e2};
+  gal.VMRs() = Matrix(3, 5, 0.0);
+  gal.VMRs()(0, joker) = 1e-2;
+  gal.VMRs()(1, joker) = 0.21;
+  gal.VMRs()(2, joker) = 0.78;
+  gal.Tref() = {290, 260, 230, 220, 240};
+  gal.Tpert() = {-20, -10, 0, 10, 20};
+  gal.NLSPert() = {0, 0.5, 1, 2, 10};
+
+  Tensor4& xsec = gal.Xsec();
+  xsec.resize(5, 3 + 4, 50, 5);
+  for (Index a = 0; a < xsec.nbooks(); a++)
+    for (Index b = 0; b < xsec.npages(); b++)
+      for (Index c = 0; c < xsec.nrows(); c++)
+        for (Index d = 0; d < xsec.ncols(); d++)
+          xsec(a, b, c, d) =
+              1e-25 * Numeric(1 + a + 2 * b + 3 * c) / Numeric(1 + d);
+
+  return gal;
+}
+
+//! Relative difference of the extracted absorption of two adapted tables
+Numeric extract_difference(const GasAbsLookup& a,
+                           const GasAbsLookup& b,
+                           const Vector& f_grid,
+                           const Vector& vmrs) {
+  Matrix sga_a, sga_b;
+  a.Extract(sga_a, {}, 1, 1, 1, 0, 3e4, 240, vmrs, f_grid, 0.5);
+  b.Extract(sga_b, {}, 1, 1, 1, 0, 3e4, 240, vmrs, f_grid, 0.5);
+
+  Numeric max_err = 0;
+  for (Index i = 0; i < sga_a.nrows(); i++)
+    for (Index j = 0; j < sga_a.ncols(); j++)
+      max_err = std::max(max_err,
+                         std::abs(sga_a(i, j) - sga_b(i, j)) / sga_a(i, j));
+  return max_err;
+}
+}  // namespace
+
+int main() try {
+  const Verbosity verbosity;
+  const String filename = "test_gas_abs_lookup.xml";
+
+  GasAbsLookup ref = test_table();
+  ref.WriteMapped(filename, verbosity);
+
+  GasAbsLookup mapped;
+  mapped.ReadMapped(filename, verbosity);
+
+  // The mapped data is the written data
+  if (not(mapped.XsecView() == ref.Xsec())) {
+    std::cerr << "Mapped cross sections differ from the written ones\n";
+    return EXIT_FAILURE;
+  }
+
+  // Adapting to the full table keeps the mapping, to a part copies it
+  const ArrayOfArrayOfSpeciesTag all_species = ref.Species();
+  const Vector f_grid = ref.Fgrid();
+  GasAbsLookup mapped_part = mapped;
+  GasAbsLookup ref_part = ref;
+
+  ref.Adapt(all_species, f_grid, verbosity);
+  mapped.Adapt(all_species, f_grid, verbosity);
+  const Numeric err_full =
+      extract_difference(ref, mapped, f_grid, {1e-2, 0.21, 0.78});
+
+  const ArrayOfArrayOfSpeciesTag part_species{all_species[2], all_species[0]};
+  const Vector part_f_grid{f_grid[Range(10, 20)]};
+  ref_part.Adapt(part_species, part_f_grid, verbosity);
+  mapped_part.Adapt(part_species, part_f_grid, verbosity);
+  const Numeric err_part =
+      extract_difference(ref_part, mapped_part, part_f_grid, {0.78, 1e-2});
+
+  std::remove(filename.c_str());
+  std::remove((filename + ".xsec").c_str());
+
+  std::cout << "Full table difference:    " << err_full << '\n'
+            << "Adapted table difference: " << err_part << '\n';
+
+  if (err_full not_eq 0 or err_part not_eq 0) {
+    std::cerr << "Mapped and in-memory tables differ\n";
+    return EXIT_FAILURE;
+  }
+
+  // Single precision storage, also after a round trip through a binary file
+  GasAbsLookup single = test_table();
+  single.SetStorage(Options::LookupStorage::Float);
+  xml_write_to_file(filename, single, FILE_TYPE_BINARY, 0, verbosity);
+  GasAbsLookup single_read;
+  xml_read_from_file(filename, single_read, verbosity);
+  std::remove(filename.c_str());
+  std::remove((filename + ".bin").c_str());
+
+  if (single_read.Storage() not_eq Options::LookupStorage::Float or
+      not(single_read.XsecCopy() == single.XsecCopy())) {
+    std::cerr << "Single precision table changed when written to file\n";
+    return EXIT_FAILURE;
+  }
+
+  GasAbsLookup full = test_table();
+  full.Adapt(all_species, f_grid, verbosity);
+  single_read.Adapt(all_species, f_grid, verbosity);
+  const Numeric err_single =
+      extract_difference(full, single_read, f_grid, {1e-2, 0.21, 0.78});
+
+  std::cout << "Single precision difference: " << err_single << '\n';
+
+  if (err_single > 1e-6) {
+    std::cerr << "Single precision table out of tolerance\n";
+    return EXIT_FAILURE;
+  }
+
+  // The cross sections in double precision are only given explicitly
+  try {
+    single_read.Xsec();
+    std::cerr << "Single precision table converted implicitly\n";
+    return EXIT_FAILURE;
+  } catch (std::runtime_error&) {
+  }
+  single_read.SetStorage(Options::LookupStorage::Double);
+  if (not(single_read.Xsec() == single.XsecCopy())) {
+    std::cerr << "Single precision table changed by the conversion\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,146 @@
+#include "absorptionlines.h"
+#include "artstime.h"
+#include "auto_md.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+namespace {
+constexpr Index NL = 50'000;
+
+//! Writes a catalog of H2O lines in the HITRAN 2004 format
+void write_catalog(const String& filename) {
+  std::ofstream os(filename);
+  std::array<char, 200> buf{};
+  for (Index i = 0; i < NL; i++) {
+    const double x = std::sin(Numeric(i));
+    std::snprintf(buf.data(),
+                  buf.size(),
+                  "%2d%1c%12.6f%10.3e%10.3e%5.4f%5.3f%10.4f%4.2f%8.6f"
+                  "%15s%15s%15s%15s%6s%12s%1s%7.1f%7.1f",
+                  1,
+                  i % 3 == 0 ? '1' : '2',
+                  10 + 1e-3 * double(i),
+                  1e-22 * (2 + x),
+                  1e-2 * (2 + x),
+                  0.07 + 0.01 * x,
+                  0.3 + 0.1 * x,
+                  100 * (2 + x),
+                  0.7,
+                  -0.001 * x,
+                  "0 0 0",
+                  "0 0 0",
+                  "3 2 1",
+                  "4 2 2",
+                  "444444",
+                  "  1  1  1  1",
+                  " ",
+                  7.0,
+                  9.0);
+    os << buf.data() << (i % 7 == 0 ? "\r\n" : "\n");
+  }
+}
+
+//! The number of lines, or the error, of ReadHITRAN
+String read_hitran(const String& filename,
+                   Numeric fmax,
+                   const String& hitran_reading) try {
+  ArrayOfAbsorptionLines abs_lines;
+  ReadHITRAN(abs_lines,
+             filename,
+             -1e99,
+             fmax,
+             "DEFAULT_GLOBAL",
+             "DEFAULT_LOCAL",
+             "Post2004",
+             "None",
+             "None",
+             "LTE",
+             "VP",
+             "None",
+             750e9,
+             -1,
+             hitran_reading,
+             Verbosity{});
+  Index n = 0;
+  for (auto& band : abs_lines) n += band.NumLines();
+  return var_string(n, " lines");
+} catch (std::exception& e) {
+  // The message, without where it was thrown
+  const std::string_view what = e.what();
+  return String(what.substr(std::min(what.find("Cannot read"), what.size())));
+}
+}  // namespace
+
+int main() try {
+  const String filename = "test_hitran_reading.par";
+  write_catalog(filename);
+
+  Time start_stream{};
+  std::vector<Absorption::SingleLineExternal> stream;
+  {
+    std::ifstream is(filename);
+    for (;;) {
+      auto sline = Absorption::ReadFromHitran2004Stream(is);
+      if (sline.bad) break;
+      stream.push_back(sline);
+    }
+  }
+  Time end_stream{};
+
+  Time start_parallel{};
+  const std::vector<Absorption::SingleLineExternal> parallel =
+      Absorption::ReadFromHitranFile(filename,
+                                     Absorption::ReadFromHitran2004Line,
+                                     std::numeric_limits<Numeric>::infinity());
+  Time end_parallel{};
+
+  std::cout << "nlines: " << NL << "; stream: " << end_stream - start_stream
+            << "; parallel: " << end_parallel - start_parallel << '\n';
+
+  bool same = Index(stream.size()) == NL and parallel.size() == stream.size();
+  for (std::size_t i = 0; same and i < stream.size(); i++) {
+    auto& a = stream[i];
+    auto& b = parallel[i];
+    same = a.quantumidentity == b.quantumidentity and
+           a.line.F0 == b.line.F0 and a.line.I0 == b.line.I0 and
+           a.line.E0 == b.line.E0 and a.line.A == b.line.A and
+           a.line.gupp == b.line.gupp and a.line.glow == b.line.glow and
+           a.line.lineshape.Match(b.line.lineshape).first;
+  }
+
+  if (not same) {
+    std::cerr << "Parallel reading gives other lines than streaming\n";
+    return EXIT_FAILURE;
+  }
+
+  // An empty line is bad, but only if it is read before the first line
+  // above fmax, and both ways of reading report it by its line number
+  std::ofstream(filename, std::ios::app) << "\n" << "bad line\n";
+  const Numeric fmax = stream[NL / 2].line.F0;
+  const String bad = var_string("Cannot read line ", NL + 1, " of ");
+  for (Numeric f : {fmax, std::numeric_limits<Numeric>::infinity()}) {
+    const String from_stream = read_hitran(filename, f, "Stream");
+    const String from_parallel = read_hitran(filename, f, "Parallel");
+    if (from_stream not_eq from_parallel or
+        (f == fmax and from_stream not_eq var_string(NL / 2 + 1, " lines")) or
+        (f not_eq fmax and from_stream.find(bad) not_eq 0)) {
+      std::cerr << "Parallel reading does not end as streaming:\n"
+                << from_stream << "\n" << from_parallel << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+  std::remove(filename.c_str());
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+#include "absorptionlines.h"
+#include "lineshape.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+//! A band of nl lines, differing from other bands by f0
+AbsorptionLines test_band(Index nl, Numeric f0) {
+  LineShape::Model model(2);
+  model[0].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, f0, 0.8);
+  model[1].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 15e3, 0.7);
+
+  const QuantumIdentifier qid("H2O-161 J 3 2");
+  Array<Absorption::SingleLine> lines;
+  for (Index i = 0; i < nl; i++) {
+    lines.emplace_back(Absorption::SingleLine(f0 + 1e9 * Numeric(i),
+                                              1e-20,
+                                              1e-20,
+                                              1.,
+                                              3.,
+                                              1e-14,
+                                              Zeeman::Model(),
+                                              model,
+                                              "J 3 2"));
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         Absorption::CutoffType::None,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::LTE,
+                         Absorption::NormalizationType::None,
+                         LineShape::Type::VP,
+                         296,
+                         -1,
+                         -1,
+                         qid,
+                         {Species::Species::Water, Species::Species::Bath},
+                         lines);
+}
+
+//! The number of bytes of the caches borrowed one after the other
+Index borrowed_bytes(const AbsorptionLines& band) {
+  LineShape::KernelCachePool::Lease kernels;
+  const Index n = kernels->nbytes();
+  kernels->kernel(band, 0);
+  return n;
+}
+}  // namespace
+
+int main() try {
+  const AbsorptionLines band = test_band(100, 100e9);
+  const Vector vmrs{0.01, 0.99};
+
+  // The kernels are kept by a calculation and not beyond it
+  if (borrowed_bytes(band) or borrowed_bytes(band)) {
+    std::cerr << "Kernels are kept without a scope\n";
+    return EXIT_FAILURE;
+  }
+  {
+    const LineShape::KernelCachePool::Scope scope;
+    if (borrowed_bytes(band) or not borrowed_bytes(band)) {
+      std::cerr << "Kernels are not kept by the scope\n";
+      return EXIT_FAILURE;
+    }
+  }
+  {
+    const LineShape::KernelCachePool::Scope scope;
+    if (borrowed_bytes(band)) {
+      std::cerr << "Kernels are kept after the scope\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The kernels of the cache give the shape parameters of the band
+  LineShape::KernelCache cache;
+  Matrix X, Xref;
+  for (Numeric T : {250., 260., 250.}) {
+    cache.kernel(band, 0).ShapeParameters(X, T, 1e4, vmrs);
+    LineShape::BandKernel(band).ShapeParameters(Xref, T, 1e4, vmrs);
+    if (not(X == Xref)) {
+      std::cerr << "Wrong shape parameters from the cache\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Many large bands never make the cache much larger than its limit
+  Index max_bytes = 0;
+  for (Index i = 0; i < 40; i++) {
+    const AbsorptionLines large = test_band(10'000, 100e9 + Numeric(i));
+    cache.kernel(large, 0).ShapeParameters(X, 250, 1e4, vmrs);
+    max_bytes = std::max(max_bytes, cache.nbytes());
+  }
+  std::cout << "Largest cache: " << Numeric(max_bytes) / 1e6 << " MB\n";
+  if (max_bytes > LineShape::KernelCache::max_bytes +
+                      LineShape::BandKernel(test_band(10'000, 0)).nbytes() +
+                      Index(sizeof(Numeric)) * X.size()) {
+    std::cerr << "The cache grows beyond its limit\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,140 @@
+#include "absorptionlines.h"
+#include "auto_md.h"
+#include "jacobian.h"
+#include "matpack_data.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+constexpr Index NF = 1001;
+constexpr Index NL = 20;
+
+AbsorptionLines test_band(Numeric f0) {
+  LineShape::Model model(2);
+  model[0].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 20e3, 0.8);
+  model[1].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 15e3, 0.7);
+
+  const QuantumIdentifier qid("H2O-161 J 3 2");
+  Array<Absorption::SingleLine> lines;
+  for (Index i = 0; i < NL; i++) {
+    lines.emplace_back(Absorption::SingleLine(f0 + 5e9 * Numeric(i),
+                                              1e-20,
+                                              1e-20,
+                                              1.,
+                                              3.,
+                                              1e-14,
+                                              Zeeman::Model(),
+                                              model,
+                                              "J 3 2"));
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         Absorption::CutoffType::ByLine,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::LTE,
+                         Absorption::NormalizationType::None,
+                         LineShape::Type::VP,
+                         296,
+                         25e9,
+                         -1,
+                         qid,
+                         {Species::Species::Water, Species::Species::Bath},
+                         lines);
+}
+
+struct Result {
+  PropagationMatrix propmat_clearsky{NF};
+  StokesVector nlte_source{NF};
+  ArrayOfPropagationMatrix dpropmat_clearsky_dx;
+  ArrayOfStokesVector dnlte_source_dx;
+};
+
+Result compute(const String& parallel_option) {
+  const Verbosity verbosity;
+
+  const Vector f_grid = uniform_grid(50e9, NF, 200e9 / Numeric(NF - 1));
+  const ArrayOfArrayOfSpeciesTag abs_species{ArrayOfSpeciesTag("H2O-161")};
+  const ArrayOfArrayOfAbsorptionLines abs_lines_per_species{
+      {test_band(60e9), test_band(62.5e9), test_band(150e9)}};
+
+  ArrayOfRetrievalQuantity jacobian_quantities(2);
+  jacobian_quantities[0].Target(
+      Jacobian::Target(Jacobian::Atm::Temperature));
+  jacobian_quantities[1].Target(Jacobian::Target(Jacobian::Atm::WindU));
+
+  Result r;
+  r.dpropmat_clearsky_dx =
+      ArrayOfPropagationMatrix(2, PropagationMatrix(NF));
+  propmat_clearskyAddLines(r.propmat_clearsky,
+                           r.nlte_source,
+                           r.dpropmat_clearsky_dx,
+                           r.dnlte_source_dx,
+                           f_grid,
+                           abs_species,
+                           {},
+                           jacobian_quantities,
+                           abs_lines_per_species,
+                           Species::isotopologue_ratiosInitFromBuiltin(),
+                           1e4,
+                           250,
+                           EnergyLevelMap{},
+                           Vector{0.01},
+                           0,
+                           1,
+                           0,
+                           0,
+                           "None",
+                           1,
+                           parallel_option,
+                           "Reference",
+                           -1,
+                           verbosity);
+  return r;
+}
+
+//! Largest relative difference of the absorption vectors of a and b
+Numeric max_rel_diff(const PropagationMatrix& a, const PropagationMatrix& b) {
+  Numeric x = 0, y = 0;
+  for (Index i = 0; i < NF; i++) {
+    x = std::max(x, std::abs(a.Kjj()[i] - b.Kjj()[i]));
+    y = std::max(y, std::abs(a.Kjj()[i]));
+  }
+  return x / y;
+}
+}  // namespace
+
+int main() try {
+#ifdef _OPENMP
+  // More frequency blocks than cores is fine, and tests the block borders
+  omp_set_num_threads(4);
+#endif
+
+  const Result bands = compute("Bands");
+  const Result blocks = compute("FrequencyBlocks");
+
+  Numeric diff = max_rel_diff(bands.propmat_clearsky, blocks.propmat_clearsky);
+  for (Index iq = 0; iq < 2; iq++)
+    diff = std::max(diff,
+                    max_rel_diff(bands.dpropmat_clearsky_dx[iq],
+                                 blocks.dpropmat_clearsky_dx[iq]));
+
+  std::cout << "Largest relative difference: " << diff << '\n';
+  if (not(diff < 1e-12)) {
+    std::cerr << "FrequencyBlocks and Bands differ\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,324 @@
+#include "absorptionlines.h"
+#include "artstime.h"
+#include "auto_md.h"
+#include "jacobian.h"
+#include "lineshape.h"
+#include "matpack_data.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+//! Sizes of the test, much smaller for a smoke run
+Index NF = 100'000;
+Index NL = 500;
+Index NREP = 1'000;
+Index NL_HITRAN = 5'000;
+Index NF_HITRAN = 10'000;
+constexpr Index NQ = 12;
+
+//! A band of nl lines from 100 GHz and up with spacing dF0
+AbsorptionLines test_band(Index nl, Numeric dF0) {
+  LineShape::Model model(2);
+  model[0].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 20e3, 0.8);
+  model[1].G0() =
+      LineShape::ModelParameters(LineShape::TemperatureModel::T1, 15e3, 0.7);
+
+  const QuantumIdentifier qid("H2O-161 J 3 2");
+  Array<Absorption::SingleLine> lines;
+  for (Index i = 0; i < nl; i++) {
+    lines.emplace_back(Absorption::SingleLine(100e9 + dF0 * Numeric(i),
+                                              1e-20,
+                                              1e-20,
+                                              1.,
+                                              3.,
+                                              1e-14,
+                                              Zeeman::Model(),
+                                              model,
+                                              "J 3 2"));
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         Absorption::CutoffType::ByLine,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::LTE,
+                         Absorption::NormalizationType::None,
+                         LineShape::Type::VP,
+                         296,
+                         25e9,
+                         -1,
+                         qid,
+                         {Species::Species::Water, Species::Species::Bath},
+                         lines);
+}
+
+//! Estimate of the scratch memory the two schemes allocate per call [bytes]
+//!
+//! Counts the ComputeData buffers only: one per thread plus the shared one
+//! for Bands, a single full-grid set spread over the blocks otherwise
+Index scratch_bytes(const String& parallel_option, Index nthreads) {
+  const Index one = NF * (1 + NQ) * Index(sizeof(Complex));
+  return parallel_option == "Bands" ? (nthreads + 1) * one : one;
+}
+}  // namespace
+
+//! Usage: test_lbl_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) {
+    NF = 1'000;
+    NL = 20;
+    NL_HITRAN = 100;
+    NF_HITRAN = 1'000;
+    NREP = 10;
+  }
+
+  const Verbosity verbosity;
+
+  const Vector f_grid = uniform_grid(50e9, NF, 600e9 / Numeric(NF - 1));
+  const ArrayOfArrayOfSpeciesTag abs_species{ArrayOfSpeciesTag("H2O-161")};
+  const ArrayOfArrayOfAbsorptionLines abs_lines_per_species{{test_band(NL, 1e9)}};
+  const SpeciesIsotopologueRatios isotopologue_ratios =
+      Species::isotopologue_ratiosInitFromBuiltin();
+  const Vector rtp_vmr{0.01};
+
+  ArrayOfRetrievalQuantity jacobian_quantities(NQ);
+  for (auto& rq : jacobian_quantities)
+    rq.Target(Jacobian::Target(Jacobian::Atm::Temperature));
+
+#ifdef _OPENMP
+  const int max_threads = omp_get_max_threads();
+#else
+  const int max_threads = 1;
+#endif
+
+  std::cout << "nf: " << NF << "; nlines: " << NL << "; nq: " << NQ << '\n';
+  for (int nthreads = 1; nthreads <= max_threads; nthreads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(nthreads);
+#endif
+    for (const String parallel_option : {"Bands", "FrequencyBlocks"}) {
+      PropagationMatrix propmat_clearsky(NF);
+      StokesVector nlte_source(NF);
+      ArrayOfPropagationMatrix dpropmat_clearsky_dx(NQ, PropagationMatrix(NF));
+      ArrayOfStokesVector dnlte_source_dx;
+
+      Time start{};
+      propmat_clearskyAddLines(propmat_clearsky,
+                               nlte_source,
+                               dpropmat_clearsky_dx,
+                               dnlte_source_dx,
+                               f_grid,
+                               abs_species,
+                               {},
+                               jacobian_quantities,
+                               abs_lines_per_species,
+                               isotopologue_ratios,
+                               1e4,
+                               250,
+                               EnergyLevelMap{},
+                               rtp_vmr,
+                               0,
+                               1,
+                               0,
+                               0,
+                               "None",
+                               1,
+                               parallel_option,
+                               "Reference",
+                               -1,
+                               verbosity);
+      Time end{};
+
+      std::cout << "threads: " << nthreads << "; scheme: " << parallel_option
+                << "; time: " << end - start << "; estimated scratch: "
+                << Numeric(scratch_bytes(parallel_option, nthreads)) / 1e6
+                << " MB\n";
+    }
+  }
+
+  // The Faddeeva function per frequency and for all frequencies of a line
+  PropagationMatrix reference(NF), weideman(NF);
+  Numeric time_reference = 0, time_weideman = 0;
+  for (const String faddeeva_option : {"Reference", "Weideman"}) {
+    const bool is_reference = faddeeva_option == "Reference";
+    PropagationMatrix& propmat_clearsky = is_reference ? reference : weideman;
+    StokesVector nlte_source(NF);
+    ArrayOfPropagationMatrix dpropmat_clearsky_dx;
+    ArrayOfStokesVector dnlte_source_dx;
+
+    Time start{};
+    propmat_clearskyAddLines(propmat_clearsky,
+                             nlte_source,
+                             dpropmat_clearsky_dx,
+                             dnlte_source_dx,
+                             f_grid,
+                             abs_species,
+                             {},
+                             {},
+                             abs_lines_per_species,
+                             isotopologue_ratios,
+                             1e4,
+                             250,
+                             EnergyLevelMap{},
+                             rtp_vmr,
+                             0,
+                             1,
+                             0,
+                             0,
+                             "None",
+                             1,
+                             "Bands",
+                             faddeeva_option,
+                             -1,
+                             verbosity);
+    Time end{};
+    const Numeric seconds = TimeStep(end - start).count();
+    (is_reference ? time_reference : time_weideman) = seconds;
+  }
+
+  std::cout << "Faddeeva function per frequency: " << time_reference
+            << " s; for all frequencies of a line: " << time_weideman
+            << " s\n";
+
+  for (Index iv = 0; iv < NF; iv++) {
+    const Numeric a = reference.Kjj()[iv];
+    if (std::abs(weideman.Kjj()[iv] - a) > 1e-10 * std::abs(a)) {
+      std::cerr << "Faddeeva mismatch at " << f_grid[iv] << " Hz: " << a
+                << " vs " << weideman.Kjj()[iv] << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Line shape parameters line-by-line and from the structure-of-arrays kernel
+  const AbsorptionLines& band = abs_lines_per_species[0][0];
+  const Vector vmrs = band.BroadeningSpeciesVMR(rtp_vmr, abs_species);
+
+  Numeric sum_band = 0;
+  Time start_band{};
+  for (Index irep = 0; irep < NREP; irep++) {
+    for (Index i = 0; i < NL; i++)
+      sum_band += band.ShapeParameters(i, 250, 1e4, vmrs).G0;
+  }
+  Time end_band{};
+
+  Numeric sum_kernel = 0;
+  Time start_kernel{};
+  for (Index irep = 0; irep < NREP; irep++) {
+    const LineShape::BandKernel kernel(band);
+    Matrix X;
+    kernel.ShapeParameters(X, 250, 1e4, vmrs);
+    for (Index i = 0; i < NL; i++) sum_kernel += X(0, i);
+  }
+  Time end_kernel{};
+
+  // A few dozen distinct temperatures, as along a typical path
+  Numeric sum_cached = 0;
+  Time start_cached{};
+  {
+    LineShape::BandKernel kernel(band);
+    kernel.Cache(0);
+    Matrix X;
+    for (Index irep = 0; irep < NREP; irep++) {
+      kernel.ShapeParameters(X, 250 + Numeric(irep % 40), 1e4, vmrs);
+      for (Index i = 0; i < NL; i++) sum_cached += X(0, i);
+    }
+  }
+  Time end_cached{};
+
+  Numeric sum_uncached = 0;
+  {
+    const LineShape::BandKernel kernel(band);
+    Matrix X;
+    for (Index irep = 0; irep < NREP; irep++) {
+      kernel.ShapeParameters(X, 250 + Numeric(irep % 40), 1e4, vmrs);
+      for (Index i = 0; i < NL; i++) sum_uncached += X(0, i);
+    }
+  }
+
+  std::cout << "shape parameters by line: " << end_band - start_band
+            << "; by kernel: " << end_kernel - start_kernel
+            << "; by cached kernel: " << end_cached - start_cached << '\n';
+
+  if (std::abs(sum_band - sum_kernel) > 1e-12 * std::abs(sum_band)) {
+    std::cerr << "Kernel mismatch: " << sum_band << " vs " << sum_kernel
+              << '\n';
+    return EXIT_FAILURE;
+  }
+
+  if (sum_cached not_eq sum_uncached) {
+    std::cerr << "Cache mismatch: " << sum_cached << " vs " << sum_uncached
+              << '\n';
+    return EXIT_FAILURE;
+  }
+
+  // A band with as many lines as in HITRAN, line by line and by the kernel
+  const AbsorptionLines hitran_band =
+      test_band(NL_HITRAN, 500e9 / Numeric(NL_HITRAN));
+  const Vector hitran_f_grid =
+      uniform_grid(50e9, NF_HITRAN, 600e9 / Numeric(NF_HITRAN - 1));
+  const LineShape::BandKernel hitran_kernel(hitran_band);
+  const Vector hitran_vmrs =
+      hitran_band.BroadeningSpeciesVMR(rtp_vmr, abs_species);
+  const Vector no_sparse_f_grid;
+
+  std::cout << "nf: " << NF_HITRAN << "; nlines: " << NL_HITRAN << '\n';
+  for (auto faddeeva_type :
+       {Options::LblFaddeeva::Reference, Options::LblFaddeeva::Weideman}) {
+    LineShape::ComputeData by_line(hitran_f_grid, {}, false);
+    LineShape::ComputeData by_kernel(hitran_f_grid, {}, false);
+    Numeric time_line = 0, time_kernel = 0;
+    for (auto* kernel : {static_cast<const LineShape::BandKernel*>(nullptr),
+                         &hitran_kernel}) {
+      LineShape::ComputeData& com = kernel ? by_kernel : by_line;
+      LineShape::ComputeData sparse_com(no_sparse_f_grid, {}, false);
+
+      Time start{};
+      LineShape::compute(com,
+                         sparse_com,
+                         hitran_band,
+                         {},
+                         {},
+                         hitran_vmrs,
+                         {},
+                         0.01,
+                         1,
+                         1e4,
+                         250,
+                         0,
+                         0,
+                         Zeeman::Polarization::None,
+                         Options::LblSpeedup::None,
+                         false,
+                         faddeeva_type,
+                         kernel);
+      Time end{};
+      (kernel ? time_kernel : time_line) = TimeStep(end - start).count();
+    }
+
+    std::cout << "Faddeeva: " << faddeeva_type << "; line by line: "
+              << time_line << " s; by kernel: " << time_kernel << " s\n";
+
+    for (Index iv = 0; iv < NF_HITRAN; iv++) {
+      const Complex a = by_line.F[iv];
+      if (std::abs(by_kernel.F[iv] - a) > 1e-12 * std::abs(a)) {
+        std::cerr << "Band kernel mismatch at " << hitran_f_grid[iv]
+                  << " Hz: " << a << " vs " << by_kernel.F[iv] << '\n';
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
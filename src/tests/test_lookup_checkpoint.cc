@@ -0,0 +1,168 @@
+#include "agenda_set.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "workspace.h"
+#include "xml_io.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+
+namespace {
+const String filename = "test_lookup_checkpoint.xml";
+
+//! The table setup, two species with a nonlinear H2O
+struct Setup {
+  ArrayOfArrayOfSpeciesTag abs_species{ArrayOfSpeciesTag("O2-PWR98"),
+                                       ArrayOfSpeciesTag("H2O-PWR98")};
+  ArrayOfArrayOfSpeciesTag abs_nls{ArrayOfSpeciesTag("H2O-PWR98")};
+  Vector f_grid{50e9, 60e9, 118e9, 183e9};
+  Vector abs_p{1e5, 5e4, 2e4, 1e4};
+  Matrix abs_vmrs;
+  Vector abs_t{280, 260, 230, 220};
+  Vector abs_t_pert{-10, 0, 10};
+  Vector abs_nls_pert{0.5, 1, 2};
+
+  Setup() : abs_vmrs(2, 4) {
+    abs_vmrs(0, joker) = 0.21;
+    abs_vmrs(1, joker) = Vector{1e-2, 5e-3, 1e-4, 1e-5};
+  }
+};
+
+//! abs_lookupCalc with a checkpoint after every block of work items
+GasAbsLookup calc(Workspace& ws,
+                  const Agenda& agenda,
+                  const Setup& s,
+                  const String& checkpoint_file) {
+  const Verbosity verbosity;
+  GasAbsLookup abs_lookup;
+  Index abs_lookup_is_adapted;
+  abs_lookupCalc(ws,
+                 abs_lookup,
+                 abs_lookup_is_adapted,
+                 s.abs_species,
+                 s.abs_nls,
+                 s.f_grid,
+                 s.abs_p,
+                 s.abs_vmrs,
+                 s.abs_t,
+                 s.abs_t_pert,
+                 s.abs_nls_pert,
+                 agenda,
+                 1e-9,
+                 "Double",
+                 checkpoint_file,
+                 0,
+                 verbosity);
+  return abs_lookup;
+}
+
+//! Writes a checkpoint as abs_lookupCalc does
+void write_checkpoint(const GasAbsLookup& abs_lookup) {
+  const Verbosity verbosity;
+  xml_write_to_file(filename, abs_lookup, FILE_TYPE_BINARY, 0, verbosity);
+}
+
+bool checkpoint_exists() {
+  return std::filesystem::exists(filename.c_str()) or
+         std::filesystem::exists((filename + ".bin").c_str());
+}
+}  // namespace
+
+int main() try {
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+
+  auto ws_ptr = Workspace::create();
+  Workspace& ws = *ws_ptr;
+
+  // Workspace variables used by the methods of the agenda
+  Setup s;
+  Index stokes_dim = 1;
+  Index propmat_clearsky_agenda_checked = 1;
+  PredefinedModelData predefined_model_data;
+  Verbosity verbosity;
+  auto b0 = ws.borrow(ws.WsvMap_ptr->at("abs_species"), s.abs_species);
+  auto b1 = ws.borrow(ws.WsvMap_ptr->at("stokes_dim"), stokes_dim);
+  auto b2 = ws.borrow(ws.WsvMap_ptr->at("propmat_clearsky_agenda_checked"),
+                      propmat_clearsky_agenda_checked);
+  auto b3 = ws.borrow(ws.WsvMap_ptr->at("predefined_model_data"),
+                      predefined_model_data);
+  auto b4 = ws.borrow(ws.WsvMap_ptr->at("verbosity"), verbosity);
+
+  AgendaManip::AgendaCreator creator(ws, "propmat_clearsky_agenda");
+  creator.add("propmat_clearskyInit");
+  creator.add("propmat_clearskyAddPredefined");
+  const Agenda agenda = creator.finalize();
+
+  const Tensor4 ref = calc(ws, agenda, s, "").XsecCopy();
+
+  // Checkpoints are written between the blocks and removed at the end
+  if (not(calc(ws, agenda, s, filename).XsecCopy() == ref)) {
+    std::cerr << "The checkpointed table differs from the table\n";
+    return EXIT_FAILURE;
+  }
+  if (checkpoint_exists()) {
+    std::cerr << "The checkpoint is not removed\n";
+    return EXIT_FAILURE;
+  }
+
+  // An interrupted run, with the two lowest pressures not yet computed
+  GasAbsLookup partial = calc(ws, agenda, s, "");
+  partial.Xsec()(joker, joker, joker, Range(0, 2)) = NAN;
+  write_checkpoint(partial);
+  if (not(calc(ws, agenda, s, filename).XsecCopy() == ref)) {
+    std::cerr << "The resumed table differs from the table\n";
+    return EXIT_FAILURE;
+  }
+  if (checkpoint_exists()) {
+    std::cerr << "The checkpoint is not removed after resuming\n";
+    return EXIT_FAILURE;
+  }
+
+  // The complete columns of the checkpoint are kept, not computed again
+  partial.Xsec()(joker, joker, joker, Range(2, 2)) *= 2;
+  write_checkpoint(partial);
+  const Tensor4 resumed = calc(ws, agenda, s, filename).XsecCopy();
+  if (not(resumed(joker, joker, joker, Range(0, 2)) ==
+          ref(joker, joker, joker, Range(0, 2))) or
+      not(resumed(joker, joker, joker, Range(2, 2)) ==
+          partial.Xsec()(joker, joker, joker, Range(2, 2)))) {
+    std::cerr << "The complete columns of the checkpoint are computed again\n";
+    return EXIT_FAILURE;
+  }
+
+  // A checkpoint of another setup is an error, and is kept
+  Setup other;
+  other.abs_p[3] = 5e3;
+  write_checkpoint(calc(ws, agenda, other, ""));
+  try {
+    calc(ws, agenda, s, filename);
+    std::cerr << "The checkpoint of another setup is used\n";
+    return EXIT_FAILURE;
+  } catch (std::exception& e) {
+    if (std::string_view(e.what()).find("was written for another setup") ==
+        std::string_view::npos)
+      throw;
+  }
+  if (not checkpoint_exists()) {
+    std::cerr << "The checkpoint of another setup is removed\n";
+    return EXIT_FAILURE;
+  }
+
+  std::filesystem::remove(filename.c_str());
+  std::filesystem::remove((filename + ".bin").c_str());
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+#include "artstime.h"
+#include "gas_abs_lookup.h"
+#include "matpack_data.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+//! Sizes of the test, much smaller for a smoke run
+Index NF = 2'000;
+constexpr Index NP = 40;
+Index NSTATES = 200;
+
+GasAbsLookup test_table(const Verbosity& verbosity) {
+  GasAbsLookup gal;
+
+  gal.Species() = {ArrayOfSpeciesTag("H2O"),
+                   ArrayOfSpeciesTag("O2"),
+                   ArrayOfSpeciesTag("N2")};
+  gal.NonLinearSpecies() = ArrayOfIndex{0};
+  gal.Fgrid() = uniform_grid(1e9, NF, 5e7);
+  gal.Pgrid() = uniform_grid(1e5, NP, -1e5 / Numeric(NP + 1));
+  gal.VMRs() = Matrix(3, NP, 0.0);
+  gal.VMRs()(0, joker) = 1e-2;
+  gal.VMRs()(1, joker) = 0.21;
+  gal.VMRs()(2, joker) = 0.78;
+  gal.Tref() = Vector(NP, 250);
+  gal.Tpert() = uniform_grid(-50, 11, 10);
+  gal.NLSPert() = {0, 0.5, 1, 2, 10};
+
+  Tensor4& xsec = gal.Xsec();
+  xsec.resize(11, 3 + 4, NF, NP);
+  for (Index a = 0; a < xsec.nbooks(); a++)
+    for (Index b = 0; b < xsec.npages(); b++)
+      for (Index c = 0; c < xsec.nrows(); c++)
+        for (Index d = 0; d < xsec.ncols(); d++)
+          xsec(a, b, c, d) = 1e-25 * Numeric(1 + a + 2 * b + (c % 7)) *
+                             Numeric(1 + d);
+
+  const ArrayOfArrayOfSpeciesTag species = gal.Species();
+  const Vector f_grid = gal.Fgrid();
+  gal.Adapt(species, f_grid, verbosity);
+  return gal;
+}
+
+//! Time per extraction of the states, and the extracted absorption
+TimeStep extract(Tensor3& sga_all,
+                 const GasAbsLookup& gal,
+                 Index order,
+                 const Vector& p,
+                 const Vector& T,
+                 const Matrix& vmrs) {
+  const Vector& f_grid = gal.GetFgrid();
+  sga_all.resize(NSTATES, 3, NF);
+  Matrix sga;
+
+  const Time start{};
+  for (Index i = 0; i < NSTATES; i++) {
+    gal.Extract(sga, {}, order, order, 1, 0, p[i], T[i], vmrs(i, joker),
+                f_grid, 0.5);
+    sga_all(i, joker, joker) = sga;
+  }
+  const Time end{};
+  return TimeStep(end - start) / Numeric(NSTATES);
+}
+
+//! As extract, but with the batched Extract on all states at once
+TimeStep extract_batch(Tensor3& sga_all,
+                       const GasAbsLookup& gal,
+                       Index order,
+                       const Vector& p,
+                       const Vector& T,
+                       const Matrix& vmrs) {
+  sga_all.resize(NSTATES, 3, NF);
+  GasAbsLookupWeights weights;
+
+  const Time start{};
+  gal.ExtractWeights(
+      weights, order, order, 1, p, T, vmrs, gal.GetFgrid(), 0.5);
+  gal.Extract(sga_all, {}, weights, vmrs);
+  const Time end{};
+  return TimeStep(end - start) / Numeric(NSTATES);
+}
+
+//! Largest relative difference between two extractions
+Numeric max_rel_diff(const Tensor3& a, const Tensor3& ref) {
+  Numeric max_err = 0;
+  for (Index i = 0; i < NSTATES; i++)
+    for (Index j = 0; j < 3; j++)
+      for (Index k = 0; k < NF; k++)
+        max_err =
+            std::max(max_err, std::abs(a(i, j, k) - ref(i, j, k)) / ref(i, j, k));
+  return max_err;
+}
+}  // namespace
+
+//! Usage: test_lookup_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) {
+    NF = 50;
+    NSTATES = 20;
+  }
+
+  const Verbosity verbosity;
+  const GasAbsLookup gal = test_table(verbosity);
+  GasAbsLookup gal_float = gal;
+  gal_float.SetStorage(Options::LookupStorage::Float);
+
+  // States along a path
+  Vector p(NSTATES), T(NSTATES);
+  Matrix vmrs(NSTATES, 3);
+  for (Index i = 0; i < NSTATES; i++) {
+    p[i] = 9e4 * std::pow(5e3 / 9e4, Numeric(i) / Numeric(NSTATES));
+    T[i] = 230 + 30 * std::sin(Numeric(i));
+    vmrs(i, joker) = Vector{5e-3 * (1 + std::cos(Numeric(i))), 0.21, 0.78};
+  }
+
+  for (Index order : {1, 3}) {
+    Tensor3 ref, single, batch, batch_single;
+    const TimeStep time = extract(ref, gal, order, p, T, vmrs);
+    const TimeStep time_float = extract(single, gal_float, order, p, T, vmrs);
+    const TimeStep time_batch = extract_batch(batch, gal, order, p, T, vmrs);
+    const TimeStep time_batch_float =
+        extract_batch(batch_single, gal_float, order, p, T, vmrs);
+
+    const Numeric float_err = max_rel_diff(single, ref);
+    const Numeric batch_err = max_rel_diff(batch, ref);
+    const Numeric batch_float_err = max_rel_diff(batch_single, single);
+
+    std::cout << "p/T interpolation order " << order << ":\n"
+              << "Extract per point, double table:         " << time << '\n'
+              << "Extract per point, float table:          " << time_float
+              << '\n'
+              << "Batched Extract per point, double table: " << time_batch
+              << '\n'
+              << "Batched Extract per point, float table:  " << time_batch_float
+              << '\n'
+              << "Max relative difference float/double: " << float_err << '\n'
+              << "Max relative difference batched/per point: "
+              << std::max(batch_err, batch_float_err) << '\n';
+
+    if (float_err > 1e-6) {
+      std::cerr << "The float table differs from the double table\n";
+      return EXIT_FAILURE;
+    }
+
+    if (batch_err > 1e-12 or batch_float_err > 1e-12) {
+      std::cerr << "The batched extraction differs from Extract\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,69 @@
+#include "arts_omp.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+//! Runs a split loop of n iterations and returns the threads used inside each
+std::vector<int> inner_team_sizes(int n) {
+  std::vector<int> sizes(n, 0);
+
+  const ArtsOmpNestedLoop loop{n};
+#pragma omp parallel for num_threads(loop.threads()) if (loop.threads() > 1)
+  for (int i = 0; i < n; i++) {
+    const ArtsOmpInnerThreads inner{loop};
+    const int navailable = arts_omp_get_available_threads();
+
+    std::atomic<int> nteam{0};
+#pragma omp parallel num_threads(navailable) if (navailable > 1)
+    {
+      nteam++;
+
+      // Regions nested deeper than the split get no threads
+      if (arts_omp_get_available_threads() != 1) nteam = -1000;
+    }
+    sizes[i] = nteam;
+  }
+
+  return sizes;
+}
+}  // namespace
+
+int main() {
+  const int nthreads = arts_omp_get_max_threads();
+
+  for (int n : {1, 2, 3, nthreads, 2 * nthreads + 1}) {
+    const std::vector<int> sizes = inner_team_sizes(n);
+
+    int sum = 0;
+    for (int s : sizes) {
+      if (s < 1) {
+        std::cerr << "Bad nested team of " << s << " threads for " << n
+                  << " iterations\n";
+        return EXIT_FAILURE;
+      }
+      sum += s;
+    }
+
+    // All threads are in use at the same time when there are no more
+    // iterations than threads
+    if (n <= nthreads and sum != nthreads) {
+      std::cerr << n << " iterations used " << sum << " of " << nthreads
+                << " threads\n";
+      return EXIT_FAILURE;
+    }
+
+    std::cout << "iterations: " << n << "; nested threads:";
+    for (int s : sizes) std::cout << ' ' << s;
+    std::cout << '\n';
+  }
+
+  if (arts_omp_get_available_threads() != nthreads) {
+    std::cerr << "The threads are not given back after the loops\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include "arts_omp.h"
+#include "rng.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+constexpr Index NS = 10'000;
+constexpr Index ND = 100;
+
+//! Known answers of Philox4x32-10 from the Random123 distribution
+bool test_known_answers() {
+  using block = Philox4x32::block;
+  return Philox4x32::generate({0, 0, 0, 0}, {0, 0}) ==
+             block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8} and
+         Philox4x32::generate(
+             {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+             {0xffffffff, 0xffffffff}) ==
+             block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd} and
+         Philox4x32::generate(
+             {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+             {0xa4093822, 0x299f31d0}) ==
+             block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1};
+}
+
+//! Sum of the first ND draws of all the streams of a seed
+std::vector<Numeric> draw_streams(std::uint64_t seed, int nthreads) {
+  std::vector<Numeric> x(NS);
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+  for (Index i = 0; i < NS; i++) {
+    RandomNumberStream rng(seed, i);
+    auto draw = rng.get(0.0, 1.0);
+    for (Index j = 0; j < ND; j++) x[i] += draw();
+  }
+  return x;
+}
+}  // namespace
+
+int main() {
+  if (not test_known_answers()) {
+    std::cerr << "Philox4x32 does not reproduce the known answers\n";
+    return EXIT_FAILURE;
+  }
+
+  // The streams do not depend on the number or order of threads
+  const int nthreads = arts_omp_get_max_threads();
+  const std::vector<Numeric> a = draw_streams(42, nthreads);
+  const std::vector<Numeric> b = draw_streams(42, 1);
+  const std::vector<Numeric> c = draw_streams(43, nthreads);
+  if (a not_eq b or a == c) {
+    std::cerr << "The random number streams are not reproducible\n";
+    return EXIT_FAILURE;
+  }
+
+  // The draws are uniform on [0, 1)
+  Numeric mean = 0;
+  for (auto& x : a) mean += x;
+  mean /= Numeric(NS * ND);
+  std::cout << "threads: " << nthreads << "; mean of the draws: " << mean << '\n';
+  if (std::abs(mean - 0.5) > 1e-2) {
+    std::cerr << "The random number streams are not uniform\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+#include "artstime.h"
+#include "arts_omp.h"
+#include "rte.h"
+#include "transmissionmatrix.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+namespace {
+//! Sizes of the test, much smaller for a smoke run
+Index NP = 300;
+Index NF = 1'000;
+constexpr Index NS = 4;
+
+//! Stand-in for the agenda call: a smooth propagation matrix along a limb path
+void test_propmat(PropagationMatrix& K, Vector& B, Index ip) {
+  const Numeric h = std::abs(Numeric(ip - NP / 2)) / Numeric(NP / 2);
+  const Numeric t = 200 + 80 * h;
+  Tensor4& data = K.Data();
+  for (Index i = 0; i < data.ncols(); i++)
+    for (Index iv = 0; iv < NF; iv++)
+      data(0, 0, iv, i) = (i == 0 ? 1e-4 : 1e-6 * Numeric(i)) *
+                          std::exp(-5 * h) *
+                          (1 + std::sin(1e-3 * Numeric(iv * (i + 1))));
+  for (Index iv = 0; iv < NF; iv++) B[iv] = 1e-15 * t * (1 + 1e-4 * Numeric(iv));
+}
+
+struct Path {
+  ArrayOfPropagationMatrix K =
+      ArrayOfPropagationMatrix(NP, PropagationMatrix(NF, NS));
+  ArrayOfRadiationVector src =
+      ArrayOfRadiationVector(NP, RadiationVector(NF, NS));
+  ArrayOfTransmissionMatrix lyr =
+      ArrayOfTransmissionMatrix(NP, TransmissionMatrix(NF, NS));
+};
+
+void point(Path& path, Index ip, Vector& B, StokesVector& a, StokesVector& S) {
+  test_propmat(path.K[ip], B, ip);
+  a = path.K[ip];
+  ArrayOfRadiationVector dJ;
+  RadiationVector J_add;
+  stepwise_source(path.src[ip],
+                  dJ,
+                  J_add,
+                  path.K[ip],
+                  a,
+                  S,
+                  {},
+                  {},
+                  {},
+                  B,
+                  {},
+                  {},
+                  false);
+}
+
+void layer(Path& path, Index ip) {
+  ArrayOfTransmissionMatrix dT1, dT2;
+  stepwise_transmission(path.lyr[ip],
+                        dT1,
+                        dT2,
+                        path.K[ip - 1],
+                        path.K[ip],
+                        {},
+                        {},
+                        1e3,
+                        0,
+                        0,
+                        -1);
+}
+}  // namespace
+
+//! Usage: test_rte_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) {
+    NP = 20;
+    NF = 10;
+  }
+
+  // Two passes over the path, as iyEmissionStandard did before
+  Path two;
+  Time start_two{};
+#pragma omp parallel for
+  for (Index ip = 0; ip < NP; ip++) {
+    Vector B(NF);
+    StokesVector a(NF, NS), S(NF, NS);
+    point(two, ip, B, a, S);
+  }
+#pragma omp parallel for
+  for (Index ip = 1; ip < NP; ip++) layer(two, ip);
+  Time end_two{};
+
+  // A single pass with scratch memory per chunk
+  Path fused;
+  Time start_fused{};
+  const Index nchunks = ppath_fused_chunks(NP);
+  ArrayOfVector B(nchunks, Vector(NF));
+  ArrayOfStokesVector a(nchunks, StokesVector(NF, NS));
+  ArrayOfStokesVector S(nchunks, StokesVector(NF, NS));
+  ppath_fused_pass(
+      NP,
+      nchunks,
+      [&](Index ip, Index ic) { point(fused, ip, B[ic], a[ic], S[ic]); },
+      [&](Index ip, Index) { layer(fused, ip); });
+  Time end_fused{};
+
+  std::cout << "np: " << NP << "; nf: " << NF << "; stokes_dim: " << NS
+            << "; threads: " << arts_omp_get_max_threads() << '\n'
+            << "two passes: " << end_two - start_two << '\n'
+            << "fused pass: " << end_fused - start_fused << '\n';
+
+  for (Index ip = 0; ip < NP; ip++) {
+    for (Index iv = 0; iv < NF; iv++) {
+      if (two.src[ip].Vec4(iv) != fused.src[ip].Vec4(iv) or
+          (ip > 0 and two.lyr[ip].Mat4(iv) != fused.lyr[ip].Mat4(iv))) {
+        std::cerr << "Fused pass differs at point " << ip << '\n';
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
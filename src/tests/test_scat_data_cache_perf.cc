@@ -0,0 +1,158 @@
+#include "artstime.h"
+#include "auto_md.h"
+#include "math_funcs.h"
+#include "optproperties.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+namespace {
+//! Sizes of the test, much smaller for a smoke run
+Index NELEM = 20;
+Index NLEVEL = 30;
+Index NITER = 3;
+constexpr Index STOKES_DIM = 2;
+
+//! Scattering data of NELEM elements at 2 frequencies and 3 temperatures
+ArrayOfArrayOfSingleScatteringData scattering_data(PType ptype) {
+  const bool total_rnd = ptype == PTYPE_TOTAL_RND;
+  const Vector za_grid =
+      total_rnd ? uniform_grid(0, 181, 1) : uniform_grid(0, 19, 10);
+  const Vector aa_grid = total_rnd ? Vector{} : uniform_grid(0, 10, 20);
+
+  ArrayOfArrayOfSingleScatteringData scat_data(1);
+  for (Index ie = 0; ie < NELEM; ie++) {
+    SingleScatteringData ssd;
+    ssd.ptype = ptype;
+    ssd.f_grid = {100e9, 200e9};
+    ssd.T_grid = uniform_grid(200, 3, 40);
+    ssd.za_grid = za_grid;
+    ssd.aa_grid = aa_grid;
+    if (total_rnd) {
+      ssd.pha_mat_data.resize(2, 3, za_grid.nelem(), 1, 1, 1, 6);
+      ssd.ext_mat_data.resize(2, 3, 1, 1, 1);
+      ssd.abs_vec_data.resize(2, 3, 1, 1, 1);
+    } else {
+      ssd.pha_mat_data.resize(
+          2, 3, za_grid.nelem(), aa_grid.nelem(), za_grid.nelem(), 1, 16);
+      ssd.ext_mat_data.resize(2, 3, za_grid.nelem(), 1, 3);
+      ssd.abs_vec_data.resize(2, 3, za_grid.nelem(), 1, 2);
+    }
+
+    Index n = ie;
+    for (auto x = ssd.pha_mat_data.elem_begin();
+         x != ssd.pha_mat_data.elem_end();
+         ++x)
+      *x = 1 + std::sin(Numeric(++n));
+    ssd.ext_mat_data = 2;
+    ssd.abs_vec_data = 1;
+    scat_data[0].push_back(ssd);
+  }
+  return scat_data;
+}
+
+/** The calls of pha_mat_sptFromData by the scattering integral of a 1D DOIT
+    run, and the time they take
+
+    \param nbytes The size of the cache at the end of the run
+    \param cached Keep the interpolated data for the run, as DoitCalc
+ */
+Numeric doit_run(Tensor5& result,
+                 Index& nbytes,
+                 const ArrayOfArrayOfSingleScatteringData& scat_data,
+                 bool cached) {
+  const Vector za_grid = uniform_grid(0, 19, 10);
+  const Vector aa_grid = uniform_grid(0, 19, 20);
+  const Vector f_grid{150e9};
+  const Tensor4 pnd_field(NELEM, NLEVEL, 1, 1, 1e3);
+  const Verbosity verbosity;
+
+  Tensor5 pha_mat_spt(NELEM, za_grid.nelem(), aa_grid.nelem(), STOKES_DIM,
+                      STOKES_DIM);
+  result.resize(NLEVEL, NELEM, za_grid.nelem(), aa_grid.nelem(), STOKES_DIM);
+
+  std::optional<SsdInterpCachePool::Scope> scope;
+  if (cached) scope.emplace();
+
+  const Time start{};
+  for (Index iter = 0; iter < NITER; iter++) {
+    for (Index p = 0; p < NLEVEL; p++) {
+      const Numeric T = 210 + 2 * Numeric(p);
+      for (Index za_index = 0; za_index < za_grid.nelem(); za_index++) {
+        pha_mat_sptFromData(pha_mat_spt,
+                            scat_data,
+                            za_grid,
+                            aa_grid,
+                            za_index,
+                            0,
+                            0,
+                            f_grid,
+                            T,
+                            pnd_field,
+                            p,
+                            0,
+                            0,
+                            verbosity);
+        if (za_index == 3)
+          result(p, joker, joker, joker, joker) =
+              pha_mat_spt(joker, joker, joker, joker, 0);
+      }
+    }
+  }
+  const Numeric seconds = TimeStep(Time{} - start).count();
+
+  nbytes = SsdInterpCachePool::Lease{}->nbytes();
+  return seconds;
+}
+}  // namespace
+
+//! Usage: test_scat_data_cache_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) {
+    NELEM = 2;
+    NLEVEL = 3;
+    NITER = 2;
+  }
+
+  std::cout << "elements: " << NELEM << "; levels: " << NLEVEL
+            << "; iterations: " << NITER << '\n';
+
+  for (PType ptype : {PTYPE_TOTAL_RND, PTYPE_AZIMUTH_RND}) {
+    const ArrayOfArrayOfSingleScatteringData scat_data =
+        scattering_data(ptype);
+
+    Tensor5 uncached, cached;
+    Index uncached_bytes, cached_bytes;
+    const Numeric uncached_time =
+        doit_run(uncached, uncached_bytes, scat_data, false);
+    const Numeric cached_time = doit_run(cached, cached_bytes, scat_data, true);
+
+    std::cout << PTypeToString(ptype)
+              << ": pha_mat_sptFromData, interpolating every call: "
+              << uncached_time << " s; cached: " << cached_time
+              << " s; cache size: " << cached_bytes << " bytes\n";
+
+    if (uncached_bytes not_eq 0 or SsdInterpCachePool::Lease{}->nbytes()) {
+      std::cerr << "The cache is kept beyond the run\n";
+      return EXIT_FAILURE;
+    }
+
+    for (auto x = uncached.elem_begin(), y = cached.elem_begin();
+         x != uncached.elem_end();
+         ++x, ++y) {
+      if (*x not_eq *y) {
+        std::cerr << "The cache changes the phase matrix\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
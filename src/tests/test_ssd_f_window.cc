@@ -0,0 +1,125 @@
+#include "auto_md.h"
+#include "math_funcs.h"
+#include "optproperties.h"
+#include "xml_io.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+constexpr Index NF = 12;
+
+//! Totally random scattering data at NF frequencies
+SingleScatteringData scattering_data() {
+  SingleScatteringData ssd;
+  ssd.ptype = PTYPE_TOTAL_RND;
+  ssd.description = "test_ssd_f_window";
+  ssd.f_grid.resize(NF);
+  for (Index i = 0; i < NF; i++)
+    ssd.f_grid[i] = 1e9 * (1 + Numeric(i) + 0.1 * Numeric(i * i));
+  ssd.T_grid = {230, 270};
+  ssd.za_grid = uniform_grid(0, 19, 10);
+  ssd.pha_mat_data.resize(NF, 2, ssd.za_grid.nelem(), 1, 1, 1, 6);
+  ssd.ext_mat_data.resize(NF, 2, 1, 1, 1);
+  ssd.abs_vec_data.resize(NF, 2, 1, 1, 1);
+
+  Index n = 0;
+  for (auto x = ssd.pha_mat_data.elem_begin(); x != ssd.pha_mat_data.elem_end();
+       ++x)
+    *x = 1 + std::sin(Numeric(++n));
+  for (auto x = ssd.ext_mat_data.elem_begin(); x != ssd.ext_mat_data.elem_end();
+       ++x)
+    *x = 3 + std::sin(Numeric(++n));
+  for (auto x = ssd.abs_vec_data.elem_begin(); x != ssd.abs_vec_data.elem_end();
+       ++x)
+    *x = 2 + std::sin(Numeric(++n));
+  return ssd;
+}
+
+//! The data of a, interpolated to f_grid, equals that of b
+bool same_interpolated(const SingleScatteringData& a,
+                       const SingleScatteringData& b,
+                       const Vector& f_grid,
+                       Index interp_order) {
+  const Verbosity verbosity;
+  ArrayOfArrayOfSingleScatteringData sd_a, sd_b;
+  scat_dataCalc(sd_a, {{a}}, f_grid, interp_order, verbosity);
+  scat_dataCalc(sd_b, {{b}}, f_grid, interp_order, verbosity);
+
+  const auto close = [](auto& x, auto& y) {
+    auto it = y.elem_begin();
+    for (auto v = x.elem_begin(); v != x.elem_end(); ++v, ++it)
+      if (std::abs(*v - *it) > 1e-12 * std::abs(*v)) return false;
+    return true;
+  };
+  return close(sd_a[0][0].pha_mat_data, sd_b[0][0].pha_mat_data) and
+         close(sd_a[0][0].ext_mat_data, sd_b[0][0].ext_mat_data) and
+         close(sd_a[0][0].abs_vec_data, sd_b[0][0].abs_vec_data);
+}
+}  // namespace
+
+int main() try {
+  const Verbosity verbosity;
+  const SingleScatteringData ssd = scattering_data();
+  const String filename = "test_ssd_f_window.xml";
+
+  const Vector f_grids[]{{},
+                         {ssd.f_grid[5] + 1e8},
+                         {ssd.f_grid[0]},
+                         uniform_grid(ssd.f_grid[3], 5, 1e8),
+                         {ssd.f_grid[NF - 1] - 1e8}};
+
+  for (FileType ftype : {FILE_TYPE_ASCII, FILE_TYPE_BINARY}) {
+    xml_write_to_file(filename, ssd, ftype, 0, verbosity);
+    // Ascii files round the data, so compare to the data read in full
+    SingleScatteringData full;
+    xml_read_from_file(filename, full, verbosity);
+
+    for (Index interp_order : {1, 3}) {
+      for (auto& f_grid : f_grids) {
+        SingleScatteringData read;
+        SingleScatteringDataFWindow window{read, f_grid, interp_order};
+        xml_read_from_file(filename, window, verbosity);
+
+        const auto [f_start, nf] =
+            ssd_f_window(full.f_grid, f_grid, interp_order);
+        std::cout << (ftype == FILE_TYPE_ASCII ? "ascii" : "binary")
+                  << "; interp_order: " << interp_order
+                  << "; nf_grid: " << f_grid.nelem()
+                  << "; frequencies read: " << read.f_grid.nelem() << '\n';
+
+        const Range r(f_start, nf);
+        const Tensor7 pha_mat_data{
+            full.pha_mat_data(r, joker, joker, joker, joker, joker, joker)};
+        if (read.f_grid.nelem() not_eq nf or
+            (f_grid.nelem() == 0 and nf not_eq NF) or
+            (f_grid.nelem() and nf > 2 * interp_order + 2) or
+            not(read.f_grid == full.f_grid[r]) or
+            not(read.pha_mat_data == pha_mat_data) or
+            not(read.ext_mat_data ==
+                full.ext_mat_data(r, joker, joker, joker, joker)) or
+            not(read.abs_vec_data ==
+                full.abs_vec_data(r, joker, joker, joker, joker))) {
+          std::cerr << "Wrong frequencies of the data read\n";
+          return EXIT_FAILURE;
+        }
+
+        if (f_grid.nelem() and
+            not same_interpolated(full, read, f_grid, interp_order)) {
+          std::cerr << "The data read interpolates differently\n";
+          return EXIT_FAILURE;
+        }
+      }
+    }
+
+    std::remove(filename.c_str());
+    std::remove((filename + ".bin").c_str());
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
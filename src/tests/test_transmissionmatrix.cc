@@ -0,0 +1,76 @@
+#include "artstime.h"
+#include "transmissionmatrix.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+constexpr Index NF = 5'000;
+constexpr Index NP = 100;
+
+//! Layer transmission matrices with all entries set
+ArrayOfTransmissionMatrix test_layers(Index ns) {
+  ArrayOfTransmissionMatrix layers(NP, TransmissionMatrix(NF, ns));
+  for (Index ip = 0; ip < NP; ip++)
+    for (Index iv = 0; iv < NF; iv++)
+      for (Index j = 0; j < ns; j++)
+        for (Index k = 0; k < ns; k++)
+          layers[ip](iv, j, k) =
+              (j == k ? 0.99 : 1e-3) *
+              (1 + 1e-3 * std::sin(Numeric(iv + 7 * ip + 3 * j + k)));
+  return layers;
+}
+
+//! The same accumulation as cumulative_transmission, by Eigen matrices
+template <int N>
+Numeric max_difference(const ArrayOfTransmissionMatrix& layers,
+                       const ArrayOfTransmissionMatrix& cumulative) {
+  Numeric max_err = 0;
+  for (Index iv = 0; iv < NF; iv++) {
+    Eigen::Matrix<Numeric, N, N> PiT = Eigen::Matrix<Numeric, N, N>::Identity();
+    for (Index ip = 1; ip < NP; ip++) {
+      PiT = (PiT * layers[ip].TraMat<N>(iv)).eval();
+      max_err = std::max(
+          max_err,
+          (PiT - cumulative[ip].TraMat<N>(iv)).cwiseAbs().maxCoeff());
+    }
+  }
+  return max_err;
+}
+
+template <int N>
+bool test_cumulative() {
+  const ArrayOfTransmissionMatrix layers = test_layers(N);
+
+  // The views and the element access share the layout
+  for (Index j = 0; j < N; j++)
+    for (Index k = 0; k < N; k++)
+      if (layers[1].Mat(5)(j, k) != layers[1](5, j, k) or
+          layers[1].Entry(j, k)[5] != layers[1](5, j, k))
+        return false;
+
+  const Time start{};
+  const ArrayOfTransmissionMatrix cumulative =
+      cumulative_transmission(layers, CumulativeTransmission::Forward);
+  const Time end{};
+
+  const Numeric err = max_difference<N>(layers, cumulative);
+  std::cout << "stokes_dim: " << N << "; cumulative_transmission: "
+            << end - start << "; max difference: " << err << '\n';
+  return err < 1e-12;
+}
+}  // namespace
+
+int main() try {
+  if (not(test_cumulative<1>() and test_cumulative<2>() and
+          test_cumulative<3>() and test_cumulative<4>())) {
+    std::cerr << "Structure-of-arrays transmission matrices differ\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
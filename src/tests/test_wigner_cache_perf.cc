@@ -0,0 +1,176 @@
+#include "absorptionlines.h"
+#include "artstime.h"
+#include "linemixing.h"
+#include "matpack_math.h"
+#include "wigner_functions.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <thread>
+
+namespace {
+//! Largest rotational quantum number of the band, smaller for a smoke run
+Index NMAX = 39;
+
+//! The fine structure lines of the 60 GHz O2 band, and 118 GHz, up to NMAX
+AbsorptionLines o2_band() {
+  Array<Absorption::SingleLine> lines;
+  for (Index N = 1; N <= NMAX; N += 2) {
+    // The N+ line, and the N- line that ends at the lowest level
+    for (auto [Ju, Jl] : {std::pair{N, N + 1}, std::pair{N - 1, N}}) {
+      const Numeric E0 = Constant::h * 43.1e9 * Numeric(Jl * (Jl + 1));
+      const Numeric F0 = N == 1 and Ju == 0
+                             ? 118.75e9
+                             : 60e9 + (Ju < N ? 1 : -1) * 1e8 * Numeric(N);
+
+      LineShape::Model model(2);
+      model[0].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, 1.6e4 - 1e2 * Numeric(N), 0.8);
+      model[1].G0() = LineShape::ModelParameters(
+          LineShape::TemperatureModel::T1, 1.5e4 - 1e2 * Numeric(N), 0.8);
+
+      lines.emplace_back(F0,
+                         1e-25 * std::exp(-E0 / (Constant::k * 296)),
+                         E0,
+                         Numeric(2 * Ju + 1),
+                         Numeric(2 * Jl + 1),
+                         1e-9,
+                         Zeeman::Model(),
+                         model,
+                         Quantum::Number::LocalState(
+                             var_string("J ", Ju, ' ', Jl),
+                             var_string("N ", N, ' ', N)));
+    }
+  }
+
+  return AbsorptionLines(true,
+                         true,
+                         Absorption::CutoffType::None,
+                         Absorption::MirroringType::None,
+                         Absorption::PopulationType::ByMakarovFullRelmat,
+                         Absorption::NormalizationType::None,
+                         LineShape::Type::VP,
+                         296,
+                         -1,
+                         -1,
+                         QuantumIdentifier("O2-66 S 1 1 v 0 0"),
+                         ArrayOfSpecies{Species::Species::Oxygen,
+                                        Species::Species::Bath},
+                         lines);
+}
+
+//! The parameters of Makarov et al. 2020, for both broadeners
+ErrorCorrectedSuddenData o2_ecs_data() {
+  ErrorCorrectedSuddenData ecs;
+  for (auto spec : {Species::Species::Oxygen, Species::Species::Bath}) {
+    auto& data = ecs[spec];
+    data.scaling =
+        LineShapeModelParameters(LineShapeTemperatureModel::T0, 1, 0, 0, 0);
+    data.collisional_distance = LineShapeModelParameters(
+        LineShapeTemperatureModel::T0, 0.61e-10, 0, 0, 0);
+    data.lambda =
+        LineShapeModelParameters(LineShapeTemperatureModel::T0, 0.39, 0, 0, 0);
+    data.beta =
+        LineShapeModelParameters(LineShapeTemperatureModel::T0, 0.567, 0, 0, 0);
+    data.mass = spec == Species::Species::Oxygen ? 31.9988 : 28.97;
+  }
+  return ecs;
+}
+
+//! Seconds spent by f on a new thread, whose Wigner symbol cache is empty
+template <typename Function>
+Numeric on_new_thread(Function&& f) {
+  Numeric seconds = 0;
+  std::thread([&]() {
+    const Time start{};
+    f();
+    seconds = TimeStep(Time{} - start).count();
+  }).join();
+  return seconds;
+}
+}  // namespace
+
+//! Usage: test_wigner_cache_perf [smoke]
+int main(int argc, char** argv) try {
+  const bool smoke = argc > 1 and std::string_view(argv[1]) == "smoke";
+  if (smoke) NMAX = 5;
+
+  make_wigner_ready(250, 20000000, 6);
+
+  const AbsorptionLines band = o2_band();
+  const ErrorCorrectedSuddenData ecs = o2_ecs_data();
+  const Vector temperatures = uniform_grid(150, 41, 5);
+  const Vector f_grid = uniform_grid(50e9, 1000, 2e7);
+  const Vector vmrs{0.21, 0.79};
+
+  const auto absorption = [&](ArrayOfComplexVector& out) {
+    out.resize(0);
+    for (Numeric T : temperatures)
+      out.push_back(Absorption::LineMixing::ecs_absorption(
+                        T,
+                        0,
+                        1e4,
+                        0.21,
+                        vmrs,
+                        ecs,
+                        f_grid,
+                        Zeeman::Polarization::None,
+                        band)
+                        .abs);
+  };
+  const auto adaptation = [&]() {
+    AbsorptionLines adapted = band;
+    Absorption::LineMixing::ecs_eigenvalue_adaptation(
+        adapted, temperatures, ecs, 1e4, 1, true, false, Verbosity{});
+  };
+
+  ArrayOfComplexVector cold, warm;
+  const Numeric cold_absorption = on_new_thread([&]() { absorption(cold); });
+  const Numeric cold_adaptation = on_new_thread(adaptation);
+
+  Numeric warm_absorption = 0, warm_adaptation = 0;
+  on_new_thread([&]() {
+    absorption(warm);
+    Time start{};
+    absorption(warm);
+    warm_absorption = TimeStep(Time{} - start).count();
+    start = Time{};
+    adaptation();
+    warm_adaptation = TimeStep(Time{} - start).count();
+  });
+
+  std::cout << "nlines: " << band.NumLines()
+            << "; ntemperatures: " << temperatures.nelem() << '\n'
+            << "ecs_absorption, empty cache: " << cold_absorption
+            << " s; filled cache: " << warm_absorption << " s\n"
+            << "ecs_eigenvalue_adaptation, empty cache: " << cold_adaptation
+            << " s; filled cache: " << warm_adaptation << " s\n";
+
+  for (Index i = 0; i < cold.nelem(); i++) {
+    for (Index j = 0; j < f_grid.nelem(); j++) {
+      if (cold[i][j] not_eq warm[i][j]) {
+        std::cerr << "Cached symbols change the absorption\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  for (int j = 0; j <= 8; j++) {
+    for (int L = 0; L <= 16; L += 2) {
+      if (wigner3j_cached(j, L, j + 1, 1, 0, -1) not_eq
+              wigner3j(j, L, j + 1, 1, 0, -1) or
+          wigner6j_cached(L, j, j + 1, 1, j + 1, j) not_eq
+              wigner6j(L, j, j + 1, 1, j + 1, j)) {
+        std::cerr << "Cached and computed symbols differ\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,80 @@
+#include "agenda_record.h"
+#include "artstime.h"
+#include "auto_md.h"
+#include "global_data.h"
+#include "methods.h"
+#include "workspace.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr Index NFORK = 16;
+
+//! Resident memory of this process in MB, from /proc
+Numeric resident_mb() {
+  std::ifstream is("/proc/self/statm");
+  Numeric size = 0, resident = 0;
+  is >> size >> resident;
+  return resident * 4096 / 1e6;
+}
+
+//! Forks and the duplication of abs_lookup by an agenda call in each of them
+void fork_and_duplicate(Workspace& ws, Index ilookup, bool write) {
+  std::vector<std::shared_ptr<Workspace>> forks;
+
+  const Time start{};
+  for (Index i = 0; i < NFORK; i++) forks.push_back(ws.fork());
+  const Time forked{};
+  for (auto& fork : forks) fork->duplicate(ilookup);
+  const Time duplicated{};
+  if (write) {
+    auto& lookup = *static_cast<GasAbsLookup*>((*forks[0])[ilookup].get());
+    lookup.Xsec()(0, 0, 0, 0) = 1;
+  }
+  const Time written{};
+
+  std::cout << (write ? "one writes" : "read only") << ": " << NFORK
+            << " forks: " << forked - start
+            << "; duplicating abs_lookup: " << duplicated - forked
+            << "; writing it: " << written - duplicated
+            << "; resident memory: " << resident_mb() << " MB\n";
+}
+}  // namespace
+
+//! Usage: test_workspace_fork_perf [size of abs_lookup in GB]
+int main(int argc, char** argv) try {
+  define_wsv_groups();
+  define_wsv_data();
+  define_wsv_map();
+  define_md_data_raw();
+  expand_md_data_raw_to_md_data();
+  define_md_map();
+  define_md_raw_map();
+  define_agenda_data();
+  define_agenda_map();
+  global_data::workspace_memory_handler.initialize();
+
+  const Numeric gb = argc > 1 ? std::stod(argv[1]) : 1;
+  const Index nf = Index(gb * 1e9 / (8 * 10 * 5 * 100));
+
+  auto ws_ptr = Workspace::create();
+  Workspace& ws = *ws_ptr;
+  const Index ilookup = ws.WsvMap_ptr->at("abs_lookup");
+  static_cast<GasAbsLookup*>(ws[ilookup].get())->Xsec() =
+      Tensor4(10, 5, nf, 100, 1);
+
+  std::cout << "abs_lookup: " << gb << " GB; resident memory: "
+            << resident_mb() << " MB\n";
+
+  fork_and_duplicate(ws, ilookup, false);
+  fork_and_duplicate(ws, ilookup, true);
+
+  return EXIT_SUCCESS;
+} catch (std::exception& e) {
+  std::cerr << e.what() << '\n';
+  return EXIT_FAILURE;
+}
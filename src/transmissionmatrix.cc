@@ -13,24 +13,21 @@
 #include "arts_conversions.h"
 #include "double_imanip.h"
 
-TransmissionMatrix::TransmissionMatrix(Index nf, Index stokes)
-    : stokes_dim(stokes),
-      T4(stokes_dim == 4 ? nf : 0, Eigen::Matrix4d::Identity()),
-      T3(stokes_dim == 3 ? nf : 0, Eigen::Matrix3d::Identity()),
-      T2(stokes_dim == 2 ? nf : 0, Eigen::Matrix2d::Identity()),
-      T1(stokes_dim == 1 ? nf : 0, Eigen::Matrix<double, 1, 1>::Identity()) {
+TransmissionMatrix::TransmissionMatrix(Index nf_, Index stokes)
+    : stokes_dim(stokes), nf(nf_), entries(stokes * stokes * nf_, 0) {
   ARTS_ASSERT(stokes_dim < 5 and stokes_dim > 0);
+  setIdentity();
 }
 
-const Eigen::Matrix4d& TransmissionMatrix::Mat4(size_t i) const { return T4[i]; }
-const Eigen::Matrix3d& TransmissionMatrix::Mat3(size_t i) const { return T3[i]; }
-const Eigen::Matrix2d& TransmissionMatrix::Mat2(size_t i) const { return T2[i]; }
-const Eigen::Matrix<double, 1, 1>& TransmissionMatrix::Mat1(size_t i) const { return T1[i]; }
+TransmissionMatrix::ConstMatMap<4> TransmissionMatrix::Mat4(size_t i) const { return TraMat<4>(i); }
+TransmissionMatrix::ConstMatMap<3> TransmissionMatrix::Mat3(size_t i) const { return TraMat<3>(i); }
+TransmissionMatrix::ConstMatMap<2> TransmissionMatrix::Mat2(size_t i) const { return TraMat<2>(i); }
+TransmissionMatrix::ConstMatMap<1> TransmissionMatrix::Mat1(size_t i) const { return TraMat<1>(i); }
 
-Eigen::Matrix4d& TransmissionMatrix::Mat4(size_t i) { return T4[i]; }
-Eigen::Matrix3d& TransmissionMatrix::Mat3(size_t i) { return T3[i]; }
-Eigen::Matrix2d& TransmissionMatrix::Mat2(size_t i) { return T2[i]; }
-Eigen::Matrix<double, 1, 1>& TransmissionMatrix::Mat1(size_t i) { return T1[i]; }
+TransmissionMatrix::MatMap<4> TransmissionMatrix::Mat4(size_t i) { return TraMat<4>(i); }
+TransmissionMatrix::MatMap<3> TransmissionMatrix::Mat3(size_t i) { return TraMat<3>(i); }
+TransmissionMatrix::MatMap<2> TransmissionMatrix::Mat2(size_t i) { return TraMat<2>(i); }
+TransmissionMatrix::MatMap<1> TransmissionMatrix::Mat1(size_t i) { return TraMat<1>(i); }
 
 TransmissionMatrix& TransmissionMatrix::operator=(
     const LazyScale<TransmissionMatrix>& lstm) {
@@ -40,17 +37,10 @@ TransmissionMatrix& TransmissionMatrix::operator=(
 }
 
 TransmissionMatrix::operator Tensor3() const {
-  Tensor3 T(Frequencies(), stokes_dim, stokes_dim);
-  for (size_t i = 0; i < T4.size(); i++)
-    for (size_t j = 0; j < 4; j++)
-      for (size_t k = 0; k < 4; k++) T(i, j, k) = T4[i](j, k);
-  for (size_t i = 0; i < T3.size(); i++)
-    for (size_t j = 0; j < 3; j++)
-      for (size_t k = 0; k < 3; k++) T(i, j, k) = T3[i](j, k);
-  for (size_t i = 0; i < T2.size(); i++)
-    for (size_t j = 0; j < 2; j++)
-      for (size_t k = 0; k < 2; k++) T(i, j, k) = T2[i](j, k);
-  for (size_t i = 0; i < T1.size(); i++) T(i, 0, 0) = T1[i](0, 0);
+  Tensor3 T(nf, stokes_dim, stokes_dim);
+  for (Index j = 0; j < stokes_dim; j++)
+    for (Index k = 0; k < stokes_dim; k++)
+      for (Index i = 0; i < nf; i++) T(i, j, k) = Entry(j, k)[i];
   return T;
 }
 
@@ -71,75 +61,87 @@ TransmissionMatrix::operator Tensor3() const {
 #pragma GCC diagnostic pop
 
 void TransmissionMatrix::setIdentity() {
-  std::fill(T4.begin(), T4.end(), Eigen::Matrix4d::Identity());
-  std::fill(T3.begin(), T3.end(), Eigen::Matrix3d::Identity());
-  std::fill(T2.begin(), T2.end(), Eigen::Matrix2d::Identity());
-  std::fill(T1.begin(), T1.end(), Eigen::Matrix<double, 1, 1>::Identity());
+  std::fill(entries.begin(), entries.end(), 0);
+  for (Index j = 0; j < stokes_dim; j++)
+    std::fill(Entry(j, j), Entry(j, j) + nf, 1);
 }
 
 void TransmissionMatrix::setZero() {
-  std::fill(T4.begin(), T4.end(), Eigen::Matrix4d::Zero());
-  std::fill(T3.begin(), T3.end(), Eigen::Matrix3d::Zero());
-  std::fill(T2.begin(), T2.end(), Eigen::Matrix2d::Zero());
-  std::fill(T1.begin(), T1.end(), Eigen::Matrix<double, 1, 1>::Zero());
+  std::fill(entries.begin(), entries.end(), 0);
+}
+
+namespace {
+/** Frequency-wise matrix product of two structure-of-arrays matrices
+ *
+ * @param[out] C The product, not aliased with A or B
+ * @param[in] A Left matrices
+ * @param[in] B Right matrices
+ * @param[in] nf Number of frequencies
+ */
+template <Index N>
+void soa_mul(Numeric* C,
+             const Numeric* A,
+             const Numeric* B,
+             const Index nf) noexcept {
+  for (Index j = 0; j < N; j++) {
+    for (Index k = 0; k < N; k++) {
+      Numeric* c = C + (j + N * k) * nf;
+      const Numeric* a = A + j * nf;
+      const Numeric* b = B + N * k * nf;
+      for (Index i = 0; i < nf; i++) c[i] = a[i] * b[i];
+      for (Index m = 1; m < N; m++) {
+        a = A + (j + N * m) * nf;
+        b = B + (m + N * k) * nf;
+        for (Index i = 0; i < nf; i++) c[i] += a[i] * b[i];
+      }
+    }
+  }
+}
+
+void soa_mul(Numeric* C,
+             const Numeric* A,
+             const Numeric* B,
+             const Index nf,
+             const Index stokes_dim) noexcept {
+  switch (stokes_dim) {
+    case 4:
+      soa_mul<4>(C, A, B, nf);
+      break;
+    case 3:
+      soa_mul<3>(C, A, B, nf);
+      break;
+    case 2:
+      soa_mul<2>(C, A, B, nf);
+      break;
+    default:
+      soa_mul<1>(C, A, B, nf);
+  }
 }
+}  // namespace
 
 void TransmissionMatrix::mul(const TransmissionMatrix& A,
                              const TransmissionMatrix& B) {
-  for (size_t i = 0; i < T4.size(); i++) T4[i].noalias() = A.T4[i] * B.T4[i];
-  for (size_t i = 0; i < T3.size(); i++) T3[i].noalias() = A.T3[i] * B.T3[i];
-  for (size_t i = 0; i < T2.size(); i++) T2[i].noalias() = A.T2[i] * B.T2[i];
-  for (size_t i = 0; i < T1.size(); i++) T1[i].noalias() = A.T1[i] * B.T1[i];
+  soa_mul(entries.data(), A.entries.data(), B.entries.data(), nf, stokes_dim);
 }
 
 void TransmissionMatrix::mul_aliased(const TransmissionMatrix& A,
                                      const TransmissionMatrix& B) {
-  for (size_t i = 0; i < T4.size(); i++) T4[i] = A.T4[i] * B.T4[i];
-  for (size_t i = 0; i < T3.size(); i++) T3[i] = A.T3[i] * B.T3[i];
-  for (size_t i = 0; i < T2.size(); i++) T2[i] = A.T2[i] * B.T2[i];
-  for (size_t i = 0; i < T1.size(); i++) T1[i] = A.T1[i] * B.T1[i];
+  std::vector<Numeric> C(entries.size());
+  soa_mul(C.data(), A.entries.data(), B.entries.data(), nf, stokes_dim);
+  entries.swap(C);
 }
 
 Numeric TransmissionMatrix::operator()(const Index i,
                                        const Index j,
                                        const Index k) const {
-  switch (stokes_dim) {
-    case 4:
-      return T4[i](j, k);
-    case 3:
-      return T3[i](j, k);
-    case 2:
-      return T2[i](j, k);
-    default:
-      return T1[i](j, k);
-  }
+  return Entry(j, k)[i];
 }
 
 Numeric& TransmissionMatrix::operator()(const Index i, const Index j, const Index k) {
-  switch (stokes_dim) {
-    case 4:
-      return T4[i](j, k);
-    case 3:
-      return T3[i](j, k);
-    case 2:
-      return T2[i](j, k);
-    default:
-      return T1[i](j, k);
-  }
+  return Entry(j, k)[i];
 }
 
-[[nodiscard]] Index TransmissionMatrix::Frequencies() const {
-  switch (stokes_dim) {
-    case 4:
-      return Index(T4.size());
-    case 3:
-      return Index(T3.size());
-    case 2:
-      return Index(T2.size());
-    default:
-      return Index(T1.size());
-  }
-}
+[[nodiscard]] Index TransmissionMatrix::Frequencies() const { return nf; }
 
 TransmissionMatrix::TransmissionMatrix(const ConstMatrixView& mat): TransmissionMatrix(1, mat.nrows()){
   ARTS_ASSERT(mat.nrows() == mat.ncols());
@@ -150,26 +152,15 @@ TransmissionMatrix::TransmissionMatrix(const ConstMatrixView& mat): Transmission
 
 TransmissionMatrix& TransmissionMatrix::operator+=(
     const LazyScale<TransmissionMatrix>& lstm) {
-  for (size_t i = 0; i < T4.size(); i++)
-    T4[i].noalias() = lstm.scale * lstm.bas.Mat4(i);
-  for (size_t i = 0; i < T3.size(); i++)
-    T3[i].noalias() = lstm.scale * lstm.bas.Mat3(i);
-  for (size_t i = 0; i < T2.size(); i++)
-    T2[i].noalias() = lstm.scale * lstm.bas.Mat2(i);
-  for (size_t i = 0; i < T1.size(); i++)
-    T1[i].noalias() = lstm.scale * lstm.bas.Mat1(i);
+  std::transform(lstm.bas.entries.begin(),
+                 lstm.bas.entries.end(),
+                 entries.begin(),
+                 [scale = lstm.scale](auto& T) { return scale * T; });
   return *this;
 }
 
 TransmissionMatrix& TransmissionMatrix::operator*=(const Numeric& scale) {
-  std::transform(
-      T4.begin(), T4.end(), T4.begin(), [scale](auto& T) { return T * scale; });
-  std::transform(
-      T3.begin(), T3.end(), T3.begin(), [scale](auto& T) { return T * scale; });
-  std::transform(
-      T2.begin(), T2.end(), T2.begin(), [scale](auto& T) { return T * scale; });
-  std::transform(
-      T1.begin(), T1.end(), T1.begin(), [scale](auto& T) { return T * scale; });
+  for (auto& T : entries) T *= scale;
   return *this;
 }
 
@@ -665,9 +656,10 @@ inline void transmat1(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView a1 = K1.Kjj(iz, ia), a2 = K2.Kjj(iz, ia);
+  Numeric* t = T.Entry(0, 0);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++)
-    T.Mat1(i)(0, 0) =
-        std::exp(-0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]));
+    t[i] = std::exp(-0.5 * r * (a1[i] + a2[i]));
 }
 
 inline void transmat2(TransmissionMatrix& T,
@@ -676,13 +668,19 @@ inline void transmat2(TransmissionMatrix& T,
                       const Numeric& r,
                       const Index iz = 0,
                       const Index ia = 0) noexcept {
+  const ConstVectorView a1 = K1.Kjj(iz, ia), a2 = K2.Kjj(iz, ia);
+  const ConstVectorView b1 = K1.K12(iz, ia), b2 = K2.K12(iz, ia);
+  Numeric* t00 = T.Entry(0, 0);
+  Numeric* t10 = T.Entry(1, 0);
+  Numeric* t01 = T.Entry(0, 1);
+  Numeric* t11 = T.Entry(1, 1);
   for (Index i = 0; i < K1.NumberOfFrequencies(); i++) {
-    const Numeric a = -0.5 * r * (K1.Kjj(iz, ia)[i] + K2.Kjj(iz, ia)[i]),
-                  b = -0.5 * r * (K1.K12(iz, ia)[i] + K2.K12(iz, ia)[i]);
+    const Numeric a = -0.5 * r * (a1[i] + a2[i]),
+                  b = -0.5 * r * (b1[i] + b2[i]);
     const Numeric exp_a = std::exp(a);
     const Numeric cb = std::cosh(b), sb = std::sinh(b);
-    T.Mat2(i).noalias() =
-        (Eigen::Matrix2d() << cb, sb, sb, cb).finished() * exp_a;
+    t00[i] = t11[i] = cb * exp_a;
+    t10[i] = t01[i] = sb * exp_a;
   }
 }
 
@@ -2264,10 +2262,7 @@ ArrayOfArrayOfTransmissionMatrix bulk_backscatter_derivative(
 // TEST CODE END
 
 std::ostream& operator<<(std::ostream& os, const TransmissionMatrix& tm) {
-  for (const auto& T : tm.T4) os << T << '\n';
-  for (const auto& T : tm.T3) os << T << '\n';
-  for (const auto& T : tm.T2) os << T << '\n';
-  for (const auto& T : tm.T1) os << T << '\n';
+  for (Index i = 0; i < tm.nf; i++) os << tm.Mat(i) << '\n';
   return os;
 }
 
@@ -2281,16 +2276,10 @@ std::ostream& operator<<(std::ostream& os, const RadiationVector& rv) {
 }
 
 std::istream& operator>>(std::istream& is, TransmissionMatrix& tm) {
-  for (auto& T : tm.T4)
-    is >> double_imanip() >> T(0, 0) >> T(0, 1) >> T(0, 2) >> T(0, 3) >>
-        T(1, 0) >> T(1, 1) >> T(1, 2) >> T(1, 3) >> T(2, 0) >> T(2, 1) >>
-        T(2, 2) >> T(2, 3) >> T(3, 0) >> T(3, 1) >> T(3, 2) >> T(3, 3);
-  for (auto& T : tm.T3)
-    is >> double_imanip() >> T(0, 0) >> T(0, 1) >> T(0, 2) >> T(1, 0) >>
-        T(1, 1) >> T(1, 2) >> T(2, 0) >> T(2, 1) >> T(2, 2);
-  for (auto& T : tm.T2)
-    is >> double_imanip() >> T(0, 0) >> T(0, 1) >> T(1, 0) >> T(1, 1);
-  for (auto& T : tm.T1) is >> double_imanip() >> T(0, 0);
+  for (Index i = 0; i < tm.nf; i++)
+    for (Index j = 0; j < tm.stokes_dim; j++)
+      for (Index k = 0; k < tm.stokes_dim; k++)
+        is >> double_imanip() >> tm(i, j, k);
   return is;
 }
 
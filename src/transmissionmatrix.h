@@ -144,13 +144,42 @@ Eigen::Matrix<Numeric, N, N> inv_prop_matrix(const ConstVectorView& vec) {
 #undef w
 }
 
-/** Class to keep track of Transmission Matrices for Stokes Dim 1-4 */
+/** Class to keep track of Transmission Matrices for Stokes Dim 1-4
+ * 
+ * The matrices are stored as a structure-of-arrays.  Each of the
+ * stokes_dim * stokes_dim entries is a contiguous array over frequency, so
+ * that the kernels working on all frequencies at once vectorize.  The
+ * matrix of a single frequency is accessed as a strided Eigen::Map.
+ */
 struct TransmissionMatrix {
   Index stokes_dim;
-  std::vector<Eigen::Matrix4d> T4;
-  std::vector<Eigen::Matrix3d> T3;
-  std::vector<Eigen::Matrix2d> T2;
-  std::vector<Eigen::Matrix<double, 1, 1>> T1;
+  Index nf;
+
+  /** Entry (j, k) of frequency i is at entries[(j + stokes_dim * k) * nf + i] */
+  std::vector<Numeric> entries;
+
+  /** Strides between rows and columns of the matrix of a single frequency */
+  using MatStride = Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>;
+
+  /** Strided view of the matrix of a single frequency */
+  template <int N>
+  using MatMap =
+      Eigen::Map<Eigen::Matrix<Numeric, N, N>, Eigen::Unaligned, MatStride>;
+
+  /** Strided constant view of the matrix of a single frequency */
+  template <int N>
+  using ConstMatMap = Eigen::
+      Map<const Eigen::Matrix<Numeric, N, N>, Eigen::Unaligned, MatStride>;
+
+  /** Pointer to the frequency-contiguous array of entry (j, k) */
+  [[nodiscard]] Numeric* Entry(Index j, Index k) noexcept {
+    return entries.data() + (j + stokes_dim * k) * nf;
+  }
+
+  /** Pointer to the frequency-contiguous array of entry (j, k) */
+  [[nodiscard]] const Numeric* Entry(Index j, Index k) const noexcept {
+    return entries.data() + (j + stokes_dim * k) * nf;
+  }
 
   /** Construct a new Transmission Matrix object
    * 
@@ -200,30 +229,30 @@ struct TransmissionMatrix {
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return const Eigen::Matrix4d& Matrix
+   * @return ConstMatMap<4> Matrix
    */
-  [[nodiscard]] const Eigen::Matrix4d& Mat4(size_t i) const;
+  [[nodiscard]] ConstMatMap<4> Mat4(size_t i) const;
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return const Eigen::Matrix3d& Matrix
+   * @return ConstMatMap<3> Matrix
    */
-  [[nodiscard]] const Eigen::Matrix3d& Mat3(size_t i) const;
+  [[nodiscard]] ConstMatMap<3> Mat3(size_t i) const;
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return const Eigen::Matrix2d& Matrix
+   * @return ConstMatMap<2> Matrix
    */
-  [[nodiscard]] const Eigen::Matrix2d& Mat2(size_t i) const;
+  [[nodiscard]] ConstMatMap<2> Mat2(size_t i) const;
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return const Eigen::Matrix<double, 1, 1>& Matrix
+   * @return ConstMatMap<1> Matrix
    */
-  [[nodiscard]] const Eigen::Matrix<double, 1, 1>& Mat1(size_t i) const;
+  [[nodiscard]] ConstMatMap<1> Mat1(size_t i) const;
 
   /** Get Matrix at position by copy
    * 
@@ -235,30 +264,30 @@ struct TransmissionMatrix {
   /** Get Matrix at position
    * 
    * @param [in]i Position
-   * @return Eigen::Matrix4d& Matrix
+   * @return MatMap<4> Matrix
    */
-  Eigen::Matrix4d& Mat4(size_t i);
+  MatMap<4> Mat4(size_t i);
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return Eigen::Matrix3d& Matrix
+   * @return MatMap<3> Matrix
    */
-  Eigen::Matrix3d& Mat3(size_t i);
+  MatMap<3> Mat3(size_t i);
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return Eigen::Matrix42& Matrix
+   * @return MatMap<2> Matrix
    */
-  Eigen::Matrix2d& Mat2(size_t i);
+  MatMap<2> Mat2(size_t i);
 
   /** Get Matrix at position
    * 
    * @param[in] i Position
-   * @return Eigen::Matrix<double, 1, 1>& Matrix
+   * @return MatMap<1> Matrix
    */
-  Eigen::Matrix<double, 1, 1>& Mat1(size_t i);
+  MatMap<1> Mat1(size_t i);
 
   /** Set to identity matrix */
   void setIdentity();
@@ -337,30 +366,16 @@ struct TransmissionMatrix {
 
   /** Simple template access for the transmission */
   template <int N>
-  auto& TraMat(size_t i) noexcept {
+  MatMap<N> TraMat(size_t i) noexcept {
     static_assert(N > 0 and N < 5, "Bad size N");
-    if constexpr (N == 1)
-      return T1[i];
-    else if constexpr (N == 2)
-      return T2[i];
-    else if constexpr (N == 3)
-      return T3[i];
-    else if constexpr (N == 4)
-      return T4[i];
+    return MatMap<N>(entries.data() + i, MatStride(N * nf, nf));
   }
 
   /** Simple template access for the transmission */
   template <int N>
-  [[nodiscard]] auto& TraMat(size_t i) const noexcept {
+  [[nodiscard]] ConstMatMap<N> TraMat(size_t i) const noexcept {
     static_assert(N > 0 and N < 5, "Bad size N");
-    if constexpr (N == 1)
-      return T1[i];
-    else if constexpr (N == 2)
-      return T2[i];
-    else if constexpr (N == 3)
-      return T3[i];
-    else if constexpr (N == 4)
-      return T4[i];
+    return ConstMatMap<N>(entries.data() + i, MatStride(N * nf, nf));
   }
 
   /** Simple template access for the optical depth */
@@ -432,8 +447,8 @@ struct TransmissionMatrix {
     static_assert(N > 0 and N < 5, "Bad size N");
 
     const auto I = Eigen::Matrix<Numeric, N, N>::Identity();
-    const auto T = TraMat<N>(i);
-    const auto& dTdx = dx.TraMat<N>(i);
+    const Eigen::Matrix<Numeric, N, N> T = TraMat<N>(i);
+    const Eigen::Matrix<Numeric, N, N> dTdx = dx.TraMat<N>(i);
     const Eigen::Matrix<Numeric, N, 1> first = 0.5 * (I - T) * (far + close);
     if (T(0, 0) < 0.99) {
       const auto od = OptDepth<N>(i);
@@ -11,6 +11,9 @@
 #include <sys/errno.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <unordered_map>
 
 #include "arts_omp.h"
 #include "arts_conversions.h"
@@ -86,6 +89,68 @@ Numeric wigner6j(const Rational j1,
   return Numeric(g);
 }
 
+namespace {
+constexpr int wigner_key_bits = 10;
+
+//! Packs the doubled arguments of a symbol, if they all fit in the key
+bool wigner_key(std::uint64_t& key, std::initializer_list<Rational> args) {
+  constexpr int offset = 1 << (wigner_key_bits - 1);
+
+  key = 0;
+  for (auto& x : args) {
+    const int j = x.toInt(2) + offset;
+    if (j < 0 or j >= 2 * offset) return false;
+    key = (key << wigner_key_bits) | std::uint64_t(j);
+  }
+  return true;
+}
+
+//! Number of symbols at which the cache of a thread is emptied, about 10 MB
+constexpr std::size_t wigner_cache_max_size = 1 << 18;
+
+//! The cached symbol of the key, computed and kept if it is not cached
+template <typename Compute>
+Numeric wigner_cached(std::unordered_map<std::uint64_t, Numeric>& cache,
+                      std::uint64_t key,
+                      Compute&& compute) {
+  if (auto ptr = cache.find(key); ptr not_eq cache.end()) return ptr->second;
+  if (cache.size() >= wigner_cache_max_size) cache.clear();
+  return cache[key] = compute();
+}
+}  // namespace
+
+Numeric wigner3j_cached(const Rational j1,
+                        const Rational j2,
+                        const Rational j3,
+                        const Rational m1,
+                        const Rational m2,
+                        const Rational m3) {
+  thread_local std::unordered_map<std::uint64_t, Numeric> cache;
+
+  std::uint64_t key;
+  if (not wigner_key(key, {j1, j2, j3, m1, m2, m3}))
+    return wigner3j(j1, j2, j3, m1, m2, m3);
+
+  return wigner_cached(
+      cache, key, [&]() { return wigner3j(j1, j2, j3, m1, m2, m3); });
+}
+
+Numeric wigner6j_cached(const Rational j1,
+                        const Rational j2,
+                        const Rational j3,
+                        const Rational l1,
+                        const Rational l2,
+                        const Rational l3) {
+  thread_local std::unordered_map<std::uint64_t, Numeric> cache;
+
+  std::uint64_t key;
+  if (not wigner_key(key, {j1, j2, j3, l1, l2, l3}))
+    return wigner6j(j1, j2, j3, l1, l2, l3);
+
+  return wigner_cached(
+      cache, key, [&]() { return wigner6j(j1, j2, j3, l1, l2, l3); });
+}
+
 std::pair<Rational, Rational> wigner_limits(std::pair<Rational, Rational> a,
                                             std::pair<Rational, Rational> b) {
   const bool invalid = a.first.isUndefined() or b.first.isUndefined();
@@ -160,6 +160,52 @@ Numeric wigner6j(const Rational j1,
                  const Rational l2,
                  const Rational l3);
 
+/** Wigner 3J symbol from a cache
+ *
+ * As wigner3j, but each thread keeps the symbols it has computed, keyed on
+ * the doubled arguments.  The relaxation matrices of a band need the same
+ * symbols at every temperature and for every broadener, so they are only
+ * computed the first time.  Symbols with any argument beyond 255 are not
+ * kept, and a thread forgets all its symbols before keeping more than 2^18
+ * of them.
+ *
+ * Do not call this between wig_thread_temp_init and wig_temp_free, since a
+ * symbol that is not cached is computed by wigner3j.
+ *
+ * @param[in] j1 as wigner3j
+ * @param[in] j2 as wigner3j
+ * @param[in] j3 as wigner3j
+ * @param[in] m1 as wigner3j
+ * @param[in] m2 as wigner3j
+ * @param[in] m3 as wigner3j
+ * @return Numeric Symbol value
+ */
+Numeric wigner3j_cached(const Rational j1,
+                        const Rational j2,
+                        const Rational j3,
+                        const Rational m1,
+                        const Rational m2,
+                        const Rational m3);
+
+/** Wigner 6J symbol from a cache
+ *
+ * As wigner6j, cached as wigner3j_cached
+ *
+ * @param[in] j1 as wigner6j
+ * @param[in] j2 as wigner6j
+ * @param[in] j3 as wigner6j
+ * @param[in] l1 as wigner6j
+ * @param[in] l2 as wigner6j
+ * @param[in] l3 as wigner6j
+ * @return Numeric Symbol value
+ */
+Numeric wigner6j_cached(const Rational j1,
+                        const Rational j2,
+                        const Rational j3,
+                        const Rational l1,
+                        const Rational l2,
+                        const Rational l3);
+
 /** Ready Wigner
  * 
  * @param[in] largest
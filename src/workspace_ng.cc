@@ -42,9 +42,10 @@ void Workspace::duplicate(Index i) {
   WorkspaceVariableStruct wsvs;
 
   if (ws[i].size()) {
-    wsvs.wsv = workspace_memory_handler.duplicate((*wsv_data_ptr)[i].Group(),
-                                                  ws[i].top().wsv);
+    // The value is only copied if this level writes to it
+    wsvs.wsv = ws[i].top().wsv;
     wsvs.initialized = true;
+    wsvs.copy_on_write = true;
   } else {
     if ((*wsv_data_ptr)[i].Group() == agenda_index) {
       wsvs.wsv = std::make_shared<Agenda>(*this);
@@ -67,6 +68,7 @@ Workspace::Workspace(const Workspace &workspace)
       WorkspaceVariableStruct wsvs;
       wsvs.wsv = workspace.ws[i].top().wsv;
       wsvs.initialized = workspace.ws[i].top().initialized;
+      wsvs.copy_on_write = workspace.ws[i].top().copy_on_write;
       ws[i].push(std::move(wsvs));
     }
   }
@@ -122,6 +124,22 @@ void Workspace::emplace(Index i) {
 }
 
 std::shared_ptr<void> Workspace::operator[](Index i) {
+  if (ws[i].size() == 0) emplace(i);
+  auto &top = ws[i].top();
+  top.initialized = true;
+
+  if (top.copy_on_write) {
+    // Nobody else holds the value if this is the last reference to it
+    if (top.wsv.use_count() > 1)
+      top.wsv = workspace_memory_handler.duplicate((*wsv_data_ptr)[i].Group(),
+                                                   top.wsv);
+    top.copy_on_write = false;
+  }
+
+  return top.wsv;
+}
+
+std::shared_ptr<void> Workspace::read(Index i) {
   if (ws[i].size() == 0) emplace(i);
   ws[i].top().initialized = true;
   return ws[i].top().wsv;
@@ -225,3 +243,10 @@ std::shared_ptr<Workspace> Workspace::shallowcopy() const {
   auto mout = Workspace{*this};
   return std::make_shared<Workspace>(std::move(mout));
 }
+
+std::shared_ptr<Workspace> Workspace::fork() const {
+  auto out = shallowcopy();
+  for (auto &wsv : out->ws)
+    if (wsv.size()) wsv.top().copy_on_write = true;
+  return out;
+}
@@ -20,6 +20,9 @@
 struct WorkspaceVariableStruct final {
   std::shared_ptr<void> wsv;
   bool initialized;
+
+  //! The value is shared and must be copied before it is written to
+  bool copy_on_write{false};
 };
 
 using WorkspaceVariable = stack<WorkspaceVariableStruct, std::vector<WorkspaceVariableStruct>>;
@@ -69,6 +72,15 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
   //! Shallow copy of a Workspace, it has to be created as a shared pointer
   [[nodiscard]] std::shared_ptr<Workspace> shallowcopy() const;
 
+  /** Copy-on-write copy of a Workspace, for use in parallel regions
+   *
+   * All values are shared with this workspace, like for a shallow copy, but
+   * a value gets copied the first time it is written to in the fork.  Values
+   * that are only read, such as lookup tables and line catalogs, are never
+   * copied, and writes in the fork are not seen by this workspace.
+   */
+  [[nodiscard]] std::shared_ptr<Workspace> fork() const;
+
   //! Allow move construction of this object in public
   Workspace(Workspace&&) noexcept = default;
 
@@ -83,7 +95,8 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
   /** Duplicate WSV.
    *
    * Create another level of scope by duplicating the top element on the WSV
-   * stack.
+   * stack.  The new level shares the value of the level below until it is
+   * written to.
    *
    * @param[in] i
    */
@@ -166,9 +179,18 @@ class Workspace final : public std::enable_shared_from_this<Workspace> {
   /** Add a new variable to this workspace */
   Index add_wsv(const WsvRecord &wsv);
 
-  /** Retrieve a pointer to the given WSV. */
+  /** Retrieve a pointer to the given WSV.
+   *
+   * The pointer may be written through, so a shared value is copied first.
+   */
   std::shared_ptr<void> operator[](Index i);
 
+  /** Retrieve a pointer to the given WSV for reading only.
+   *
+   * Like operator[], but a shared value is not copied.
+   */
+  std::shared_ptr<void> read(Index i);
+
   /** Retrieve a value ptr if it exist (FIXME: C++20 allows const char* as template argument) */
   template <class T>
   T* get(const char *name) {
@@ -207,6 +229,9 @@ concept CopyConstructor = requires(const T& a) {{ T{a} };};
 template <typename T>
 concept ShallowCopyConstructor = requires(const T& a) {a.shallowcopy();};
 
+template <typename T>
+concept ForkConstructor = requires(const T& a) {a.fork();};
+
 template <typename T>
 concept CanCopy = CopyConstructor<T> or ShallowCopyConstructor<T>;
 
@@ -217,6 +242,12 @@ std::shared_ptr<T> get_shallow_copy(const T& x) {
   else { T mout{x}; return std::make_shared<T>(std::move(mout)); }
 }
 
+template <typename T>
+std::shared_ptr<T> get_parallel_copy(const T& x) {
+  if constexpr (ForkConstructor<T>) return x.fork();
+  else return get_shallow_copy(x);
+}
+
 template <CanCopy T>
 class OmpParallelCopyGuard {
   T &orig;
@@ -226,7 +257,7 @@ class OmpParallelCopyGuard {
  public:
   OmpParallelCopyGuard(T &ws) 
     : orig(ws),
-      do_copy(not arts_omp_in_parallel() and arts_omp_get_max_threads() not_eq 1),
+      do_copy(arts_omp_get_available_threads() not_eq 1),
       copy(nullptr) {}
 
   OmpParallelCopyGuard(T &ws, bool do_copy_manually)
@@ -235,7 +266,7 @@ class OmpParallelCopyGuard {
   OmpParallelCopyGuard(const OmpParallelCopyGuard &cp)
     : orig(cp.orig),
       do_copy(cp.do_copy),
-      copy(do_copy ? get_shallow_copy(orig) : nullptr) {}
+      copy(do_copy ? get_parallel_copy(orig) : nullptr) {}
 
   operator T &() { return copy ? *copy : orig; }
 
@@ -171,6 +171,13 @@ TMPL_XML_READ_WRITE_STREAM(ArrayOfVector)
 
 TMPL_XML_READ_WRITE_STREAM(CallbackFunction)
 
+//=== Read only Types ======================================================
+
+void xml_read_from_stream(istream &,
+                          SingleScatteringDataFWindow &,
+                          bifstream *,
+                          const Verbosity &);
+
 //==========================================================================
 
 // Undefine the macro to avoid it being used anywhere else
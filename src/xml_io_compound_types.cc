@@ -15,7 +15,11 @@
 #include "global_data.h"
 #include "predefined/predef_data.h"
 #include "xml_io.h"
+#include "double_imanip.h"
+#include <array>
+#include <numeric>
 #include <sstream>
+#include <tuple>
 
 ////////////////////////////////////////////////////////////////////////////
 //   Overloaded functions for reading/writing data from/to XML stream
@@ -323,6 +327,92 @@ void xml_write_to_stream(ostream& os_xml,
 
 //=== GasAbsLookup ===========================================================
 
+//! Reads single precision cross sections of a GasAbsLookup
+/*!
+  Same format as a Tensor4, but with the binary data as 4-byte floats.
+
+  \param is_xml  XML Input stream
+  \param data    The cross sections
+  \param shape   The dimensions of the cross sections
+  \param pbifs   Pointer to binary input stream. NULL in case of ASCII file.
+*/
+static void xml_read_float_xsec(istream& is_xml,
+                                std::vector<float>& data,
+                                std::array<Index, 4>& shape,
+                                bifstream* pbifs,
+                                const Verbosity& verbosity) {
+  XMLTag tag(verbosity);
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("Tensor4");
+
+  tag.get_attribute_value("nbooks", shape[0]);
+  tag.get_attribute_value("npages", shape[1]);
+  tag.get_attribute_value("nrows", shape[2]);
+  tag.get_attribute_value("ncols", shape[3]);
+  data.resize(shape[0] * shape[1] * shape[2] * shape[3]);
+
+  for (auto& x : data) {
+    if (pbifs) {
+      x = static_cast<float>(pbifs->readFloat(binio::Single));
+    } else {
+      Numeric d;
+      is_xml >> double_imanip() >> d;
+      if (is_xml.fail()) xml_data_parse_error(tag, "");
+      x = static_cast<float>(d);
+    }
+  }
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/Tensor4");
+}
+
+//! Writes single precision cross sections of a GasAbsLookup
+/*!
+  \param os_xml  XML Output stream
+  \param data    The cross sections
+  \param shape   The dimensions of the cross sections
+  \param pbofs   Pointer to binary file stream. NULL for ASCII output.
+  \param name    Optional name attribute
+*/
+static void xml_write_float_xsec(ostream& os_xml,
+                                 const std::vector<float>& data,
+                                 const std::array<Index, 4>& shape,
+                                 bofstream* pbofs,
+                                 const String& name,
+                                 const Verbosity& verbosity) {
+  XMLTag open_tag(verbosity);
+  XMLTag close_tag(verbosity);
+
+  open_tag.set_name("Tensor4");
+  if (name.length()) open_tag.add_attribute("name", name);
+  open_tag.add_attribute("nbooks", shape[0]);
+  open_tag.add_attribute("npages", shape[1]);
+  open_tag.add_attribute("nrows", shape[2]);
+  open_tag.add_attribute("ncols", shape[3]);
+
+  open_tag.write_to_stream(os_xml);
+  os_xml << '\n';
+
+  // Enough digits to restore the floats exactly
+  const auto precision = os_xml.precision(9);
+
+  const auto ncols = static_cast<std::size_t>(shape[3]);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    if (pbofs)
+      pbofs->writeFloat(data[i], binio::Single);
+    else
+      os_xml << data[i] << ((i + 1) % ncols ? ' ' : '\n');
+  }
+
+  os_xml.precision(precision);
+
+  close_tag.set_name("/Tensor4");
+  close_tag.write_to_stream(os_xml);
+
+  os_xml << '\n';
+}
+
 //! Reads GasAbsLookup from XML input stream
 /*!
   \param is_xml  XML Input stream
@@ -338,6 +428,11 @@ void xml_read_from_stream(istream& is_xml,
   tag.read_from_stream(is_xml);
   tag.check_name("GasAbsLookup");
 
+  // Tables in double precision have no storage attribute
+  String storage = "Double";
+  if (tag.has_attribute("storage")) tag.get_attribute_value("storage", storage);
+  gal.storage = Options::toLookupStorageOrThrow(storage);
+
   xml_read_from_stream(is_xml, gal.species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nonlinear_species, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.f_grid, pbifs, verbosity);
@@ -346,7 +441,16 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, gal.t_ref, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.t_pert, pbifs, verbosity);
   xml_read_from_stream(is_xml, gal.nls_pert, pbifs, verbosity);
-  xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+  if (gal.storage == Options::LookupStorage::Float) {
+    xml_read_float_xsec(
+        is_xml, gal.xsec_float, gal.xsec_float_shape, pbifs, verbosity);
+    gal.xsec = Tensor4{};
+  } else {
+    xml_read_from_stream(is_xml, gal.xsec, pbifs, verbosity);
+    gal.xsec_float = std::vector<float>{};
+    gal.xsec_float_shape = {0, 0, 0, 0};
+  }
+  gal.xsec_map.reset();
 
   tag.read_from_stream(is_xml);
   tag.check_name("/GasAbsLookup");
@@ -369,6 +473,8 @@ void xml_write_to_stream(ostream& os_xml,
 
   open_tag.set_name("GasAbsLookup");
   if (name.length()) open_tag.add_attribute("name", name);
+  if (gal.storage not_eq Options::LookupStorage::Double)
+    open_tag.add_attribute("storage", String{toString(gal.storage)});
   open_tag.write_to_stream(os_xml);
 
   xml_write_to_stream(os_xml, gal.species, pbofs, "", verbosity);
@@ -387,8 +493,23 @@ void xml_write_to_stream(ostream& os_xml,
                       pbofs,
                       "NonlinearSpeciesVmrPerturbations",
                       verbosity);
-  xml_write_to_stream(
-      os_xml, gal.xsec, pbofs, "AbsorptionCrossSections", verbosity);
+  if (gal.storage == Options::LookupStorage::Float) {
+    xml_write_float_xsec(os_xml,
+                         gal.xsec_float,
+                         gal.xsec_float_shape,
+                         pbofs,
+                         "AbsorptionCrossSections",
+                         verbosity);
+  } else {
+    // A memory mapped table is copied, only a Tensor4 can be written
+    const Tensor4 mapped_xsec =
+        gal.xsec_map ? Tensor4{gal.XsecView()} : Tensor4{};
+    xml_write_to_stream(os_xml,
+                        gal.xsec_map ? mapped_xsec : gal.xsec,
+                        pbofs,
+                        "AbsorptionCrossSections",
+                        verbosity);
+  }
 
   close_tag.set_name("/GasAbsLookup");
   close_tag.write_to_stream(os_xml);
@@ -1314,16 +1435,17 @@ void xml_write_to_stream(ostream& os_xml,
 
 //=== SingleScatteringData ======================================
 
-//! Reads SingleScatteringData from XML input stream
+//! Reads SingleScatteringData from XML input stream up to the tensors
 /*!
   \param is_xml  XML Input stream
   \param ssdata  SingleScatteringData return value
   \param pbifs   Pointer to binary input stream. NULL in case of ASCII file.
+  \return The version of the data
 */
-void xml_read_from_stream(istream& is_xml,
-                          SingleScatteringData& ssdata,
-                          bifstream* pbifs,
-                          const Verbosity& verbosity) {
+static String xml_read_ssd_grids(istream& is_xml,
+                                 SingleScatteringData& ssdata,
+                                 bifstream* pbifs,
+                                 const Verbosity& verbosity) {
   ArtsXMLTag tag(verbosity);
   String version;
 
@@ -1370,6 +1492,109 @@ void xml_read_from_stream(istream& is_xml,
   }
   xml_read_from_stream(is_xml, ssdata.aa_grid, pbifs, verbosity);
 
+  return version;
+}
+
+//! Reads the end of SingleScatteringData from XML input stream
+/*!
+  \param is_xml   XML Input stream
+  \param ssdata   SingleScatteringData return value
+  \param version  The version of the data
+*/
+static void xml_read_ssd_end(istream& is_xml,
+                             SingleScatteringData& ssdata,
+                             const String& version,
+                             const Verbosity& verbosity) {
+  ArtsXMLTag tag(verbosity);
+
+  tag.read_from_stream(is_xml);
+  tag.check_name("/SingleScatteringData");
+
+  if (version != "3" && ssdata.ptype == PTYPE_AZIMUTH_RND) {
+    ConvertAzimuthallyRandomSingleScatteringData(ssdata);
+  }
+
+  chk_scat_data(ssdata, verbosity);
+}
+
+//! Reads some frequencies of a tensor of SingleScatteringData
+/*!
+  Reads the frequencies [f_start, f_start + nf) of a tensor with frequency
+  as first dimension. The other frequencies are skipped in binary files and
+  parsed, but not kept, in ASCII files.
+
+  \param is_xml   XML Input stream
+  \param tensor   Tensor return value
+  \param pbifs    Pointer to binary input stream. NULL in case of ASCII file.
+  \param dims     Tag name and size attributes of the tensor
+  \param nf_grid  Number of frequencies of the data
+  \param f_start  First frequency to read
+  \param nf       Number of frequencies to read
+*/
+template <typename Tensor, std::size_t N>
+static void xml_read_ssd_f_window(istream& is_xml,
+                                  Tensor& tensor,
+                                  bifstream* pbifs,
+                                  const std::array<const char*, N>& dims,
+                                  Index nf_grid,
+                                  Index f_start,
+                                  Index nf,
+                                  const Verbosity& verbosity) {
+  XMLTag tag(verbosity);
+  std::array<Index, N - 1> shape;
+
+  tag.read_from_stream(is_xml);
+  tag.check_name(dims[0]);
+  for (std::size_t i = 0; i < N - 1; i++)
+    tag.get_attribute_value(dims[i + 1], shape[i]);
+
+  ARTS_USER_ERROR_IF(shape[0] != nf_grid,
+                     "Number of frequencies in f_grid and ",
+                     dims[0],
+                     " not matching!!!")
+
+  const Index nper_f = std::accumulate(
+      shape.begin() + 1, shape.end(), Index{1}, std::multiplies<>());
+  shape[0] = nf;
+  std::apply([&tensor](auto... n) { tensor.resize(n...); }, shape);
+
+  if (pbifs) {
+    const auto nbytes = [nper_f](Index n) {
+      return long(sizeof(double)) * nper_f * n;
+    };
+    pbifs->seek(nbytes(f_start), binio::Add);
+    pbifs->readDoubleArray(tensor.data_handle(), nper_f * nf);
+    pbifs->seek(nbytes(nf_grid - f_start - nf), binio::Add);
+  } else {
+    Numeric* data = tensor.data_handle();
+    Numeric x;
+    for (Index i = 0; i < nf_grid * nper_f; i++) {
+      is_xml >> double_imanip() >> x;
+      if (is_xml.fail()) {
+        ostringstream os;
+        os << " near element " << i;
+        xml_data_parse_error(tag, os.str());
+      }
+      if (i >= f_start * nper_f and i < (f_start + nf) * nper_f) *data++ = x;
+    }
+  }
+
+  tag.read_from_stream(is_xml);
+  tag.check_name(String{"/"} + dims[0]);
+}
+
+//! Reads SingleScatteringData from XML input stream
+/*!
+  \param is_xml  XML Input stream
+  \param ssdata  SingleScatteringData return value
+  \param pbifs   Pointer to binary input stream. NULL in case of ASCII file.
+*/
+void xml_read_from_stream(istream& is_xml,
+                          SingleScatteringData& ssdata,
+                          bifstream* pbifs,
+                          const Verbosity& verbosity) {
+  const String version = xml_read_ssd_grids(is_xml, ssdata, pbifs, verbosity);
+
   xml_read_from_stream(is_xml, ssdata.pha_mat_data, pbifs, verbosity);
   if (ssdata.pha_mat_data.nlibraries() != ssdata.f_grid.nelem()) {
     throw runtime_error(
@@ -1380,14 +1605,65 @@ void xml_read_from_stream(istream& is_xml,
   xml_read_from_stream(is_xml, ssdata.ext_mat_data, pbifs, verbosity);
   xml_read_from_stream(is_xml, ssdata.abs_vec_data, pbifs, verbosity);
 
-  tag.read_from_stream(is_xml);
-  tag.check_name("/SingleScatteringData");
+  xml_read_ssd_end(is_xml, ssdata, version, verbosity);
+}
 
-  if (version != "3" && ssdata.ptype == PTYPE_AZIMUTH_RND) {
-    ConvertAzimuthallyRandomSingleScatteringData(ssdata);
-  }
+//! Reads the frequencies of SingleScatteringData needed for a f_grid
+/*!
+  Only the frequencies of the data selected by ssd_f_window are read.
 
-  chk_scat_data(ssdata, verbosity);
+  \param is_xml  XML Input stream
+  \param window  SingleScatteringDataFWindow return value
+  \param pbifs   Pointer to binary input stream. NULL in case of ASCII file.
+*/
+void xml_read_from_stream(istream& is_xml,
+                          SingleScatteringDataFWindow& window,
+                          bifstream* pbifs,
+                          const Verbosity& verbosity) {
+  SingleScatteringData& ssdata = window.ssd;
+  const String version = xml_read_ssd_grids(is_xml, ssdata, pbifs, verbosity);
+
+  const Index nf_grid = ssdata.f_grid.nelem();
+  const auto [f_start, nf] =
+      ssd_f_window(ssdata.f_grid, window.f_grid, window.interp_order);
+  ssdata.f_grid = Vector{ssdata.f_grid[Range(f_start, nf)]};
+
+  constexpr std::array pha_mat_dims{"Tensor7",
+                                    "nlibraries",
+                                    "nvitrines",
+                                    "nshelves",
+                                    "nbooks",
+                                    "npages",
+                                    "nrows",
+                                    "ncols"};
+  constexpr std::array vec_dims{
+      "Tensor5", "nshelves", "nbooks", "npages", "nrows", "ncols"};
+  xml_read_ssd_f_window(is_xml,
+                        ssdata.pha_mat_data,
+                        pbifs,
+                        pha_mat_dims,
+                        nf_grid,
+                        f_start,
+                        nf,
+                        verbosity);
+  xml_read_ssd_f_window(is_xml,
+                        ssdata.ext_mat_data,
+                        pbifs,
+                        vec_dims,
+                        nf_grid,
+                        f_start,
+                        nf,
+                        verbosity);
+  xml_read_ssd_f_window(is_xml,
+                        ssdata.abs_vec_data,
+                        pbifs,
+                        vec_dims,
+                        nf_grid,
+                        f_start,
+                        nf,
+                        verbosity);
+
+  xml_read_ssd_end(is_xml, ssdata, version, verbosity);
 }
 
 //! Writes SingleScatteringData to XML output stream